@@ -7,39 +7,67 @@
 
 namespace fixed_containers::emplace_detail
 {
-template <typename Container, typename... Args>
+// Splits the arguments of `emplace()` into the key and the arguments of the mapped value, as
+// expected by `try_emplace()`, and passes them to `try_emplace_fn`
+template <typename TryEmplaceFn, typename... Args>
     requires(sizeof...(Args) >= 1 and sizeof...(Args) <= 3)
-constexpr std::pair<typename Container::iterator, bool> emplace_in_terms_of_try_emplace_impl(
-    Container& container, Args&&... args)
+constexpr decltype(auto) emplace_in_terms_of(TryEmplaceFn&& try_emplace_fn, Args&&... args)
 {
-    return [&]<typename First, typename... Rest>(First&& first, Rest&&... rest)
+    return [&]<typename First, typename... Rest>(First&& first, Rest&&... rest) -> decltype(auto)
     {
         if constexpr (sizeof...(Rest) == 0 && IsStdPair<First>)
         {
             // Lambda to avoid compilation errors with .first/.second when passing a non-pair
-            return [&container]<typename Pair>(Pair&& pair) {
-                return container.try_emplace(std::forward<Pair>(pair).first,
-                                             std::forward<Pair>(pair).second);
+            return [&try_emplace_fn]<typename Pair>(Pair&& pair) -> decltype(auto) {
+                return try_emplace_fn(std::forward<Pair>(pair).first,
+                                      std::forward<Pair>(pair).second);
             }(std::forward<First>(first));
         }
         else if constexpr (sizeof...(Rest) == 2 &&
                            std::same_as<std::piecewise_construct_t, std::decay_t<First>>)
         {
-            return [&container]<typename P1, typename P2>(P1&& piece1, P2&& piece2)
+            return [&try_emplace_fn]<typename P1, typename P2>(P1&& piece1,
+                                                               P2&& piece2) -> decltype(auto)
             {
-                return
-                    [&container, &piece1, &piece2]<std::size_t... INDEX_1, std::size_t... INDEX_2>(
-                        std::index_sequence<INDEX_1...>, std::index_sequence<INDEX_2...>) {
-                        return container.try_emplace(std::get<INDEX_1>(piece1)...,
-                                                     std::get<INDEX_2>(piece2)...);
-                    }(std::make_index_sequence<std::tuple_size_v<P1>>{},
-                      std::make_index_sequence<std::tuple_size_v<P2>>{});
+                return [&try_emplace_fn, &piece1, &piece2]<std::size_t... INDEX_1,
+                                                           std::size_t... INDEX_2>(
+                           std::index_sequence<INDEX_1...>,
+                           std::index_sequence<INDEX_2...>) -> decltype(auto) {
+                    return try_emplace_fn(std::get<INDEX_1>(piece1)...,
+                                          std::get<INDEX_2>(piece2)...);
+                }(std::make_index_sequence<std::tuple_size_v<P1>>{},
+                       std::make_index_sequence<std::tuple_size_v<P2>>{});
             }(std::forward<Rest>(rest)...);
         }
         else
         {
-            return container.try_emplace(std::forward<First>(first), std::forward<Rest>(rest)...);
+            return try_emplace_fn(std::forward<First>(first), std::forward<Rest>(rest)...);
         }
     }(std::forward<Args>(args)...);
 }
+
+template <typename Container, typename... Args>
+    requires(sizeof...(Args) >= 1 and sizeof...(Args) <= 3)
+constexpr std::pair<typename Container::iterator, bool> emplace_in_terms_of_try_emplace_impl(
+    Container& container, Args&&... args)
+{
+    return emplace_in_terms_of(
+        [&container]<typename... TryEmplaceArgs>(TryEmplaceArgs&&... try_emplace_args) {
+            return container.try_emplace(std::forward<TryEmplaceArgs>(try_emplace_args)...);
+        },
+        std::forward<Args>(args)...);
+}
+
+template <typename Container, typename... Args>
+    requires(sizeof...(Args) >= 1 and sizeof...(Args) <= 3)
+constexpr std::pair<typename Container::iterator, bool> emplace_hint_in_terms_of_try_emplace_impl(
+    Container& container, typename Container::const_iterator hint, Args&&... args)
+{
+    return emplace_in_terms_of(
+        [&container, &hint]<typename... TryEmplaceArgs>(TryEmplaceArgs&&... try_emplace_args) {
+            return container.try_emplace(hint,
+                                         std::forward<TryEmplaceArgs>(try_emplace_args)...);
+        },
+        std::forward<Args>(args)...);
+}
 }  // namespace fixed_containers::emplace_detail
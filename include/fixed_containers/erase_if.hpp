@@ -19,4 +19,13 @@ constexpr typename Container::size_type erase_if_impl(Container& container, Pred
     }
     return original_size - container.size();
 }
+
+// Tables that can erase all the values matching a predicate at once, instead of one iterator at a
+// time. See `FixedRobinhoodHashtable::erase_if_at()`.
+template <typename TableImpl>
+concept TableWithEraseIfAt =
+    requires(TableImpl& table,
+             bool (*predicate)(const typename TableImpl::OpaqueIteratedType&)) {
+        table.erase_if_at(predicate);
+    };
 }  // namespace fixed_containers::erase_if_detail
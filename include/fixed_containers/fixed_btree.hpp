@@ -0,0 +1,1141 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/index_width.hpp"
+#include "fixed_containers/memory.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_btree_detail
+{
+// Keys of a node span four cache lines, which keeps a tree of a few thousand entries at three
+// levels or less.
+template <class K>
+constexpr std::size_t default_keys_per_node()
+{
+    return std::clamp<std::size_t>(256 / sizeof(K), 4, 64);
+}
+
+// Worst-case number of inner nodes, and of levels of them, for `leaf_count` leaves when every
+// inner node other than the root has at least `min_child_count` children.
+struct InnerNodeBounds
+{
+    std::size_t node_count;
+    std::size_t level_count;
+};
+constexpr InnerNodeBounds inner_node_bounds(const std::size_t leaf_count,
+                                            const std::size_t min_child_count)
+{
+    InnerNodeBounds out{0, 0};
+    std::size_t level_size = leaf_count;
+    while (level_size > 1)
+    {
+        level_size = (std::max)(std::size_t{1}, level_size / min_child_count);
+        out.node_count += level_size;
+        out.level_count++;
+    }
+    return out;
+}
+
+// An entry stays at the same index of the entry pool until it is erased. It knows its leaf, so an
+// iterator to it can step to its neighbours.
+template <class K, class V, class NodeIndex>
+struct FixedBTreeEntry
+{
+    // Public so this type is a structural type and can thus be used in template parameters
+    K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
+    V IMPLEMENTATION_DETAIL_DO_NOT_USE_value_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_leaf_index_;
+
+    template <class K0, class... Args>
+    constexpr FixedBTreeEntry(const NodeIndex leaf_index, K0&& key, Args&&... args)
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_key_(std::forward<K0>(key))
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_value_(std::forward<Args>(args)...)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_leaf_index_(leaf_index)
+    {
+    }
+
+    [[nodiscard]] constexpr const K& key() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_; }
+    [[nodiscard]] constexpr const V& value() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_;
+    }
+    constexpr V& value() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_; }
+
+    [[nodiscard]] constexpr NodeIndex leaf_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_leaf_index_;
+    }
+    constexpr void set_leaf_index(const NodeIndex index)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_leaf_index_ = index;
+    }
+};
+
+template <class K, class NodeIndex>
+struct FixedBTreeEntry<K, EmptyValue, NodeIndex>
+{
+    // Public so this type is a structural type and can thus be used in template parameters
+    K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_leaf_index_;
+
+    template <class K0>
+    constexpr FixedBTreeEntry(const NodeIndex leaf_index, K0&& key)
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_key_(std::forward<K0>(key))
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_leaf_index_(leaf_index)
+    {
+    }
+
+    [[nodiscard]] constexpr const K& key() const { return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_; }
+
+    [[nodiscard]] constexpr NodeIndex leaf_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_leaf_index_;
+    }
+    constexpr void set_leaf_index(const NodeIndex index)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_leaf_index_ = index;
+    }
+};
+
+// A copy of the key of each entry, packed together for the search, and the index of the entry in
+// the same slot
+template <class K, std::size_t KEYS_PER_NODE, class NodeIndex, class EntryIndex>
+struct FixedBTreeLeaf
+{
+    static constexpr NodeIndex NULL_INDEX = (std::numeric_limits<NodeIndex>::max)();
+    using KeyVector = FixedVector<K, KEYS_PER_NODE>;
+    using EntryIndexArray = std::array<EntryIndex, KEYS_PER_NODE>;
+
+    // Public so this type is a structural type and can thus be used in template parameters
+    KeyVector IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{};
+    EntryIndexArray IMPLEMENTATION_DETAIL_DO_NOT_USE_entry_indices_{};
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_previous_index_ = NULL_INDEX;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_ = NULL_INDEX;
+
+    constexpr KeyVector& keys() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_; }
+    [[nodiscard]] constexpr const KeyVector& keys() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const { return keys().size(); }
+
+    [[nodiscard]] constexpr EntryIndex entry_index_at(const std::size_t slot) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_entry_indices_[slot];
+    }
+    [[nodiscard]] constexpr std::size_t slot_of(const EntryIndex entry_index) const
+    {
+        std::size_t slot = 0;
+        while (entry_index_at(slot) != entry_index)
+        {
+            slot++;
+        }
+        return slot;
+    }
+
+    template <class K0>
+    constexpr void insert_at(const std::size_t slot, K0&& key, const EntryIndex entry_index)
+    {
+        for (std::size_t i = size(); i > slot; i--)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_entry_indices_[i] = entry_index_at(i - 1);
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_entry_indices_[slot] = entry_index;
+        keys().emplace(std::next(keys().cbegin(), static_cast<std::ptrdiff_t>(slot)),
+                       std::forward<K0>(key));
+    }
+    template <class K0>
+    constexpr void push_back(K0&& key, const EntryIndex entry_index)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_entry_indices_[size()] = entry_index;
+        keys().emplace_back(std::forward<K0>(key));
+    }
+
+    constexpr void erase_at(const std::size_t slot)
+    {
+        for (std::size_t i = slot; i + 1 < size(); i++)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_entry_indices_[i] = entry_index_at(i + 1);
+        }
+        keys().erase(std::next(keys().cbegin(), static_cast<std::ptrdiff_t>(slot)));
+    }
+    // Drops the slots from `first_slot` on
+    constexpr void erase_from(const std::size_t first_slot)
+    {
+        keys().erase(std::next(keys().cbegin(), static_cast<std::ptrdiff_t>(first_slot)),
+                     keys().cend());
+    }
+
+    [[nodiscard]] constexpr NodeIndex previous_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_previous_index_;
+    }
+    constexpr void set_previous_index(const NodeIndex index)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_previous_index_ = index;
+    }
+    [[nodiscard]] constexpr NodeIndex next_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_;
+    }
+    constexpr void set_next_index(const NodeIndex index)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_next_index_ = index;
+    }
+};
+
+// `keys()[i]` is greater than every key under `child_at(i)` and not greater than any key under
+// `child_at(i + 1)`. A node has one more child than it has keys.
+template <class K, std::size_t KEYS_PER_NODE, class NodeIndex>
+struct FixedBTreeInnerNode
+{
+    // One more key and child than a node keeps between operations, for the split that follows
+    using KeyVector = FixedVector<K, KEYS_PER_NODE + 1>;
+    using ChildArray = std::array<NodeIndex, KEYS_PER_NODE + 2>;
+
+    // Public so this type is a structural type and can thus be used in template parameters
+    KeyVector IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_{};
+    ChildArray IMPLEMENTATION_DETAIL_DO_NOT_USE_children_{};
+
+    constexpr KeyVector& keys() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_; }
+    [[nodiscard]] constexpr const KeyVector& keys() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_keys_;
+    }
+
+    [[nodiscard]] constexpr std::size_t child_count() const { return keys().size() + 1; }
+    [[nodiscard]] constexpr NodeIndex child_at(const std::size_t slot) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_children_[slot];
+    }
+    constexpr void set_child_at(const std::size_t slot, const NodeIndex index)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_children_[slot] = index;
+    }
+
+    template <class K0>
+    constexpr void replace_key_at(const std::size_t slot, K0&& key)
+    {
+        memory::destroy_and_construct_at_address_of(keys()[slot], std::forward<K0>(key));
+    }
+
+    // Adds `child` right after the child at `slot`, with `key` between them
+    template <class K0>
+    constexpr void insert_child_after(const std::size_t slot, K0&& key, const NodeIndex child)
+    {
+        for (std::size_t i = child_count(); i > slot + 1; i--)
+        {
+            set_child_at(i, child_at(i - 1));
+        }
+        set_child_at(slot + 1, child);
+        keys().emplace(std::next(keys().cbegin(), static_cast<std::ptrdiff_t>(slot)),
+                       std::forward<K0>(key));
+    }
+    template <class K0>
+    constexpr void push_back_child(K0&& key, const NodeIndex child)
+    {
+        set_child_at(child_count(), child);
+        keys().emplace_back(std::forward<K0>(key));
+    }
+    template <class K0>
+    constexpr void push_front_child(const NodeIndex child, K0&& key)
+    {
+        for (std::size_t i = child_count(); i > 0; i--)
+        {
+            set_child_at(i, child_at(i - 1));
+        }
+        set_child_at(0, child);
+        keys().emplace(keys().cbegin(), std::forward<K0>(key));
+    }
+
+    // Removes the child after the one at `slot`, along with the key between them
+    constexpr void erase_child_after(const std::size_t slot)
+    {
+        for (std::size_t i = slot + 1; i + 1 < child_count(); i++)
+        {
+            set_child_at(i, child_at(i + 1));
+        }
+        keys().erase(std::next(keys().cbegin(), static_cast<std::ptrdiff_t>(slot)));
+    }
+    constexpr void erase_front_child()
+    {
+        for (std::size_t i = 0; i + 1 < child_count(); i++)
+        {
+            set_child_at(i, child_at(i + 1));
+        }
+        keys().erase(keys().cbegin());
+    }
+
+    // Moves the keys after `slot`, and the children after them, to the back of `other`
+    constexpr void move_back_children_to(const std::size_t slot, FixedBTreeInnerNode& other)
+    {
+        for (std::size_t i = slot + 1; i < keys().size(); i++)
+        {
+            other.push_back_child(std::move(keys()[i]), child_at(i + 1));
+        }
+        keys().erase(std::next(keys().cbegin(), static_cast<std::ptrdiff_t>(slot + 1)),
+                     keys().cend());
+    }
+};
+
+/**
+ * B+-tree with fixed-capacity pools of leaves and inner nodes. The leaves are linked in key order
+ * and pack copies of their keys together, so that a lookup reads a few contiguous arrays instead of
+ * one node per comparison. Nodes are referenced by index, and are at least half full, except for
+ * the root. The pools are sized for that worst case.
+ *
+ * The entries themselves are in a pool of `MAXIMUM_SIZE`, and the leaves only refer to them by
+ * index. Splitting, merging or rebalancing the leaves moves those indices around, but the entries
+ * stay where they are until erased, so their indices can serve as stable iterator positions.
+ */
+template <class K, class V, std::size_t MAXIMUM_SIZE, class Compare, std::size_t KEYS_PER_NODE>
+class FixedBTreeBase
+{
+    static_assert(KEYS_PER_NODE >= 2, "Nodes must split in two non-empty halves");
+    static_assert(std::copy_constructible<K>, "The nodes hold copies of keys");
+
+public:
+    static constexpr bool HAS_ASSOCIATED_VALUE = !IsEmpty<V>;
+    // Every leaf and inner node other than the root holds this many keys at least
+    static constexpr std::size_t MIN_KEY_COUNT = KEYS_PER_NODE / 2;
+    static constexpr std::size_t LEAF_COUNT =
+        MAXIMUM_SIZE <= KEYS_PER_NODE ? 1 : MAXIMUM_SIZE / MIN_KEY_COUNT;
+    static constexpr InnerNodeBounds INNER_NODE_BOUNDS =
+        inner_node_bounds(LEAF_COUNT, MIN_KEY_COUNT + 1);
+    static constexpr std::size_t INNER_NODE_COUNT = INNER_NODE_BOUNDS.node_count;
+    static constexpr std::size_t MAXIMUM_HEIGHT = INNER_NODE_BOUNDS.level_count;
+
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    // There are never more inner nodes than leaves
+    using NodeIndex = index_width::SmallestIndexType<LEAF_COUNT>;
+    static constexpr NodeIndex NULL_INDEX = (std::numeric_limits<NodeIndex>::max)();
+    using EntryIndex = index_width::SmallestIndexType<MAXIMUM_SIZE>;
+    // Also the position of the end of the tree
+    static constexpr EntryIndex NULL_ENTRY_INDEX = (std::numeric_limits<EntryIndex>::max)();
+    using Entry = FixedBTreeEntry<K, V, NodeIndex>;
+    using Leaf = FixedBTreeLeaf<K, KEYS_PER_NODE, NodeIndex, EntryIndex>;
+    using InnerNode = FixedBTreeInnerNode<K, KEYS_PER_NODE, NodeIndex>;
+
+    // The inner nodes from the root down to a leaf, with the slot of the child taken in each
+    struct PathEntry
+    {
+        NodeIndex node;
+        std::size_t child_slot;
+    };
+    using Path = std::array<PathEntry, MAXIMUM_HEIGHT>;
+
+    // Where a key is, or would go in `leaf` at `slot` if `entry_index` is `NULL_ENTRY_INDEX`.
+    // `slot` may be one past the last entry of the leaf.
+    struct InsertionPoint
+    {
+        Path path;
+        NodeIndex leaf;
+        std::size_t slot;
+        EntryIndex entry_index;
+    };
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    FixedIndexBasedPoolStorage<Entry, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_;
+    std::array<Leaf, LEAF_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_leaves_;
+    std::array<InnerNode, INNER_NODE_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_inner_nodes_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    // Number of inner levels above the leaves
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_height_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_index_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_index_;
+    // Nodes are handed out from the free list first, then from the untouched end of the pool
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_free_leaf_index_;
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_free_inner_node_index_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_used_leaf_count_;
+    std::size_t IMPLEMENTATION_DETAIL_DO_NOT_USE_used_inner_node_count_;
+
+public:
+    constexpr FixedBTreeBase() noexcept
+      : FixedBTreeBase{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedBTreeBase(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_leaves_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_inner_nodes_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_height_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_index_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_index_{0}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_free_leaf_index_{NULL_INDEX}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_free_inner_node_index_{NULL_INDEX}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_used_leaf_count_{1}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_used_inner_node_count_{0}
+    {
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    }
+    [[nodiscard]] constexpr bool empty() const { return size() == 0; }
+    [[nodiscard]] constexpr bool full() const { return size() >= MAXIMUM_SIZE; }
+    [[nodiscard]] constexpr std::size_t height() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_height_;
+    }
+    [[nodiscard]] constexpr const Compare& comparator() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+    }
+
+    constexpr void clear()
+    {
+        for (std::size_t i = 0; i < IMPLEMENTATION_DETAIL_DO_NOT_USE_used_leaf_count_; i++)
+        {
+            Leaf& leaf = leaf_at(static_cast<NodeIndex>(i));
+            for (std::size_t slot = 0; slot < leaf.size(); slot++)
+            {
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_.delete_at_and_return_repositioned_index(
+                    leaf.entry_index_at(slot));
+            }
+            leaf.keys().clear();
+        }
+        for (std::size_t i = 0; i < IMPLEMENTATION_DETAIL_DO_NOT_USE_used_inner_node_count_; i++)
+        {
+            inner_node_at(static_cast<NodeIndex>(i)).keys().clear();
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = 0;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_height_ = 0;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ = 0;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_index_ = 0;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_index_ = 0;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_free_leaf_index_ = NULL_INDEX;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_free_inner_node_index_ = NULL_INDEX;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_used_leaf_count_ = 1;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_used_inner_node_count_ = 0;
+        leaf_at(0).set_previous_index(NULL_INDEX);
+        leaf_at(0).set_next_index(NULL_INDEX);
+    }
+
+    [[nodiscard]] constexpr const K& key_at(const EntryIndex entry_index) const
+    {
+        return entry_at(entry_index).key();
+    }
+    [[nodiscard]] constexpr const V& value_at(const EntryIndex entry_index) const
+        requires HAS_ASSOCIATED_VALUE
+    {
+        return entry_at(entry_index).value();
+    }
+    constexpr V& value_at(const EntryIndex entry_index)
+        requires HAS_ASSOCIATED_VALUE
+    {
+        return entry_at(entry_index).value();
+    }
+
+    [[nodiscard]] constexpr EntryIndex index_of_first_entry() const
+    {
+        return entry_index_at_or_next(IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_index_, 0);
+    }
+
+    // The entries and `NULL_ENTRY_INDEX` form a cycle: the next entry of `NULL_ENTRY_INDEX` is the
+    // first one, and that of the last entry is `NULL_ENTRY_INDEX`. Likewise the other way around.
+    [[nodiscard]] constexpr EntryIndex index_of_next_entry(const EntryIndex entry_index) const
+    {
+        if (entry_index == NULL_ENTRY_INDEX)
+        {
+            return index_of_first_entry();
+        }
+        const NodeIndex leaf_index = entry_at(entry_index).leaf_index();
+        return entry_index_at_or_next(leaf_index, leaf_at(leaf_index).slot_of(entry_index) + 1);
+    }
+
+    [[nodiscard]] constexpr EntryIndex index_of_previous_entry(const EntryIndex entry_index) const
+    {
+        NodeIndex leaf_index = IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_index_;
+        std::size_t slot = leaf_at(leaf_index).size();
+        if (entry_index != NULL_ENTRY_INDEX)
+        {
+            leaf_index = entry_at(entry_index).leaf_index();
+            slot = leaf_at(leaf_index).slot_of(entry_index);
+        }
+        if (slot > 0)
+        {
+            return leaf_at(leaf_index).entry_index_at(slot - 1);
+        }
+        // Only the root leaf may be empty, and it has no neighbours
+        const NodeIndex previous = leaf_at(leaf_index).previous_index();
+        if (previous == NULL_INDEX)
+        {
+            return NULL_ENTRY_INDEX;
+        }
+        const Leaf& previous_leaf = leaf_at(previous);
+        return previous_leaf.entry_index_at(previous_leaf.size() - 1);
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr EntryIndex index_of_entry(const K0& key) const
+    {
+        const Leaf& leaf = leaf_at(index_of_leaf_for(key));
+        const std::size_t slot = index_of_first_key_not_less(leaf.keys(), key);
+        if (slot < leaf.size() && !comparator()(key, leaf.keys()[slot]))
+        {
+            return leaf.entry_index_at(slot);
+        }
+        return NULL_ENTRY_INDEX;
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr EntryIndex index_of_entry_not_less(const K0& key) const
+    {
+        const NodeIndex leaf_index = index_of_leaf_for(key);
+        return entry_index_at_or_next(
+            leaf_index, index_of_first_key_not_less(leaf_at(leaf_index).keys(), key));
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr EntryIndex index_of_entry_greater(const K0& key) const
+    {
+        const NodeIndex leaf_index = index_of_leaf_for(key);
+        return entry_index_at_or_next(
+            leaf_index, index_of_first_key_greater(leaf_at(leaf_index).keys(), key));
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr InsertionPoint insertion_point_for(const K0& key) const
+    {
+        InsertionPoint out{};
+        out.leaf = index_of_leaf_for(key, out.path);
+        const Leaf& leaf = leaf_at(out.leaf);
+        out.slot = index_of_first_key_not_less(leaf.keys(), key);
+        out.entry_index = out.slot < leaf.size() && !comparator()(key, leaf.keys()[out.slot])
+                              ? leaf.entry_index_at(out.slot)
+                              : NULL_ENTRY_INDEX;
+        return out;
+    }
+
+    // Inserts an entry at `point`, which must not have one, and returns its index
+    template <class K0, class... Args>
+    constexpr EntryIndex insert_new_at(const InsertionPoint& point, K0&& key, Args&&... args)
+    {
+        assert_or_abort(!full());
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_++;
+        const auto entry_index = static_cast<EntryIndex>(
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_.emplace_and_return_index(
+                point.leaf, std::forward<K0>(key), std::forward<Args>(args)...));
+        // Without inner nodes, the single leaf has room for all the entries
+        if constexpr (INNER_NODE_COUNT > 0)
+        {
+            if (leaf_at(point.leaf).size() == KEYS_PER_NODE)
+            {
+                split_leaf_and_insert_at(point, entry_index);
+                return entry_index;
+            }
+        }
+        leaf_at(point.leaf).insert_at(point.slot, key_at(entry_index), entry_index);
+        return entry_index;
+    }
+
+    // Erases the entry at `entry_index` and returns the index of the entry that followed it
+    constexpr EntryIndex erase_at(const EntryIndex entry_index)
+    {
+        const EntryIndex next_entry_index = index_of_next_entry(entry_index);
+        const NodeIndex leaf_index = entry_at(entry_index).leaf_index();
+        Leaf& leaf = leaf_at(leaf_index);
+        const std::size_t slot = leaf.slot_of(entry_index);
+        // Without inner nodes, the single leaf is the root, which may hold any number of entries.
+        // Otherwise, only a leaf left with too few entries needs the path down to it.
+        [[maybe_unused]] const bool needs_refill = height() > 0 && leaf.size() <= MIN_KEY_COUNT;
+        [[maybe_unused]] Path path{};
+        if constexpr (INNER_NODE_COUNT > 0)
+        {
+            if (needs_refill)
+            {
+                [[maybe_unused]] const NodeIndex found_leaf_index =
+                    index_of_leaf_for(leaf.keys()[slot], path);
+                assert_or_abort(found_leaf_index == leaf_index);
+            }
+        }
+
+        leaf.erase_at(slot);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_.delete_at_and_return_repositioned_index(
+            entry_index);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_--;
+        if constexpr (INNER_NODE_COUNT > 0)
+        {
+            if (needs_refill)
+            {
+                refill_leaf(path, leaf_index);
+            }
+        }
+        return next_entry_index;
+    }
+
+protected:  // [WORKAROUND-1]
+    constexpr Entry& entry_at(const EntryIndex index)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_.at(index);
+    }
+    [[nodiscard]] constexpr const Entry& entry_at(const EntryIndex index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_.at(index);
+    }
+    constexpr Leaf& leaf_at(const NodeIndex index)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_leaves_[index];
+    }
+    [[nodiscard]] constexpr const Leaf& leaf_at(const NodeIndex index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_leaves_[index];
+    }
+    constexpr InnerNode& inner_node_at(const NodeIndex index)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_inner_nodes_[index];
+    }
+    [[nodiscard]] constexpr const InnerNode& inner_node_at(const NodeIndex index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_inner_nodes_[index];
+    }
+
+private:
+    // The full leaf of `point` and the new entry are split in two, with the extra entry on the
+    // left
+    constexpr void split_leaf_and_insert_at(const InsertionPoint& point,
+                                            const EntryIndex entry_index)
+    {
+        const NodeIndex leaf_index = point.leaf;
+        const std::size_t slot = point.slot;
+        constexpr std::size_t LEFT_SIZE = (KEYS_PER_NODE + 2) / 2;
+        const NodeIndex new_leaf_index = allocate_leaf();
+        link_leaf_after(leaf_index, new_leaf_index);
+        if (slot < LEFT_SIZE)
+        {
+            move_back_entries_to(leaf_index, LEFT_SIZE - 1, new_leaf_index);
+            leaf_at(leaf_index).insert_at(slot, key_at(entry_index), entry_index);
+        }
+        else
+        {
+            move_back_entries_to(leaf_index, LEFT_SIZE, new_leaf_index);
+            leaf_at(new_leaf_index).insert_at(slot - LEFT_SIZE, key_at(entry_index), entry_index);
+            entry_at(entry_index).set_leaf_index(new_leaf_index);
+        }
+        insert_in_parents(point.path, leaf_at(new_leaf_index).keys().front(), new_leaf_index);
+    }
+
+    // The leaf at `leaf_index` lost an entry and has too few left. Takes an entry from a sibling
+    // that has some to spare, or else merges with it.
+    constexpr void refill_leaf(const Path& path, const NodeIndex leaf_index)
+    {
+        Leaf& leaf = leaf_at(leaf_index);
+        const PathEntry& parent_entry = path[height() - 1];
+        InnerNode& parent = inner_node_at(parent_entry.node);
+        const std::size_t child_slot = parent_entry.child_slot;
+        if (child_slot + 1 < parent.child_count())
+        {
+            const NodeIndex right_index = parent.child_at(child_slot + 1);
+            Leaf& right = leaf_at(right_index);
+            if (right.size() > MIN_KEY_COUNT)
+            {
+                move_entry_to(right_index, 0, leaf_index, leaf.size());
+                parent.replace_key_at(child_slot, right.keys().front());
+                return;
+            }
+            move_back_entries_to(right_index, 0, leaf_index);
+            unlink_leaf(right_index);
+            free_leaf(right_index);
+            parent.erase_child_after(child_slot);
+            rebalance_inner_nodes(path);
+            return;
+        }
+
+        const NodeIndex left_index = parent.child_at(child_slot - 1);
+        Leaf& left = leaf_at(left_index);
+        if (left.size() > MIN_KEY_COUNT)
+        {
+            move_entry_to(left_index, left.size() - 1, leaf_index, 0);
+            parent.replace_key_at(child_slot - 1, leaf.keys().front());
+            return;
+        }
+        move_back_entries_to(leaf_index, 0, left_index);
+        unlink_leaf(leaf_index);
+        free_leaf(leaf_index);
+        parent.erase_child_after(child_slot - 1);
+        rebalance_inner_nodes(path);
+    }
+
+    // Binary search with as many steps as the capacity of the node needs, whatever its size. The
+    // fixed steps let the compiler unroll them, and the branch predictor speculate the descent
+    // into the next node. Returns the length of the prefix of keys that satisfy `goes_before`.
+    template <class Keys, class Predicate>
+    [[nodiscard]] static constexpr std::size_t count_keys_before(const Keys& keys,
+                                                                 const Predicate& goes_before)
+    {
+        const std::size_t key_count = keys.size();
+        const K* const data = keys.data();
+        std::size_t count = 0;
+        for (std::size_t step = std::bit_floor(Keys::static_max_size()); step > 0; step /= 2)
+        {
+            const std::size_t candidate = count + step;
+            if (candidate <= key_count && goes_before(data[candidate - 1]))
+            {
+                count = candidate;
+            }
+        }
+        return count;
+    }
+
+    template <class Keys, class K0>
+    [[nodiscard]] constexpr std::size_t index_of_first_key_not_less(const Keys& keys,
+                                                                    const K0& key) const
+    {
+        return count_keys_before(keys,
+                                 [&](const K& node_key) { return comparator()(node_key, key); });
+    }
+
+    template <class Keys, class K0>
+    [[nodiscard]] constexpr std::size_t index_of_first_key_greater(const Keys& keys,
+                                                                   const K0& key) const
+    {
+        return count_keys_before(keys,
+                                 [&](const K& node_key) { return !comparator()(key, node_key); });
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndex index_of_leaf_for(const K0& key) const
+    {
+        NodeIndex node_index = IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
+        if constexpr (INNER_NODE_COUNT > 0)
+        {
+            for (std::size_t level = 0; level < height(); level++)
+            {
+                const InnerNode& node = inner_node_at(node_index);
+                node_index = node.child_at(index_of_first_key_greater(node.keys(), key));
+            }
+        }
+        return node_index;
+    }
+    template <class K0>
+    constexpr NodeIndex index_of_leaf_for(const K0& key, Path& path) const
+    {
+        NodeIndex node_index = IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
+        if constexpr (INNER_NODE_COUNT > 0)
+        {
+            for (std::size_t level = 0; level < height(); level++)
+            {
+                const InnerNode& node = inner_node_at(node_index);
+                const std::size_t child_slot = index_of_first_key_greater(node.keys(), key);
+                path[level] = {node_index, child_slot};
+                node_index = node.child_at(child_slot);
+            }
+        }
+        return node_index;
+    }
+
+    [[nodiscard]] constexpr EntryIndex entry_index_at_or_next(const NodeIndex leaf_index,
+                                                              const std::size_t slot) const
+    {
+        const Leaf& leaf = leaf_at(leaf_index);
+        if (slot < leaf.size())
+        {
+            return leaf.entry_index_at(slot);
+        }
+        // Only the root leaf may be empty, and it has no neighbours
+        if (leaf.next_index() == NULL_INDEX)
+        {
+            return NULL_ENTRY_INDEX;
+        }
+        return leaf_at(leaf.next_index()).entry_index_at(0);
+    }
+
+    constexpr void move_entry_to(const NodeIndex from_index,
+                                 const std::size_t from_slot,
+                                 const NodeIndex to_index,
+                                 const std::size_t to_slot)
+    {
+        Leaf& from = leaf_at(from_index);
+        const EntryIndex entry_index = from.entry_index_at(from_slot);
+        leaf_at(to_index).insert_at(to_slot, std::move(from.keys()[from_slot]), entry_index);
+        from.erase_at(from_slot);
+        entry_at(entry_index).set_leaf_index(to_index);
+    }
+
+    // Moves the entries of leaf `from_index` starting at `first_slot` to the back of `to_index`
+    constexpr void move_back_entries_to(const NodeIndex from_index,
+                                        const std::size_t first_slot,
+                                        const NodeIndex to_index)
+    {
+        Leaf& from = leaf_at(from_index);
+        Leaf& to = leaf_at(to_index);
+        for (std::size_t i = first_slot; i < from.size(); i++)
+        {
+            const EntryIndex entry_index = from.entry_index_at(i);
+            to.push_back(std::move(from.keys()[i]), entry_index);
+            entry_at(entry_index).set_leaf_index(to_index);
+        }
+        from.erase_from(first_slot);
+    }
+
+    // Adds `new_child` right after the last child of `path` and a copy of `separator` before it,
+    // splitting the full nodes on the way up.
+    constexpr void insert_in_parents(const Path& path, const K& separator, NodeIndex new_child)
+    {
+        // Holds the key that moves up a level, without requiring K to be assignable
+        FixedVector<K, 1> key_for_parent{};
+        key_for_parent.push_back(separator);
+        for (std::size_t level = height(); level > 0; level--)
+        {
+            const PathEntry& entry = path[level - 1];
+            InnerNode& node = inner_node_at(entry.node);
+            node.insert_child_after(entry.child_slot, std::move(key_for_parent.back()), new_child);
+            key_for_parent.clear();
+            if (node.keys().size() <= KEYS_PER_NODE)
+            {
+                return;
+            }
+
+            // The middle key of the overfull node moves up, and the keys after it to a new node
+            constexpr std::size_t LEFT_KEY_COUNT = (KEYS_PER_NODE + 1) / 2;
+            const NodeIndex new_node_index = allocate_inner_node();
+            InnerNode& new_node = inner_node_at(new_node_index);
+            new_node.set_child_at(0, node.child_at(LEFT_KEY_COUNT + 1));
+            node.move_back_children_to(LEFT_KEY_COUNT, new_node);
+            key_for_parent.push_back(std::move(node.keys().back()));
+            node.keys().pop_back();
+            new_child = new_node_index;
+        }
+
+        const NodeIndex new_root_index = allocate_inner_node();
+        InnerNode& new_root = inner_node_at(new_root_index);
+        new_root.set_child_at(0, IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_);
+        new_root.push_back_child(std::move(key_for_parent.back()), new_child);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ = new_root_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_height_++;
+    }
+
+    // The deepest inner node of `path` lost a child. Refills the nodes that are left with too few,
+    // from a sibling if it has keys to spare, or else by merging with it, which takes a child from
+    // the parent in turn.
+    constexpr void rebalance_inner_nodes(const Path& path)
+    {
+        for (std::size_t level = height() - 1;; level--)
+        {
+            const NodeIndex node_index = path[level].node;
+            InnerNode& node = inner_node_at(node_index);
+            if (level == 0)
+            {
+                if (node.keys().empty())
+                {
+                    IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ = node.child_at(0);
+                    free_inner_node(node_index);
+                    IMPLEMENTATION_DETAIL_DO_NOT_USE_height_--;
+                }
+                return;
+            }
+            if (node.keys().size() >= MIN_KEY_COUNT)
+            {
+                return;
+            }
+
+            InnerNode& parent = inner_node_at(path[level - 1].node);
+            const std::size_t child_slot = path[level - 1].child_slot;
+            if (child_slot + 1 < parent.child_count())
+            {
+                const NodeIndex right_index = parent.child_at(child_slot + 1);
+                InnerNode& right = inner_node_at(right_index);
+                node.push_back_child(std::move(parent.keys()[child_slot]), right.child_at(0));
+                if (right.keys().size() > MIN_KEY_COUNT)
+                {
+                    parent.replace_key_at(child_slot, std::move(right.keys().front()));
+                    right.erase_front_child();
+                    return;
+                }
+                for (std::size_t i = 0; i < right.keys().size(); i++)
+                {
+                    node.push_back_child(std::move(right.keys()[i]), right.child_at(i + 1));
+                }
+                right.keys().clear();
+                free_inner_node(right_index);
+                parent.erase_child_after(child_slot);
+                continue;
+            }
+
+            const NodeIndex left_index = parent.child_at(child_slot - 1);
+            InnerNode& left = inner_node_at(left_index);
+            if (left.keys().size() > MIN_KEY_COUNT)
+            {
+                node.push_front_child(left.child_at(left.keys().size()),
+                                      std::move(parent.keys()[child_slot - 1]));
+                parent.replace_key_at(child_slot - 1, std::move(left.keys().back()));
+                left.keys().pop_back();
+                return;
+            }
+            left.push_back_child(std::move(parent.keys()[child_slot - 1]), node.child_at(0));
+            for (std::size_t i = 0; i < node.keys().size(); i++)
+            {
+                left.push_back_child(std::move(node.keys()[i]), node.child_at(i + 1));
+            }
+            node.keys().clear();
+            free_inner_node(node_index);
+            parent.erase_child_after(child_slot - 1);
+        }
+    }
+
+    constexpr NodeIndex allocate_leaf()
+    {
+        NodeIndex& free_index = IMPLEMENTATION_DETAIL_DO_NOT_USE_free_leaf_index_;
+        if (free_index != NULL_INDEX)
+        {
+            const NodeIndex index = free_index;
+            free_index = leaf_at(index).next_index();
+            return index;
+        }
+        assert_or_abort(IMPLEMENTATION_DETAIL_DO_NOT_USE_used_leaf_count_ < LEAF_COUNT);
+        return static_cast<NodeIndex>(IMPLEMENTATION_DETAIL_DO_NOT_USE_used_leaf_count_++);
+    }
+    constexpr void free_leaf(const NodeIndex index)
+    {
+        leaf_at(index).set_previous_index(NULL_INDEX);
+        leaf_at(index).set_next_index(IMPLEMENTATION_DETAIL_DO_NOT_USE_free_leaf_index_);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_free_leaf_index_ = index;
+    }
+
+    // The free inner nodes are chained through their first child
+    constexpr NodeIndex allocate_inner_node()
+    {
+        NodeIndex& free_index = IMPLEMENTATION_DETAIL_DO_NOT_USE_free_inner_node_index_;
+        if (free_index != NULL_INDEX)
+        {
+            const NodeIndex index = free_index;
+            free_index = inner_node_at(index).child_at(0);
+            return index;
+        }
+        assert_or_abort(IMPLEMENTATION_DETAIL_DO_NOT_USE_used_inner_node_count_ <
+                        INNER_NODE_COUNT);
+        return static_cast<NodeIndex>(IMPLEMENTATION_DETAIL_DO_NOT_USE_used_inner_node_count_++);
+    }
+    constexpr void free_inner_node(const NodeIndex index)
+    {
+        inner_node_at(index).set_child_at(0,
+                                          IMPLEMENTATION_DETAIL_DO_NOT_USE_free_inner_node_index_);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_free_inner_node_index_ = index;
+    }
+
+    constexpr void link_leaf_after(const NodeIndex index, const NodeIndex new_index)
+    {
+        Leaf& leaf = leaf_at(index);
+        Leaf& new_leaf = leaf_at(new_index);
+        new_leaf.set_previous_index(index);
+        new_leaf.set_next_index(leaf.next_index());
+        if (leaf.next_index() == NULL_INDEX)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_index_ = new_index;
+        }
+        else
+        {
+            leaf_at(leaf.next_index()).set_previous_index(new_index);
+        }
+        leaf.set_next_index(new_index);
+    }
+    constexpr void unlink_leaf(const NodeIndex index)
+    {
+        const Leaf& leaf = leaf_at(index);
+        if (leaf.previous_index() == NULL_INDEX)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_index_ = leaf.next_index();
+        }
+        else
+        {
+            leaf_at(leaf.previous_index()).set_next_index(leaf.next_index());
+        }
+        if (leaf.next_index() == NULL_INDEX)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_index_ = leaf.previous_index();
+        }
+        else
+        {
+            leaf_at(leaf.next_index()).set_previous_index(leaf.previous_index());
+        }
+    }
+};
+
+}  // namespace fixed_containers::fixed_btree_detail
+
+namespace fixed_containers::fixed_btree_detail::specializations
+{
+template <class K, class V, std::size_t MAXIMUM_SIZE, class Compare, std::size_t KEYS_PER_NODE>
+class FixedBTree
+  : public fixed_btree_detail::FixedBTreeBase<K, V, MAXIMUM_SIZE, Compare, KEYS_PER_NODE>
+{
+    using Base = fixed_btree_detail::FixedBTreeBase<K, V, MAXIMUM_SIZE, Compare, KEYS_PER_NODE>;
+
+public:
+    // clang-format off
+    constexpr FixedBTree() noexcept : Base() { }
+    explicit constexpr FixedBTree(const Compare& comparator) noexcept : Base(comparator) { }
+    // clang-format on
+
+    constexpr FixedBTree(const FixedBTree& other)
+        requires TriviallyCopyConstructible<K> && TriviallyCopyConstructible<V>
+    = default;
+    constexpr FixedBTree(FixedBTree&& other) noexcept
+        requires TriviallyMoveConstructible<K> && TriviallyMoveConstructible<V>
+    = default;
+    constexpr FixedBTree& operator=(const FixedBTree& other)
+        requires TriviallyCopyAssignable<K> && TriviallyCopyAssignable<V>
+    = default;
+    constexpr FixedBTree& operator=(FixedBTree&& other) noexcept
+        requires TriviallyMoveAssignable<K> && TriviallyMoveAssignable<V>
+    = default;
+
+    constexpr FixedBTree(const FixedBTree& other)
+      : FixedBTree(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_)
+    {
+        clone_impl(other);
+    }
+    constexpr FixedBTree(FixedBTree&& other) noexcept
+      : FixedBTree(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_)
+    {
+        clone_impl(other);
+        // Clear the moved-out-of-tree, as the red-black tree does
+        other.clear();
+    }
+    constexpr FixedBTree& operator=(const FixedBTree& other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+        clone_impl(other);
+        return *this;
+    }
+    constexpr FixedBTree& operator=(FixedBTree&& other) noexcept
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        this->clear();
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+        clone_impl(other);
+        return *this;
+    }
+
+    constexpr ~FixedBTree() noexcept { this->clear(); }
+
+private:
+    // Warning: assumes the destination (`this`) is already clear of any values!
+    // Every node and entry goes to the same index, so the keys and values are copied (or moved,
+    // for a non-const `other`) and no key is compared.
+    template <class OtherTree>
+    constexpr void clone_impl(OtherTree& other)
+    {
+        const auto clone_of = [](auto& value) -> decltype(auto)
+        {
+            if constexpr (std::is_const_v<OtherTree>)
+            {
+                return std::as_const(value);
+            }
+            else
+            {
+                return std::move(value);
+            }
+        };
+
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_.set_freelist_state_from_other(
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_);
+        for (std::size_t i = 0; i < other.IMPLEMENTATION_DETAIL_DO_NOT_USE_used_leaf_count_; i++)
+        {
+            const auto leaf_index = static_cast<typename Base::NodeIndex>(i);
+            typename Base::Leaf& leaf = this->leaf_at(leaf_index);
+            auto& other_leaf = other.leaf_at(leaf_index);
+            for (std::size_t slot = 0; slot < other_leaf.size(); slot++)
+            {
+                const auto entry_index = other_leaf.entry_index_at(slot);
+                leaf.push_back(clone_of(other_leaf.keys()[slot]), entry_index);
+                std::construct_at(&this->entry_at(entry_index),
+                                  clone_of(other.entry_at(entry_index)));
+            }
+            leaf.set_previous_index(other_leaf.previous_index());
+            leaf.set_next_index(other_leaf.next_index());
+        }
+        for (std::size_t i = 0; i < other.IMPLEMENTATION_DETAIL_DO_NOT_USE_used_inner_node_count_;
+             i++)
+        {
+            const auto node_index = static_cast<typename Base::NodeIndex>(i);
+            typename Base::InnerNode& node = this->inner_node_at(node_index);
+            auto& other_node = other.inner_node_at(node_index);
+            for (auto& key : other_node.keys())
+            {
+                node.keys().push_back(clone_of(key));
+            }
+            node.IMPLEMENTATION_DETAIL_DO_NOT_USE_children_ =
+                other_node.IMPLEMENTATION_DETAIL_DO_NOT_USE_children_;
+        }
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = other.IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_height_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_height_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_index_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_first_leaf_index_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_index_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_last_leaf_index_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_free_leaf_index_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_free_leaf_index_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_free_inner_node_index_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_free_inner_node_index_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_used_leaf_count_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_used_leaf_count_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_used_inner_node_count_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_used_inner_node_count_;
+    }
+};
+
+template <TriviallyCopyable K,
+          TriviallyCopyable V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t KEYS_PER_NODE>
+class FixedBTree<K, V, MAXIMUM_SIZE, Compare, KEYS_PER_NODE>
+  : public fixed_btree_detail::FixedBTreeBase<K, V, MAXIMUM_SIZE, Compare, KEYS_PER_NODE>
+{
+    using Base = fixed_btree_detail::FixedBTreeBase<K, V, MAXIMUM_SIZE, Compare, KEYS_PER_NODE>;
+
+public:
+    // clang-format off
+    constexpr FixedBTree() noexcept : Base() { }
+    explicit constexpr FixedBTree(const Compare& comparator) noexcept : Base(comparator) { }
+    // clang-format on
+};
+
+}  // namespace fixed_containers::fixed_btree_detail::specializations
+
+namespace fixed_containers::fixed_btree_detail
+{
+// [WORKAROUND-1] due to destructors: manually do the split with template specialization.
+// See FixedVector which uses the same workaround for more details.
+template <class K, class V, std::size_t MAXIMUM_SIZE, class Compare, std::size_t KEYS_PER_NODE>
+using FixedBTree = specializations::FixedBTree<K, V, MAXIMUM_SIZE, Compare, KEYS_PER_NODE>;
+
+}  // namespace fixed_containers::fixed_btree_detail
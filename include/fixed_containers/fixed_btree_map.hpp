@@ -0,0 +1,678 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/emplace.hpp"
+#include "fixed_containers/erase_if.hpp"
+#include "fixed_containers/fixed_btree.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity B+-tree map with maximum size that is declared at compile-time via template
+ * parameter. Same interface as `FixedMap`, without node handles or the tree-specific operations.
+ * Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K, V
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ *
+ * The leaves of the tree hold up to `KEYS_PER_NODE` keys packed together, each with the index of
+ * its entry, so a lookup reads a few contiguous arrays of keys and then one entry, where `FixedMap`
+ * reads a node with its value for every comparison. The entries are in a pool of `MAXIMUM_SIZE`,
+ * like the nodes of `FixedMap`. The keys must be copyable, as the nodes hold copies of them.
+ *
+ * Iterator invalidation: as with `FixedMap` and `std::map`, only the iterators and references to
+ * an erased entry are invalidated.
+ */
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          std::size_t KEYS_PER_NODE = fixed_btree_detail::default_keys_per_node<K>(),
+          customize::MapChecking<K> CheckingType =
+              customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedBTreeMap
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using reference = std::pair<const K&, V&>;
+    using const_reference = std::pair<const K&, const V&>;
+    using pointer = std::add_pointer_t<reference>;
+    using const_pointer = std::add_pointer_t<const_reference>;
+
+private:
+    using Tree = fixed_btree_detail::FixedBTree<K, V, MAXIMUM_SIZE, Compare, KEYS_PER_NODE>;
+    using EntryIndex = typename Tree::EntryIndex;
+    using InsertionPoint = typename Tree::InsertionPoint;
+
+    template <bool IS_CONST>
+    class PairProvider
+    {
+        friend class PairProvider<!IS_CONST>;
+        using ConstOrMutableTree = std::conditional_t<IS_CONST, const Tree, Tree>;
+
+    private:
+        ConstOrMutableTree* tree_;
+        EntryIndex entry_index_;
+
+    public:
+        constexpr PairProvider() noexcept
+          : PairProvider{nullptr, Tree::NULL_ENTRY_INDEX}
+        {
+        }
+
+        constexpr PairProvider(ConstOrMutableTree* const tree,
+                               const EntryIndex& entry_index) noexcept
+          : tree_{tree}
+          , entry_index_{entry_index}
+        {
+        }
+
+        constexpr PairProvider(const PairProvider&) = default;
+        constexpr PairProvider(PairProvider&&) noexcept = default;
+        constexpr PairProvider& operator=(const PairProvider&) = default;
+        constexpr PairProvider& operator=(PairProvider&&) noexcept = default;
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr PairProvider(const PairProvider<IS_CONST_2>& mutable_other) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : PairProvider{mutable_other.tree_, mutable_other.entry_index_}
+        {
+        }
+
+        constexpr void advance() noexcept
+        {
+            entry_index_ = tree_->index_of_next_entry(entry_index_);
+        }
+        constexpr void recede() noexcept
+        {
+            entry_index_ = tree_->index_of_previous_entry(entry_index_);
+        }
+
+        [[nodiscard]] constexpr std::conditional_t<IS_CONST, const_reference, reference> get()
+            const noexcept
+        {
+            return {tree_->key_at(entry_index_), tree_->value_at(entry_index_)};
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const PairProvider<IS_CONST2>& other) const noexcept
+        {
+            return tree_ == other.tree_ && entry_index_ == other.entry_index_;
+        }
+
+        [[nodiscard]] constexpr EntryIndex entry_index() const { return entry_index_; }
+    };
+
+    template <IteratorConstness CONSTNESS, IteratorDirection DIRECTION>
+    using Iterator =
+        BidirectionalIterator<PairProvider<true>, PairProvider<false>, CONSTNESS, DIRECTION>;
+
+public:
+    using const_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::FORWARD>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::FORWARD>;
+    using const_reverse_iterator =
+        Iterator<IteratorConstness::CONSTANT_ITERATOR, IteratorDirection::REVERSE>;
+    using reverse_iterator =
+        Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::REVERSE>;
+    using size_type = typename Tree::size_type;
+    using difference_type = typename Tree::difference_type;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Tree IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_;
+
+public:
+    constexpr FixedBTreeMap() noexcept
+      : FixedBTreeMap{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedBTreeMap(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedBTreeMap(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedBTreeMap{comparator}
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr FixedBTreeMap(std::initializer_list<value_type> list,
+                            const Compare& comparator = {},
+                            const std_transition::source_location& loc =
+                                std_transition::source_location::current()) noexcept
+      : FixedBTreeMap{comparator}
+    {
+        this->insert(list, loc);
+    }
+
+public:
+    [[nodiscard]] constexpr V& at(const K& key,
+                                  const std_transition::source_location& loc =
+                                      std_transition::source_location::current()) noexcept
+    {
+        const EntryIndex entry_index = tree().index_of_entry(key);
+        if (preconditions::test(entry_index != Tree::NULL_ENTRY_INDEX))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return tree().value_at(entry_index);
+    }
+    [[nodiscard]] constexpr const V& at(
+        const K& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        const EntryIndex entry_index = tree().index_of_entry(key);
+        if (preconditions::test(entry_index != Tree::NULL_ENTRY_INDEX))
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return tree().value_at(entry_index);
+    }
+
+    constexpr V& operator[](const K& key) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return tree().value_at(
+            try_emplace_impl(std_transition::source_location::current(), key).first);
+    }
+    constexpr V& operator[](K&& key) noexcept
+    {
+        // Cannot capture real source_location for operator[]
+        return tree().value_at(
+            try_emplace_impl(std_transition::source_location::current(), std::move(key)).first);
+    }
+
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(tree().index_of_first_entry());
+    }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return create_const_iterator(Tree::NULL_ENTRY_INDEX);
+    }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr iterator begin() noexcept { return create_iterator(tree().index_of_first_entry()); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr iterator end() noexcept { return create_iterator(Tree::NULL_ENTRY_INDEX); }
+
+    constexpr reverse_iterator rbegin() noexcept
+    {
+        return create_reverse_iterator(Tree::NULL_ENTRY_INDEX);
+    }
+    [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return create_const_reverse_iterator(Tree::NULL_ENTRY_INDEX);
+    }
+    constexpr reverse_iterator rend() noexcept
+    {
+        return create_reverse_iterator(tree().index_of_first_entry());
+    }
+    [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+    [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept
+    {
+        return create_const_reverse_iterator(tree().index_of_first_entry());
+    }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return tree().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return tree().empty(); }
+
+    constexpr void clear() noexcept { tree().clear(); }
+
+    constexpr std::pair<iterator, bool> insert(
+        const value_type& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return as_iterator_and_flag(try_emplace_impl(loc, value.first, value.second));
+    }
+    constexpr std::pair<iterator, bool> insert(
+        value_type&& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return as_iterator_and_flag(try_emplace_impl(loc, value.first, std::move(value.second)));
+    }
+
+    // The hinted overloads ignore the hint: a lookup from the root only reads a few nodes
+    constexpr iterator insert(const_iterator /*hint*/,
+                              const value_type& value,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        return insert(value, loc).first;
+    }
+    constexpr iterator insert(const_iterator /*hint*/,
+                              value_type&& value,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        return insert(std::move(value), loc).first;
+    }
+
+    template <InputIterator Input>
+    constexpr void insert(Input first,
+                          Input last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(
+        const K& key,
+        M&& obj,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign_impl(loc, key, std::forward<M>(obj));
+    }
+    template <class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(
+        K&& key,
+        M&& obj,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign_impl(loc, std::move(key), std::forward<M>(obj));
+    }
+    template <class M>
+    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+                                        const K& key,
+                                        M&& obj,
+                                        const std_transition::source_location& loc =
+                                            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign_impl(loc, key, std::forward<M>(obj)).first;
+    }
+    template <class M>
+    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+                                        K&& key,
+                                        M&& obj,
+                                        const std_transition::source_location& loc =
+                                            std_transition::source_location::current()) noexcept
+        requires std::is_assignable_v<mapped_type&, M&&>
+    {
+        return insert_or_assign_impl(loc, std::move(key), std::forward<M>(obj)).first;
+    }
+
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const K& key, Args&&... args) noexcept
+    {
+        return as_iterator_and_flag(try_emplace_impl(
+            std_transition::source_location::current(), key, std::forward<Args>(args)...));
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(K&& key, Args&&... args) noexcept
+    {
+        return as_iterator_and_flag(try_emplace_impl(std_transition::source_location::current(),
+                                                     std::move(key),
+                                                     std::forward<Args>(args)...));
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+                                                    const K& key,
+                                                    Args&&... args) noexcept
+    {
+        return try_emplace(key, std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+                                                    K&& key,
+                                                    Args&&... args) noexcept
+    {
+        return try_emplace(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template <class... Args>
+        requires(sizeof...(Args) >= 1 and sizeof...(Args) <= 3)
+    constexpr std::pair<iterator, bool> emplace(Args&&... args) noexcept
+    {
+        return emplace_detail::emplace_in_terms_of_try_emplace_impl(*this,
+                                                                    std::forward<Args>(args)...);
+    }
+    template <class... Args>
+        requires(sizeof...(Args) >= 1 and sizeof...(Args) <= 3)
+    constexpr std::pair<iterator, bool> emplace_hint(const_iterator /*hint*/,
+                                                     Args&&... args) noexcept
+    {
+        return emplace(std::forward<Args>(args)...);
+    }
+
+    constexpr iterator erase(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        return create_iterator(tree().erase_at(get_entry_index_from_iterator(pos)));
+    }
+    constexpr iterator erase(iterator pos) noexcept { return erase(const_iterator{pos}); }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        const EntryIndex last_entry_index = get_entry_index_from_iterator(last);
+        EntryIndex entry_index = get_entry_index_from_iterator(first);
+        while (entry_index != last_entry_index)
+        {
+            entry_index = tree().erase_at(entry_index);
+        }
+        return create_iterator(entry_index);
+    }
+
+    constexpr size_type erase(const K& key) noexcept { return erase_key_impl(key); }
+
+    template <class K0>
+    constexpr size_type erase(K0&& key) noexcept
+        requires(IsTransparent<Compare> and !std::is_convertible_v<K0 &&, iterator> and
+                 !std::is_convertible_v<K0 &&, const_iterator>)
+    {
+        return erase_key_impl(key);
+    }
+
+    [[nodiscard]] constexpr iterator find(const K& key) noexcept
+    {
+        return create_iterator(tree().index_of_entry(key));
+    }
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().index_of_entry(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator find(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_iterator(tree().index_of_entry(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().index_of_entry(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return tree().index_of_entry(key) != Tree::NULL_ENTRY_INDEX;
+    }
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return tree().index_of_entry(key) != Tree::NULL_ENTRY_INDEX;
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr iterator lower_bound(const K& key) noexcept
+    {
+        return create_iterator(tree().index_of_entry_not_less(key));
+    }
+    [[nodiscard]] constexpr const_iterator lower_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().index_of_entry_not_less(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator lower_bound(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_iterator(tree().index_of_entry_not_less(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator lower_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().index_of_entry_not_less(key));
+    }
+
+    [[nodiscard]] constexpr iterator upper_bound(const K& key) noexcept
+    {
+        return create_iterator(tree().index_of_entry_greater(key));
+    }
+    [[nodiscard]] constexpr const_iterator upper_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().index_of_entry_greater(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator upper_bound(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_iterator(tree().index_of_entry_greater(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator upper_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().index_of_entry_greater(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range(const K& key) noexcept
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Compare2,
+              std::size_t KEYS_PER_NODE_2,
+              customize::MapChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedBTreeMap<K, V, MAXIMUM_SIZE_2, Compare2, KEYS_PER_NODE_2, CheckingType2>& other)
+        const
+    {
+        if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2 && KEYS_PER_NODE == KEYS_PER_NODE_2)
+        {
+            if (this == &other)
+            {
+                return true;
+            }
+        }
+
+        return std::ranges::equal(*this, other);
+    }
+
+private:
+    constexpr Tree& tree() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
+    [[nodiscard]] constexpr const Tree& tree() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_;
+    }
+
+    constexpr iterator create_iterator(const EntryIndex& entry_index) noexcept
+    {
+        return iterator{PairProvider<false>{std::addressof(tree()), entry_index}};
+    }
+
+    [[nodiscard]] constexpr const_iterator create_const_iterator(
+        const EntryIndex& entry_index) const noexcept
+    {
+        return const_iterator{PairProvider<true>{std::addressof(tree()), entry_index}};
+    }
+
+    constexpr reverse_iterator create_reverse_iterator(const EntryIndex& entry_index) noexcept
+    {
+        return reverse_iterator{PairProvider<false>{std::addressof(tree()), entry_index}};
+    }
+
+    [[nodiscard]] constexpr const_reverse_iterator create_const_reverse_iterator(
+        const EntryIndex& entry_index) const noexcept
+    {
+        return const_reverse_iterator{PairProvider<true>{std::addressof(tree()), entry_index}};
+    }
+
+    [[nodiscard]] constexpr EntryIndex get_entry_index_from_iterator(const_iterator pos) const
+    {
+        return pos.template private_reference_provider<PairProvider<true>>().entry_index();
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!tree().full()))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+
+    constexpr std::pair<iterator, bool> as_iterator_and_flag(
+        const std::pair<EntryIndex, bool>& entry_index_and_flag) noexcept
+    {
+        return {create_iterator(entry_index_and_flag.first), entry_index_and_flag.second};
+    }
+
+    template <class K0, class... Args>
+    constexpr std::pair<EntryIndex, bool> try_emplace_impl(
+        const std_transition::source_location& loc, K0&& key, Args&&... args)
+    {
+        const InsertionPoint point = tree().insertion_point_for(std::as_const(key));
+        if (point.entry_index != Tree::NULL_ENTRY_INDEX)
+        {
+            return {point.entry_index, false};
+        }
+
+        check_not_full(loc);
+        return {tree().insert_new_at(point, std::forward<K0>(key), std::forward<Args>(args)...),
+                true};
+    }
+
+    template <class K0, class M>
+    constexpr std::pair<iterator, bool> insert_or_assign_impl(
+        const std_transition::source_location& loc, K0&& key, M&& obj)
+    {
+        const InsertionPoint point = tree().insertion_point_for(std::as_const(key));
+        if (point.entry_index != Tree::NULL_ENTRY_INDEX)
+        {
+            tree().value_at(point.entry_index) = std::forward<M>(obj);
+            return {create_iterator(point.entry_index), false};
+        }
+
+        check_not_full(loc);
+        return {create_iterator(
+                    tree().insert_new_at(point, std::forward<K0>(key), std::forward<M>(obj))),
+                true};
+    }
+
+    template <class K0>
+    constexpr size_type erase_key_impl(const K0& key)
+    {
+        const EntryIndex entry_index = tree().index_of_entry(key);
+        if (entry_index == Tree::NULL_ENTRY_INDEX)
+        {
+            return 0;
+        }
+        tree().erase_at(entry_index);
+        return 1;
+    }
+};
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t KEYS_PER_NODE,
+          customize::MapChecking<K> CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, KEYS_PER_NODE, CheckingType>& container)
+{
+    return container.size() >= container.max_size();
+}
+
+template <class K,
+          class V,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t KEYS_PER_NODE,
+          customize::MapChecking<K> CheckingType,
+          class Predicate>
+constexpr typename FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, KEYS_PER_NODE, CheckingType>::
+    size_type
+    erase_if(FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, KEYS_PER_NODE, CheckingType>& container,
+             Predicate predicate)
+{
+    return erase_if_detail::erase_if_impl(container, predicate);
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare,
+          std::size_t KEYS_PER_NODE,
+          fixed_containers::customize::MapChecking<K> CheckingType>
+struct tuple_size<
+    fixed_containers::FixedBTreeMap<K, V, MAXIMUM_SIZE, Compare, KEYS_PER_NODE, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
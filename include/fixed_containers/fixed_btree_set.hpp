@@ -0,0 +1,445 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/bidirectional_iterator.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/erase_if.hpp"
+#include "fixed_containers/fixed_btree.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/set_checking.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+/**
+ * Fixed-capacity B+-tree set with maximum size that is declared at compile-time via template
+ * parameter. Same interface as `FixedSet`, without node handles or the tree-specific operations.
+ * Properties:
+ *  - constexpr
+ *  - retains the copy/move/destruction properties of K
+ *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
+ *  - no dynamic allocations
+ *  - no recursion
+ *
+ * See `FixedBTreeMap` for the layout. Iterator invalidation: as with `FixedSet` and `std::set`,
+ * only the iterators and references to an erased key are invalidated.
+ */
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Compare = std::less<K>,
+          std::size_t KEYS_PER_NODE = fixed_btree_detail::default_keys_per_node<K>(),
+          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>>
+class FixedBTreeSet
+{
+public:
+    using key_type = K;
+    using value_type = K;
+    using const_reference = const value_type&;
+    using reference = const_reference;
+    using const_pointer = std::add_pointer_t<const_reference>;
+    using pointer = const_pointer;
+
+private:
+    using Tree =
+        fixed_btree_detail::FixedBTree<K, EmptyValue, MAXIMUM_SIZE, Compare, KEYS_PER_NODE>;
+    using EntryIndex = typename Tree::EntryIndex;
+    using InsertionPoint = typename Tree::InsertionPoint;
+
+    class ReferenceProvider
+    {
+        const Tree* tree_;
+        EntryIndex entry_index_;
+
+    public:
+        constexpr ReferenceProvider() noexcept
+          : ReferenceProvider{nullptr, Tree::NULL_ENTRY_INDEX}
+        {
+        }
+
+        constexpr ReferenceProvider(const Tree* const tree, const EntryIndex& entry_index) noexcept
+          : tree_{tree}
+          , entry_index_{entry_index}
+        {
+        }
+
+        constexpr void advance() noexcept
+        {
+            entry_index_ = tree_->index_of_next_entry(entry_index_);
+        }
+        constexpr void recede() noexcept
+        {
+            entry_index_ = tree_->index_of_previous_entry(entry_index_);
+        }
+
+        [[nodiscard]] constexpr const_reference get() const noexcept
+        {
+            return tree_->key_at(entry_index_);
+        }
+
+        constexpr bool operator==(const ReferenceProvider& other) const noexcept = default;
+
+        [[nodiscard]] constexpr EntryIndex entry_index() const { return entry_index_; }
+    };
+
+    template <IteratorDirection DIRECTION>
+    using Iterator = BidirectionalIterator<ReferenceProvider,
+                                           ReferenceProvider,
+                                           IteratorConstness::CONSTANT_ITERATOR,
+                                           DIRECTION>;
+
+public:
+    using const_iterator = Iterator<IteratorDirection::FORWARD>;
+    using iterator = const_iterator;
+    using const_reverse_iterator = Iterator<IteratorDirection::REVERSE>;
+    using reverse_iterator = const_reverse_iterator;
+    using size_type = typename Tree::size_type;
+    using difference_type = typename Tree::difference_type;
+
+public:
+    [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    Tree IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_;
+
+public:
+    constexpr FixedBTreeSet() noexcept
+      : FixedBTreeSet{Compare{}}
+    {
+    }
+
+    explicit constexpr FixedBTreeSet(const Compare& comparator) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_{comparator}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedBTreeSet(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedBTreeSet{comparator}
+    {
+        insert(first, last, loc);
+    }
+
+    constexpr FixedBTreeSet(std::initializer_list<value_type> list,
+                            const Compare& comparator = {},
+                            const std_transition::source_location& loc =
+                                std_transition::source_location::current()) noexcept
+      : FixedBTreeSet{comparator}
+    {
+        this->insert(list, loc);
+    }
+
+public:
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(tree().index_of_first_entry());
+    }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return create_const_iterator(Tree::NULL_ENTRY_INDEX);
+    }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
+
+    [[nodiscard]] constexpr const_reverse_iterator crbegin() const noexcept
+    {
+        return create_const_reverse_iterator(Tree::NULL_ENTRY_INDEX);
+    }
+    [[nodiscard]] constexpr const_reverse_iterator crend() const noexcept
+    {
+        return create_const_reverse_iterator(tree().index_of_first_entry());
+    }
+    [[nodiscard]] constexpr const_reverse_iterator rbegin() const noexcept { return crbegin(); }
+    [[nodiscard]] constexpr const_reverse_iterator rend() const noexcept { return crend(); }
+
+    [[nodiscard]] constexpr std::size_t max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return tree().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return tree().empty(); }
+
+    constexpr void clear() noexcept { tree().clear(); }
+
+    constexpr std::pair<const_iterator, bool> insert(
+        const K& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return insert_impl(loc, value);
+    }
+    constexpr std::pair<const_iterator, bool> insert(
+        K&& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        return insert_impl(loc, std::move(value));
+    }
+    // The hinted overloads ignore the hint: a lookup from the root only reads a few nodes
+    constexpr const_iterator insert(const_iterator /*hint*/,
+                                    const K& key,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert_impl(loc, key).first;
+    }
+    constexpr const_iterator insert(const_iterator /*hint*/,
+                                    K&& key,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert_impl(loc, std::move(key)).first;
+    }
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    template <class... Args>
+    constexpr std::pair<const_iterator, bool> emplace(Args&&... args)
+    {
+        return insert(K{std::forward<Args>(args)...});
+    }
+    template <class... Args>
+    constexpr iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        return insert(hint, K{std::forward<Args>(args)...});
+    }
+
+    constexpr const_iterator erase(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        return create_const_iterator(tree().erase_at(get_entry_index_from_iterator(pos)));
+    }
+
+    constexpr const_iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        const EntryIndex last_entry_index = get_entry_index_from_iterator(last);
+        EntryIndex entry_index = get_entry_index_from_iterator(first);
+        while (entry_index != last_entry_index)
+        {
+            entry_index = tree().erase_at(entry_index);
+        }
+        return create_const_iterator(entry_index);
+    }
+
+    constexpr size_type erase(const K& key) noexcept { return erase_key_impl(key); }
+
+    template <class K0>
+    constexpr size_type erase(K0&& key) noexcept
+        requires(IsTransparent<Compare> and !std::is_convertible_v<K0 &&, iterator> and
+                 !std::is_convertible_v<K0 &&, const_iterator>)
+    {
+        return erase_key_impl(key);
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().index_of_entry(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().index_of_entry(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return tree().index_of_entry(key) != Tree::NULL_ENTRY_INDEX;
+    }
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return tree().index_of_entry(key) != Tree::NULL_ENTRY_INDEX;
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr const_iterator lower_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().index_of_entry_not_less(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator lower_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().index_of_entry_not_less(key));
+    }
+
+    [[nodiscard]] constexpr const_iterator upper_bound(const K& key) const noexcept
+    {
+        return create_const_iterator(tree().index_of_entry_greater(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator upper_bound(const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return create_const_iterator(tree().index_of_entry_greater(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K0& key) const noexcept
+        requires IsTransparent<Compare>
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Compare2,
+              std::size_t KEYS_PER_NODE_2,
+              customize::SetChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedBTreeSet<K, MAXIMUM_SIZE_2, Compare2, KEYS_PER_NODE_2, CheckingType2>& other)
+        const
+    {
+        if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2 && KEYS_PER_NODE == KEYS_PER_NODE_2)
+        {
+            if (this == &other)
+            {
+                return true;
+            }
+        }
+
+        return std::ranges::equal(*this, other);
+    }
+
+private:
+    constexpr Tree& tree() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_; }
+    [[nodiscard]] constexpr const Tree& tree() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_;
+    }
+
+    [[nodiscard]] constexpr const_iterator create_const_iterator(
+        const EntryIndex& entry_index) const noexcept
+    {
+        return const_iterator{ReferenceProvider{std::addressof(tree()), entry_index}};
+    }
+
+    [[nodiscard]] constexpr const_reverse_iterator create_const_reverse_iterator(
+        const EntryIndex& entry_index) const noexcept
+    {
+        return const_reverse_iterator{ReferenceProvider{std::addressof(tree()), entry_index}};
+    }
+
+    [[nodiscard]] constexpr EntryIndex get_entry_index_from_iterator(const_iterator pos) const
+    {
+        return pos.template private_reference_provider<ReferenceProvider>().entry_index();
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(!tree().full()))
+        {
+            CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+        }
+    }
+
+    template <class K0>
+    constexpr std::pair<const_iterator, bool> insert_impl(
+        const std_transition::source_location& loc, K0&& key)
+    {
+        const InsertionPoint point = tree().insertion_point_for(std::as_const(key));
+        if (point.entry_index != Tree::NULL_ENTRY_INDEX)
+        {
+            return {create_const_iterator(point.entry_index), false};
+        }
+
+        check_not_full(loc);
+        return {create_const_iterator(tree().insert_new_at(point, std::forward<K0>(key))), true};
+    }
+
+    template <class K0>
+    constexpr size_type erase_key_impl(const K0& key)
+    {
+        const EntryIndex entry_index = tree().index_of_entry(key);
+        if (entry_index == Tree::NULL_ENTRY_INDEX)
+        {
+            return 0;
+        }
+        tree().erase_at(entry_index);
+        return 1;
+    }
+};
+
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t KEYS_PER_NODE,
+          customize::SetChecking<K> CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedBTreeSet<K, MAXIMUM_SIZE, Compare, KEYS_PER_NODE, CheckingType>& container)
+{
+    return container.size() >= container.max_size();
+}
+
+template <class K,
+          std::size_t MAXIMUM_SIZE,
+          class Compare,
+          std::size_t KEYS_PER_NODE,
+          customize::SetChecking<K> CheckingType,
+          class Predicate>
+constexpr typename FixedBTreeSet<K, MAXIMUM_SIZE, Compare, KEYS_PER_NODE, CheckingType>::size_type
+erase_if(FixedBTreeSet<K, MAXIMUM_SIZE, Compare, KEYS_PER_NODE, CheckingType>& container,
+         Predicate predicate)
+{
+    return erase_if_detail::erase_if_impl(container, predicate);
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          std::size_t MAXIMUM_SIZE,
+          typename Compare,
+          std::size_t KEYS_PER_NODE,
+          fixed_containers::customize::SetChecking<K> CheckingType>
+struct tuple_size<
+    fixed_containers::FixedBTreeSet<K, MAXIMUM_SIZE, Compare, KEYS_PER_NODE, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -1,9 +1,12 @@
 #pragma once
 
+#include "fixed_containers/concepts.hpp"
 #include "fixed_containers/fixed_index_based_storage.hpp"
 
 #include <array>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
 
 namespace fixed_containers::fixed_doubly_linked_list_detail
 {
@@ -56,6 +59,18 @@ public:
         delete_range_and_return_next_index(front_index(), MAXIMUM_SIZE);
     }
 
+    // Same as `clear()`, but rewrites every index in one pass instead of unlinking the values one
+    // at a time. Faster unless the list is nearly empty, and only possible for values that need
+    // no destruction.
+    constexpr void clear_by_resetting_indices() noexcept
+        requires TriviallyDestructible<T>
+    {
+        storage().reset_freelist();
+        next_of(MAXIMUM_SIZE) = MAXIMUM_SIZE;
+        prev_of(MAXIMUM_SIZE) = MAXIMUM_SIZE;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = 0;
+    }
+
     [[nodiscard]] constexpr const T& at(const IndexType index) const { return storage().at(index); }
     constexpr T& at(const IndexType index) { return storage().at(index); }
 
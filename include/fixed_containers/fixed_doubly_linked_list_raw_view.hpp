@@ -4,15 +4,17 @@
 #include "fixed_containers/forward_iterator.hpp"
 
 #include <cstddef>
+#include <cstdint>
 
 namespace fixed_containers::fixed_doubly_linked_list_detail
 {
 // non-templated iterator over `FixedDoublyLinkedList`s allows inspection of the data type without
-// knowing the actual type of the underlying object
+// knowing the actual type of the underlying object. The width of the indices stored in the list
+// defaults to `sizeof(IndexType)`, but can also be given at runtime for lists whose index type
+// depends on their capacity.
 template <typename IndexType = std::size_t>
 class FixedDoublyLinkedListRawView
 {
-    using ChainEntryType = LinkedListIndices<IndexType>;
 
 public:
     class ReferenceProvider
@@ -38,7 +40,7 @@ public:
         {
         }
 
-        constexpr void advance() noexcept { current_idx_ = parent_->indices_of(current_idx_).next; }
+        constexpr void advance() noexcept { current_idx_ = parent_->next_index_of(current_idx_); }
 
         [[nodiscard]] constexpr const std::byte* get() const noexcept
         {
@@ -53,6 +55,7 @@ private:
     std::size_t elem_size_bytes_;
     std::size_t elem_align_bytes_;
     std::size_t max_elem_count_;
+    std::size_t index_size_bytes_;
 
 public:
     using Iterator =
@@ -63,12 +66,14 @@ public:
     FixedDoublyLinkedListRawView(const void* list_ptr,
                                  std::size_t elem_size_bytes,
                                  std::size_t elem_align_bytes,
-                                 std::size_t max_elem_count)
+                                 std::size_t max_elem_count,
+                                 std::size_t index_size_bytes = sizeof(IndexType))
       : list_ptr_{static_cast<const std::byte*>(list_ptr)}
       // the PoolStorage stores unions of `T`, `std::size_t`, so they are always at least that big
       , elem_size_bytes_{std::max(elem_size_bytes, sizeof(std::size_t))}
       , elem_align_bytes_{std::max(elem_align_bytes, alignof(std::size_t))}
       , max_elem_count_{max_elem_count}
+      , index_size_bytes_{index_size_bytes}
     {
     }
 
@@ -80,8 +85,7 @@ public:
     {
         // this is _very_ _very_ brittle and reliant on the size of every field in the
         // `FixedDoublyLinkedList`!
-        return *reinterpret_cast<const IndexType*>(
-            std::next(list_ptr_, value_storage_size() + chain_size()));
+        return read_index(std::next(list_ptr_, value_storage_size() + chain_size()));
     }
 
 public:
@@ -99,7 +103,8 @@ public:
 
     [[nodiscard]] constexpr std::ptrdiff_t chain_size() const noexcept
     {
-        return static_cast<std::ptrdiff_t>(sizeof(ChainEntryType) * (max_elem_count_ + 1));
+        // every entry of the chain is a `LinkedListIndices`, i.e. a prev and a next index
+        return static_cast<std::ptrdiff_t>(2 * index_size_bytes_ * (max_elem_count_ + 1));
     }
 
     [[nodiscard]] constexpr const std::byte* value_storage_start() const noexcept
@@ -115,17 +120,35 @@ public:
                          static_cast<std::ptrdiff_t>(elem_size_bytes_ * index));
     }
 
-    [[nodiscard]] constexpr const ChainEntryType* chain_start() const noexcept
+    [[nodiscard]] constexpr const std::byte* chain_start() const noexcept
     {
         // this is _very_ brittle and reliant on the layout of `FixedDoublyLinkedList` _and_ the
         // layout of `FixedIndexBasedPoolStorage` the storage holds the array + 1 `std::size_t` for
         // the next index
-        return reinterpret_cast<const ChainEntryType*>(std::next(list_ptr_, value_storage_size()));
+        return std::next(list_ptr_, value_storage_size());
     }
 
-    [[nodiscard]] constexpr const ChainEntryType& indices_of(IndexType index) const noexcept
+    [[nodiscard]] IndexType next_index_of(IndexType index) const noexcept
     {
-        return *std::next(chain_start(), static_cast<std::ptrdiff_t>(index));
+        // `next` is the second field of `LinkedListIndices`
+        const std::size_t offset = (2 * static_cast<std::size_t>(index) + 1) * index_size_bytes_;
+        return read_index(std::next(chain_start(), static_cast<std::ptrdiff_t>(offset)));
+    }
+
+private:
+    [[nodiscard]] IndexType read_index(const std::byte* ptr) const noexcept
+    {
+        switch (index_size_bytes_)
+        {
+        case sizeof(std::uint8_t):
+            return static_cast<IndexType>(*reinterpret_cast<const std::uint8_t*>(ptr));
+        case sizeof(std::uint16_t):
+            return static_cast<IndexType>(*reinterpret_cast<const std::uint16_t*>(ptr));
+        case sizeof(std::uint32_t):
+            return static_cast<IndexType>(*reinterpret_cast<const std::uint32_t*>(ptr));
+        default:
+            return static_cast<IndexType>(*reinterpret_cast<const std::uint64_t*>(ptr));
+        }
     }
 };
 }  // namespace fixed_containers::fixed_doubly_linked_list_detail
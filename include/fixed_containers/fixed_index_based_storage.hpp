@@ -77,6 +77,17 @@ public:
         return index;
     }
 
+    // Hand out indices in the same order as a newly constructed storage does: 0, 1, 2...
+    // Warning: Assumes all the indices in `this` do not currently contain a value!
+    constexpr void reset_freelist()
+    {
+        for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+        {
+            array_unchecked_at(i).index = i + 1;
+        }
+        set_next_index(0);
+    }
+
     // Set the freelist of `this` to match the freelist of `other`. This only makes sense if
     // you will emplace valid values in the "full" spots (The ones not touched by this function). It
     // explicitly makes _no guarantees_ about the contents of "full" slots in the destination.
@@ -0,0 +1,351 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_robinhood_hashtable.hpp"
+#include "fixed_containers/index_width.hpp"
+#include "fixed_containers/memory.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+// A robin-hood hashtable for sets of small keys, that keeps each key in its bucket next to the
+// distance and fingerprint, instead of in a separate value list that the bucket points to. A
+// lookup reads a single bucket array, so a hit costs one memory access instead of two, and there
+// are no list indices to store.
+//
+// Keys move between buckets when other keys are inserted or erased, so unlike
+// `FixedRobinhoodHashtable` with linked-list storage, inserting and erasing invalidate iterators
+// and iteration follows the bucket order. To keep erasing during iteration correct, probe
+// sequences never wrap around to the start of the table: the bucket array has room at the end for
+// the keys of the last home buckets to spill into.
+
+namespace fixed_containers::fixed_inline_key_hashtable_detail
+{
+
+template <typename K, typename DistAndFingerprintT>
+struct InlineKeyBucket
+{
+    // Same layout of distance and fingerprint as the robin-hood buckets
+    using Encoding =
+        fixed_robinhood_hashtable_detail::BasicBucket<DistAndFingerprintT, std::uint8_t>;
+    using DistAndFingerprintType = DistAndFingerprintT;
+
+    DistAndFingerprintType dist_and_fingerprint_;
+    K key_;
+
+    [[nodiscard]] constexpr DistAndFingerprintType dist() const
+    {
+        return static_cast<DistAndFingerprintType>(dist_and_fingerprint_ >>
+                                                   Encoding::FINGERPRINT_BITS);
+    }
+
+    [[nodiscard]] constexpr bool empty() const { return dist_and_fingerprint_ == 0; }
+};
+
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_VALUE_COUNT,
+          std::size_t BUCKET_COUNT,
+          class Hash,
+          class KeyEqual>
+class FixedInlineKeyHashtable
+{
+    static_assert(std::is_same_v<V, EmptyValue>, "keys are stored inline only for sets");
+    static_assert(TriviallyCopyable<K> && std::is_default_constructible_v<K>,
+                  "keys stored inline must be trivially copyable and default constructible");
+
+public:
+    using HashType = Hash;
+    using KeyEqualType = KeyEqual;
+
+    static constexpr std::size_t CAPACITY = MAXIMUM_VALUE_COUNT;
+    // 0 size is problematic because it leads to modulo 0 (undefined behavior)
+    static constexpr std::size_t HOME_BUCKET_COUNT = std::max<std::size_t>(1, BUCKET_COUNT);
+    // A key is at most `CAPACITY - 1` buckets past its home bucket, plus one bucket that is always
+    // empty, so that lookups and iteration stop before the end without a bounds check.
+    static constexpr std::size_t INTERNAL_TABLE_SIZE = HOME_BUCKET_COUNT + CAPACITY;
+
+    using SizeType = index_width::SmallestIndexType<CAPACITY + 1>;
+    using BucketIndexType = index_width::SmallestIndexType<INTERNAL_TABLE_SIZE + 1>;
+    using BucketType = InlineKeyBucket<
+        K,
+        fixed_robinhood_hashtable_detail::DistAndFingerprintTypeFor<INTERNAL_TABLE_SIZE>>;
+    using Encoding = typename BucketType::Encoding;
+
+    static_assert(MAXIMUM_VALUE_COUNT <= BUCKET_COUNT,
+                  "need at least enough buckets to point to every value in array");
+    static_assert(INTERNAL_TABLE_SIZE <= Encoding::MAX_NUM_BUCKETS,
+                  "specified too many buckets for the current bucket memory layout");
+
+    std::array<BucketType, INTERNAL_TABLE_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_{};
+    SizeType IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{};
+
+    Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{};
+    KeyEqual IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_{};
+
+    struct OpaqueIndexType
+    {
+        BucketIndexType bucket_index;
+        // Same trick as `FixedRobinhoodHashtable`: 0 for keys that exist, otherwise the
+        // dist_and_fingerprint that `emplace()` should place at `bucket_index`.
+        typename BucketType::DistAndFingerprintType dist_and_fingerprint;
+    };
+
+    // Iteration goes through the buckets in order
+    using OpaqueIteratedType = BucketIndexType;
+
+    ////////////////////// helper functions
+public:
+    [[nodiscard]] constexpr BucketType& bucket_at(std::size_t idx)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_[idx];
+    }
+    [[nodiscard]] constexpr const BucketType& bucket_at(std::size_t idx) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_[idx];
+    }
+
+    template <typename Key>
+    [[nodiscard]] constexpr std::uint64_t hash(const Key& key) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(key);
+    }
+
+    template <typename K1, typename K2>
+    [[nodiscard]] constexpr bool key_equal(const K1& key1, const K2& key2) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(key1, key2);
+    }
+
+    [[nodiscard]] static constexpr BucketIndexType bucket_index_from_hash(std::uint64_t hash)
+    {
+        // Keep the bits used for the fingerprint out of the bucket index, see
+        // `FixedRobinhoodHashtable::bucket_index_from_hash()`
+        const std::uint64_t shifted_hash = hash >> Encoding::FINGERPRINT_BITS;
+        return static_cast<BucketIndexType>(shifted_hash % HOME_BUCKET_COUNT);
+    }
+
+    // The first bucket at or after `bucket_index` that holds a key, or `end_index()`
+    [[nodiscard]] constexpr BucketIndexType first_full_bucket_from(
+        BucketIndexType bucket_index) const
+    {
+        while (bucket_index < end_index() && bucket_at(bucket_index).empty())
+        {
+            bucket_index++;
+        }
+        return bucket_index;
+    }
+
+    //////////////////////// Common Interface Impl
+public:
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        return static_cast<std::size_t>(IMPLEMENTATION_DETAIL_DO_NOT_USE_size_);
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType begin_index() const
+    {
+        return first_full_bucket_from(0);
+    }
+
+    static constexpr OpaqueIteratedType invalid_index()
+    {
+        // The last bucket, which is always empty
+        return static_cast<BucketIndexType>(INTERNAL_TABLE_SIZE - 1);
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType end_index() const { return invalid_index(); }
+
+    [[nodiscard]] constexpr OpaqueIteratedType next_of(
+        const OpaqueIteratedType& bucket_index) const
+    {
+        return first_full_bucket_from(static_cast<BucketIndexType>(bucket_index + 1));
+    }
+
+    [[nodiscard]] constexpr const K& key_at(const OpaqueIteratedType& bucket_index) const
+    {
+        return bucket_at(bucket_index).key_;
+    }
+
+    // Only for moving the key out right before erasing it, as changing it breaks the lookup
+    constexpr K& mutable_key_at(const OpaqueIteratedType& bucket_index)
+    {
+        return bucket_at(bucket_index).key_;
+    }
+
+    // Only the fingerprint of the hash is kept, so the key is hashed again
+    [[nodiscard]] constexpr std::uint64_t hash_at(const OpaqueIteratedType& bucket_index) const
+    {
+        return hash(key_at(bucket_index));
+    }
+
+    [[nodiscard]] constexpr const Hash& hash_function() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    }
+
+    [[nodiscard]] constexpr const KeyEqual& key_eq() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType iterated_index_from(
+        const OpaqueIndexType& index) const
+    {
+        return index.bucket_index;
+    }
+
+    // `Key` is `K`, or any type that `Hash` and `KeyEqual` transparently accept
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of(const Key& key) const
+    {
+        return opaque_index_of_hash(key, hash(key));
+    }
+
+    // The key is in the bucket, so there is no value to prefetch separately
+    constexpr void prefetch_bucket(std::uint64_t key_hash) const
+    {
+        memory::prefetch_for_read(bucket_at(bucket_index_from_hash(key_hash)));
+    }
+
+    constexpr void prefetch_value(std::uint64_t /*key_hash*/) const {}
+
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of_hash(const Key& key,
+                                                                 std::uint64_t key_hash) const
+    {
+        typename BucketType::DistAndFingerprintType dist_and_fingerprint =
+            Encoding::dist_and_fingerprint_from_hash(key_hash);
+        BucketIndexType table_loc = bucket_index_from_hash(key_hash);
+
+        while (true)
+        {
+            const BucketType& bucket = bucket_at(table_loc);
+            if (bucket.dist_and_fingerprint_ == dist_and_fingerprint &&
+                key_equal(key, bucket.key_))
+            {
+                return {table_loc, 0};
+            }
+            // See `FixedRobinhoodHashtable::opaque_index_of_hash()`. The always-empty last bucket
+            // stops the probe before the end of the array.
+            if (dist_and_fingerprint > bucket.dist_and_fingerprint_)
+            {
+                return {table_loc, dist_and_fingerprint};
+            }
+            dist_and_fingerprint = Encoding::increment_dist(dist_and_fingerprint);
+            table_loc++;
+        }
+    }
+
+    [[nodiscard]] constexpr bool exists(const OpaqueIndexType& index) const
+    {
+        return index.dist_and_fingerprint == 0;
+    }
+
+    template <typename... Args>
+    constexpr OpaqueIndexType emplace(const OpaqueIndexType& index, Args&&... args)
+    {
+        // Bubble the keys up until an empty bucket, like `place_and_shift_up()` of the robin-hood
+        // table. That bucket is at most at `INTERNAL_TABLE_SIZE - 2`, see `INTERNAL_TABLE_SIZE`.
+        BucketType bucket{index.dist_and_fingerprint, K(std::forward<Args>(args)...)};
+        BucketIndexType table_loc = index.bucket_index;
+        while (!bucket_at(table_loc).empty())
+        {
+            bucket = std::exchange(bucket_at(table_loc), bucket);
+            bucket.dist_and_fingerprint_ = Encoding::increment_dist(bucket.dist_and_fingerprint_);
+            table_loc++;
+        }
+        bucket_at(table_loc) = bucket;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_++;
+        return {index.bucket_index, 0};
+    }
+
+    // Only the fingerprint is kept, which `index` already has
+    template <typename... Args>
+    constexpr OpaqueIndexType emplace_with_hash(const OpaqueIndexType& index,
+                                                std::uint64_t /*key_hash*/,
+                                                Args&&... args)
+    {
+        return emplace(index, std::forward<Args>(args)...);
+    }
+
+    // The keys after the erased one shift back into its bucket, so the next one to visit is the
+    // first at or after it.
+    constexpr OpaqueIteratedType erase(const OpaqueIndexType& index)
+    {
+        BucketIndexType table_loc = index.bucket_index;
+        auto next_loc = static_cast<BucketIndexType>(table_loc + 1);
+        while (bucket_at(next_loc).dist_and_fingerprint_ >= Encoding::DIST_INC * 2)
+        {
+            bucket_at(table_loc) = bucket_at(next_loc);
+            bucket_at(table_loc).dist_and_fingerprint_ =
+                Encoding::decrement_dist(bucket_at(table_loc).dist_and_fingerprint_);
+            table_loc = std::exchange(next_loc, static_cast<BucketIndexType>(next_loc + 1));
+        }
+        bucket_at(table_loc) = {};
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_--;
+        return first_full_bucket_from(index.bucket_index);
+    }
+
+    constexpr OpaqueIteratedType erase_range(const OpaqueIteratedType& start_bucket_index,
+                                             const OpaqueIteratedType& end_bucket_index)
+    {
+        // The key at `end_bucket_index` moves while erasing, but stays the same number of keys
+        // away from the start.
+        std::size_t remaining = 0;
+        for (BucketIndexType cur_index = start_bucket_index; cur_index != end_bucket_index;
+             cur_index = next_of(cur_index))
+        {
+            remaining++;
+        }
+
+        BucketIndexType cur_index = start_bucket_index;
+        for (; remaining > 0; remaining--)
+        {
+            cur_index = erase({cur_index, 0});
+        }
+        return cur_index;
+    }
+
+    constexpr void clear()
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_.fill({});
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = 0;
+    }
+
+public:
+    constexpr FixedInlineKeyHashtable() = default;
+
+    constexpr FixedInlineKeyHashtable(const Hash& hash, const KeyEqual& equal = KeyEqual())
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(hash)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(equal)
+    {
+    }
+};
+
+}  // namespace fixed_containers::fixed_inline_key_hashtable_detail
+
+namespace fixed_containers
+{
+
+/**
+ * Table policy for `FixedUnorderedSet` that uses a `FixedInlineKeyHashtable`. For small,
+ * trivially copyable keys, like integers, enums and ids. Inserting and erasing invalidate
+ * iterators, and the bucket array is `BUCKET_COUNT + MAXIMUM_SIZE` buckets long.
+ */
+struct InlineKeyHashtablePolicy
+{
+    template <typename K,
+              typename V,
+              std::size_t MAXIMUM_VALUE_COUNT,
+              std::size_t BUCKET_COUNT,
+              class Hash,
+              class KeyEqual>
+    using Table = fixed_inline_key_hashtable_detail::
+        FixedInlineKeyHashtable<K, V, MAXIMUM_VALUE_COUNT, BUCKET_COUNT, Hash, KeyEqual>;
+};
+
+}  // namespace fixed_containers
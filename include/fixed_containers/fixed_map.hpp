@@ -7,13 +7,18 @@
 #include "fixed_containers/erase_if.hpp"
 #include "fixed_containers/fixed_red_black_tree.hpp"
 #include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/node_handle.hpp"
 #include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sorted_unique.hpp"
 #include "fixed_containers/source_location.hpp"
 
 #include <algorithm>
 #include <array>
+#include <concepts>
 #include <cstddef>
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 namespace fixed_containers
 {
@@ -25,6 +30,12 @@ namespace fixed_containers
  *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
  *  - no dynamic allocations
  *  - no recursion
+ *
+ * Iterator invalidation: with the default `FixedIndexBasedPoolStorage`, iterators and references
+ * stay valid until their entry is erased, as with `std::map`. With
+ * `FixedIndexBasedContiguousStorage`, erasing any entry invalidates all of them. `FixedBTreeMap`
+ * keeps the keys of a node packed together for faster lookups, with the same guarantee as the
+ * default storage.
  */
 template <class K,
           class V,
@@ -37,14 +48,19 @@ template <class K,
                     ,
                     std::size_t>
           typename StorageTemplate = FixedIndexBasedPoolStorage,
-          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+          customize::MapChecking<K> CheckingType =
+              customize::MapAbortChecking<K, V, MAXIMUM_SIZE>,
+          class Augmentation = NoTreeAugmentation>
 class FixedMap
 {
 public:
     using key_type = K;
     using mapped_type = V;
     using value_type = std::pair<const K, V>;
-    using reference = std::pair<const K&, V&>;
+    // The values are const if the aggregates of the `Augmentation` depend on them, see `modify()`
+    using reference = std::pair<
+        const K&,
+        std::conditional_t<TreeAggregatePolicyOfValues<Augmentation, K, V>, const V&, V&>>;
     using const_reference = std::pair<const K&, const V&>;
     using pointer = std::add_pointer_t<reference>;
     using const_pointer = std::add_pointer_t<const_reference>;
@@ -54,7 +70,11 @@ private:
     using NodeIndexAndParentIndex = fixed_red_black_tree_detail::NodeIndexAndParentIndex;
     static constexpr NodeIndex NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
     using Tree = fixed_red_black_tree_detail::
-        FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+        FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, Augmentation>;
+    static constexpr bool HAS_SUBTREE_SIZES =
+        std::is_same_v<Augmentation, OrderStatisticTreeAugmentation>;
+    static constexpr bool HAS_AGGREGATE = TreeAggregatePolicy<Augmentation, K, V>;
+    using MappedReference = typename reference::second_type;
 
     template <bool IS_CONST>
     class PairProvider
@@ -156,6 +176,8 @@ public:
         Iterator<IteratorConstness::MUTABLE_ITERATOR, IteratorDirection::REVERSE>;
     using size_type = typename Tree::size_type;
     using difference_type = typename Tree::difference_type;
+    using node_type = MapNodeHandle<K, V>;
+    using insert_return_type = NodeInsertReturnType<iterator, node_type>;
 
 public:
     [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
@@ -194,10 +216,46 @@ public:
         this->insert(list, loc);
     }
 
+    /**
+     * Same as the iterator constructor, for input that is already sorted by `Compare` and has no
+     * duplicate keys. Builds a perfectly balanced tree in O(n) without comparing any key.
+     */
+    template <InputIterator InputIt>
+    constexpr FixedMap(
+        sorted_unique_t /*tag*/,
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedMap{comparator}
+    {
+        tree().build_from_sorted_unique(first, last, [this, &loc]() { check_not_full(loc); });
+    }
+
+    constexpr FixedMap(sorted_unique_t tag,
+                       std::initializer_list<value_type> list,
+                       const Compare& comparator = {},
+                       const std_transition::source_location& loc =
+                           std_transition::source_location::current()) noexcept
+      : FixedMap{tag, list.begin(), list.end(), comparator, loc}
+    {
+    }
+
+    template <InputIterator InputIt>
+    [[nodiscard]] static constexpr FixedMap from_sorted_unique(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return FixedMap{sorted_unique, first, last, comparator, loc};
+    }
+
 public:
-    [[nodiscard]] constexpr V& at(const K& key,
-                                  const std_transition::source_location& loc =
-                                      std_transition::source_location::current()) noexcept
+    [[nodiscard]] constexpr MappedReference at(
+        const K& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
     {
         const NodeIndex index = tree().index_of_node_or_null(key);
         if (preconditions::test(tree().contains_at(index)))
@@ -219,7 +277,7 @@ public:
         return tree().node_at(index).value();
     }
 
-    constexpr V& operator[](const K& key) noexcept
+    constexpr MappedReference operator[](const K& key) noexcept
     {
         NodeIndexAndParentIndex np_idxs = tree().index_of_node_with_parent(key);
         if (tree().contains_at(np_idxs.i))
@@ -232,7 +290,7 @@ public:
         tree().insert_new_at(np_idxs, key);
         return tree().node_at(np_idxs.i).value();
     }
-    constexpr V& operator[](K&& key) noexcept
+    constexpr MappedReference operator[](K&& key) noexcept
     {
         NodeIndexAndParentIndex np_idxs = tree().index_of_node_with_parent(key);
         if (tree().contains_at(np_idxs.i))
@@ -312,6 +370,37 @@ public:
         return {create_iterator(np_idxs.i), true};
     }
 
+    constexpr iterator insert(const_iterator hint,
+                              const value_type& value,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        NodeIndexAndParentIndex np_idxs = index_of_node_with_parent_near(hint, value.first);
+        if (tree().contains_at(np_idxs.i))
+        {
+            return create_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, value.first, value.second);
+        return create_iterator(np_idxs.i);
+    }
+    constexpr iterator insert(const_iterator hint,
+                              value_type&& value,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        NodeIndexAndParentIndex np_idxs = index_of_node_with_parent_near(hint, value.first);
+        if (tree().contains_at(np_idxs.i))
+        {
+            return create_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, value.first, std::move(value.second));
+        return create_iterator(np_idxs.i);
+    }
+
     template <InputIterator Input>
     constexpr void insert(Input first,
                           Input last,
@@ -342,6 +431,7 @@ public:
         if (tree().contains_at(np_idxs.i))
         {
             tree().node_at(np_idxs.i).value() = std::forward<M>(obj);
+            tree().update_subtree_data_after_value_change_at(np_idxs.i);
             return {create_iterator(np_idxs.i), false};
         }
 
@@ -361,6 +451,7 @@ public:
         if (tree().contains_at(np_idxs.i))
         {
             tree().node_at(np_idxs.i).value() = std::forward<M>(obj);
+            tree().update_subtree_data_after_value_change_at(np_idxs.i);
             return {create_iterator(np_idxs.i), false};
         }
 
@@ -369,24 +460,44 @@ public:
         return {create_iterator(np_idxs.i), true};
     }
     template <class M>
-    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+    constexpr iterator insert_or_assign(const_iterator hint,
                                         const K& key,
                                         M&& obj,
                                         const std_transition::source_location& loc =
                                             std_transition::source_location::current()) noexcept
         requires std::is_assignable_v<mapped_type&, M&&>
     {
-        return insert_or_assign(key, std::forward<M>(obj), loc).first;
+        NodeIndexAndParentIndex np_idxs = index_of_node_with_parent_near(hint, key);
+        if (tree().contains_at(np_idxs.i))
+        {
+            tree().node_at(np_idxs.i).value() = std::forward<M>(obj);
+            tree().update_subtree_data_after_value_change_at(np_idxs.i);
+            return create_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, key, std::forward<M>(obj));
+        return create_iterator(np_idxs.i);
     }
     template <class M>
-    constexpr iterator insert_or_assign(const_iterator /*hint*/,
+    constexpr iterator insert_or_assign(const_iterator hint,
                                         K&& key,
                                         M&& obj,
                                         const std_transition::source_location& loc =
                                             std_transition::source_location::current()) noexcept
         requires std::is_assignable_v<mapped_type&, M&&>
     {
-        return insert_or_assign(std::move(key), std::forward<M>(obj), loc).first;
+        NodeIndexAndParentIndex np_idxs = index_of_node_with_parent_near(hint, key);
+        if (tree().contains_at(np_idxs.i))
+        {
+            tree().node_at(np_idxs.i).value() = std::forward<M>(obj);
+            tree().update_subtree_data_after_value_change_at(np_idxs.i);
+            return create_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, std::move(key), std::forward<M>(obj));
+        return create_iterator(np_idxs.i);
     }
 
     template <class... Args>
@@ -415,19 +526,76 @@ public:
         tree().insert_new_at(np_idxs, std::move(key), std::forward<Args>(args)...);
         return {create_iterator(np_idxs.i), true};
     }
+    // The hinted overloads only compare `key` with `hint` and its neighbour if `key` goes right
+    // before `hint`, or right after it, e.g. `end()` when keys come in increasing order. Any other
+    // hint costs a few more comparisons than no hint.
     template <class... Args>
-    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator hint,
                                                     const K& key,
                                                     Args&&... args) noexcept
     {
-        return try_emplace(key, std::forward<Args>(args)...);
+        NodeIndexAndParentIndex np_idxs = index_of_node_with_parent_near(hint, key);
+        if (tree().contains_at(np_idxs.i))
+        {
+            return {create_iterator(np_idxs.i), false};
+        }
+
+        check_not_full(std_transition::source_location::current());
+        tree().insert_new_at(np_idxs, key, std::forward<Args>(args)...);
+        return {create_iterator(np_idxs.i), true};
     }
     template <class... Args>
-    constexpr std::pair<iterator, bool> try_emplace(const_iterator /*hint*/,
+    constexpr std::pair<iterator, bool> try_emplace(const_iterator hint,
                                                     K&& key,
                                                     Args&&... args) noexcept
     {
-        return try_emplace(std::move(key), std::forward<Args>(args)...);
+        NodeIndexAndParentIndex np_idxs = index_of_node_with_parent_near(hint, key);
+        if (tree().contains_at(np_idxs.i))
+        {
+            return {create_iterator(np_idxs.i), false};
+        }
+
+        check_not_full(std_transition::source_location::current());
+        tree().insert_new_at(np_idxs, std::move(key), std::forward<Args>(args)...);
+        return {create_iterator(np_idxs.i), true};
+    }
+
+    /**
+     * Inserts `key`, which must be greater than every key in the map, with a single comparison to
+     * check that. For filling a map in increasing key order, e.g. ingesting a time series.
+     */
+    template <class... Args>
+    constexpr iterator append_max(const K& key, Args&&... args) noexcept
+    {
+        NodeIndexAndParentIndex np_idxs = tree().index_of_node_with_parent_past_max(key);
+        check_not_full(std_transition::source_location::current());
+        tree().insert_new_at(np_idxs, key, std::forward<Args>(args)...);
+        return create_iterator(np_idxs.i);
+    }
+    template <class... Args>
+    constexpr iterator append_max(K&& key, Args&&... args) noexcept
+    {
+        NodeIndexAndParentIndex np_idxs = tree().index_of_node_with_parent_past_max(key);
+        check_not_full(std_transition::source_location::current());
+        tree().insert_new_at(np_idxs, std::move(key), std::forward<Args>(args)...);
+        return create_iterator(np_idxs.i);
+    }
+    // Same as `append_max()`, for a `key` that is less than every key in the map
+    template <class... Args>
+    constexpr iterator prepend_min(const K& key, Args&&... args) noexcept
+    {
+        NodeIndexAndParentIndex np_idxs = tree().index_of_node_with_parent_before_min(key);
+        check_not_full(std_transition::source_location::current());
+        tree().insert_new_at(np_idxs, key, std::forward<Args>(args)...);
+        return create_iterator(np_idxs.i);
+    }
+    template <class... Args>
+    constexpr iterator prepend_min(K&& key, Args&&... args) noexcept
+    {
+        NodeIndexAndParentIndex np_idxs = tree().index_of_node_with_parent_before_min(key);
+        check_not_full(std_transition::source_location::current());
+        tree().insert_new_at(np_idxs, std::move(key), std::forward<Args>(args)...);
+        return create_iterator(np_idxs.i);
     }
 
     template <class... Args>
@@ -438,10 +606,11 @@ public:
                                                                     std::forward<Args>(args)...);
     }
     template <class... Args>
-    constexpr std::pair<iterator, bool> emplace_hint(const_iterator /*hint*/,
-                                                     Args&&... args) noexcept
+        requires(sizeof...(Args) >= 1 and sizeof...(Args) <= 3)
+    constexpr std::pair<iterator, bool> emplace_hint(const_iterator hint, Args&&... args) noexcept
     {
-        return emplace(std::forward<Args>(args)...);
+        return emplace_detail::emplace_hint_in_terms_of_try_emplace_impl(
+            *this, hint, std::forward<Args>(args)...);
     }
 
     constexpr iterator erase(const_iterator pos) noexcept
@@ -468,6 +637,368 @@ public:
 
     constexpr size_type erase(const K& key) noexcept { return tree().delete_node(key); }
 
+    template <class K0>
+    constexpr size_type erase(K0&& key) noexcept
+        requires(IsTransparent<Compare> and !std::is_convertible_v<K0 &&, iterator> and
+                 !std::is_convertible_v<K0 &&, const_iterator>)
+    {
+        return tree().delete_node(key);
+    }
+
+    /**
+     * Erases every entry whose key is less than `key` and returns how many. The tree is split at
+     * `key` in O(log n), then the erased entries are destroyed without rebalancing in between, so
+     * this is O(log n + k) for k erased entries, instead of O(k log n) for
+     * `erase(begin(), lower_bound(key))`.
+     */
+    constexpr size_type erase_before(const K& key) noexcept
+    {
+        const size_type old_size = size();
+        tree().delete_nodes_less_than(key);
+        return old_size - size();
+    }
+    template <class K0>
+    constexpr size_type erase_before(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        const size_type old_size = size();
+        tree().delete_nodes_less_than(key);
+        return old_size - size();
+    }
+    // Same as `erase_before()`, for the entries whose key is greater than `key`
+    constexpr size_type erase_after(const K& key) noexcept
+    {
+        const size_type old_size = size();
+        tree().delete_nodes_greater_than(key);
+        return old_size - size();
+    }
+    template <class K0>
+    constexpr size_type erase_after(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        const size_type old_size = size();
+        tree().delete_nodes_greater_than(key);
+        return old_size - size();
+    }
+
+    /**
+     * Moves the entry at `pos` out of the map and into the returned handle, which can be inserted
+     * into a `FixedMap` of any capacity.
+     */
+    constexpr node_type extract(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const NodeIndex index = get_node_index_from_iterator(pos);
+        assert_or_abort(tree().contains_at(index));
+        return extract_at(index);
+    }
+
+    // Returns an empty handle if `key` is not present
+    constexpr node_type extract(const K& key) noexcept
+    {
+        const NodeIndex index = tree().index_of_node_or_null(key);
+        if (!tree().contains_at(index))
+        {
+            return node_type{};
+        }
+        return extract_at(index);
+    }
+
+    constexpr insert_return_type insert(
+        node_type&& node,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        if (node.empty())
+        {
+            return {end(), false, node_type{}};
+        }
+
+        NodeIndexAndParentIndex np_idxs =
+            tree().index_of_node_with_parent(std::as_const(node).key());
+        if (tree().contains_at(np_idxs.i))
+        {
+            return {create_iterator(np_idxs.i), false, std::move(node)};
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, std::move(node.key()), std::move(node.mapped()));
+        node = node_type{};
+        return {create_iterator(np_idxs.i), true, node_type{}};
+    }
+
+    constexpr iterator insert(const_iterator hint,
+                              node_type&& node,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        if (node.empty())
+        {
+            return end();
+        }
+
+        NodeIndexAndParentIndex np_idxs =
+            index_of_node_with_parent_near(hint, std::as_const(node).key());
+        if (tree().contains_at(np_idxs.i))
+        {
+            return create_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, std::move(node.key()), std::move(node.mapped()));
+        node = node_type{};
+        return create_iterator(np_idxs.i);
+    }
+
+    /**
+     * Moves every entry of `source` whose key is not present into this map. Entries whose key is
+     * present stay in `source`. The key and value are moved from the node of `source` straight
+     * into a new node, without going through a node handle.
+     */
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Compare2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::MapChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void merge(FixedMap<K,
+                                  V,
+                                  MAXIMUM_SIZE_2,
+                                  Compare2,
+                                  COMPACTNESS_2,
+                                  StorageTemplate2,
+                                  CheckingType2,
+                                  Augmentation2>& source,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        auto& source_tree = source.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_;
+        NodeIndex source_index = source_tree.index_of_min_at();
+        while (source_index != NULL_INDEX)
+        {
+            auto source_node = source_tree.node_at(source_index);
+            NodeIndexAndParentIndex np_idxs =
+                tree().index_of_node_with_parent(std::as_const(source_node).key());
+            if (tree().contains_at(np_idxs.i))
+            {
+                source_index = source_tree.index_of_successor_at(source_index);
+                continue;
+            }
+
+            check_not_full(loc);
+            tree().insert_new_at(
+                np_idxs, std::move(source_node.key()), std::move(source_node.value()));
+            source_index = source_tree.delete_at_and_return_successor(source_index);
+        }
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Compare2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::MapChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void merge(FixedMap<K,
+                                  V,
+                                  MAXIMUM_SIZE_2,
+                                  Compare2,
+                                  COMPACTNESS_2,
+                                  StorageTemplate2,
+                                  CheckingType2,
+                                  Augmentation2>&& source,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        merge(source, loc);
+    }
+
+    /**
+     * Moves the entries whose key is not less than `key` into the returned map, so that this map
+     * keeps the left part and the returned one holds the right part. The entries that stay are
+     * not touched, and the moved ones are erased from this map in one go, as with `erase_after()`.
+     * O(log n + k) for k moved entries, or O(log n + k log k) with an `Augmentation`, as for
+     * `join()`.
+     */
+    [[nodiscard]] constexpr FixedMap split(const K& key) noexcept
+    {
+        FixedMap right{tree().IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_};
+        tree().move_nodes_not_less_than_into(key, right.tree());
+        return right;
+    }
+    template <class K0>
+    [[nodiscard]] constexpr FixedMap split(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        FixedMap right{tree().IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_};
+        tree().move_nodes_not_less_than_into(key, right.tree());
+        return right;
+    }
+
+    /**
+     * Moves every entry of `other` into this map. The keys of `other` must all be greater than the
+     * keys of this map, or all less, e.g. the two parts of a `split()`. Unlike `merge()`, no key
+     * is looked up: every entry goes right next to the one moved before it. O(k) amortized for k
+     * moved entries. With an `Augmentation`, every moved entry also updates the data of the nodes
+     * on its path to the root, so this becomes O(k log n). `other` is left empty. Both maps must
+     * use the same comparator, as the entries of `other` are taken in its own order.
+     */
+    template <std::size_t MAXIMUM_SIZE_2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::MapChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void join(FixedMap<K,
+                                 V,
+                                 MAXIMUM_SIZE_2,
+                                 Compare,
+                                 COMPACTNESS_2,
+                                 StorageTemplate2,
+                                 CheckingType2,
+                                 Augmentation2>& other,
+                        const std_transition::source_location& loc =
+                            std_transition::source_location::current()) noexcept
+    {
+        tree().join_with(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_,
+                         [this, &loc]() { check_not_full(loc); });
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::MapChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void join(FixedMap<K,
+                                 V,
+                                 MAXIMUM_SIZE_2,
+                                 Compare,
+                                 COMPACTNESS_2,
+                                 StorageTemplate2,
+                                 CheckingType2,
+                                 Augmentation2>&& other,
+                        const std_transition::source_location& loc =
+                            std_transition::source_location::current()) noexcept
+    {
+        join(other, loc);
+    }
+
+    /**
+     * Inserts a copy of the entries of `other` whose key is not in this map. The entries already
+     * here keep their value. `other` must be ordered by the same comparator. Unlike
+     * `std::set_union()` over the iterators, the runs of keys that are only in this map are
+     * skipped instead of walked, so this takes O(m log(n/m + 1)) comparisons for sizes m <= n.
+     */
+    template <std::size_t MAXIMUM_SIZE_2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::MapChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void set_union(const FixedMap<K,
+                                            V,
+                                            MAXIMUM_SIZE_2,
+                                            Compare,
+                                            COMPACTNESS_2,
+                                            StorageTemplate2,
+                                            CheckingType2,
+                                            Augmentation2>& other,
+                             const std_transition::source_location& loc =
+                                 std_transition::source_location::current()) noexcept
+    {
+        tree().insert_nodes_not_present_from(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_,
+                                             [this, &loc]() { check_not_full(loc); });
+    }
+
+    // Erases the entries whose key is not in `other`, whatever its mapped type. Same requirements
+    // and complexity as `set_union()`.
+    template <class V2,
+              std::size_t MAXIMUM_SIZE_2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::MapChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void set_intersection(const FixedMap<K,
+                                                   V2,
+                                                   MAXIMUM_SIZE_2,
+                                                   Compare,
+                                                   COMPACTNESS_2,
+                                                   StorageTemplate2,
+                                                   CheckingType2,
+                                                   Augmentation2>& other) noexcept
+    {
+        tree().delete_nodes_not_in(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_);
+    }
+
+    // Erases the entries whose key is in `other`, whatever its mapped type. Same requirements and
+    // complexity as `set_union()`.
+    template <class V2,
+              std::size_t MAXIMUM_SIZE_2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::MapChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void set_difference(const FixedMap<K,
+                                                 V2,
+                                                 MAXIMUM_SIZE_2,
+                                                 Compare,
+                                                 COMPACTNESS_2,
+                                                 StorageTemplate2,
+                                                 CheckingType2,
+                                                 Augmentation2>& other) noexcept
+    {
+        tree().delete_nodes_in(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_);
+    }
+
+    // Whether every key of `other` is in this map, whatever the mapped values. Same requirements
+    // and complexity as `set_union()`.
+    template <class V2,
+              std::size_t MAXIMUM_SIZE_2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::MapChecking<K> CheckingType2,
+              class Augmentation2>
+    [[nodiscard]] constexpr bool includes(const FixedMap<K,
+                                                         V2,
+                                                         MAXIMUM_SIZE_2,
+                                                         Compare,
+                                                         COMPACTNESS_2,
+                                                         StorageTemplate2,
+                                                         CheckingType2,
+                                                         Augmentation2>& other) const noexcept
+    {
+        return tree().contains_all_nodes_of(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_);
+    }
+
     [[nodiscard]] constexpr iterator find(const K& key) noexcept
     {
         const NodeIndex index = tree().index_of_node_or_null(key);
@@ -613,6 +1144,152 @@ public:
         return equal_range_impl(np_idxs);
     }
 
+    /**
+     * Iterator to the entry that has `rank` entries before it, or `end()` if there are not that
+     * many entries. O(log n) instead of advancing `begin()` `rank` times.
+     * Requires `OrderStatisticTreeAugmentation`.
+     */
+    [[nodiscard]] constexpr iterator nth(const size_type rank) noexcept
+        requires HAS_SUBTREE_SIZES
+    {
+        return create_iterator(tree().index_of_nth(rank));
+    }
+    [[nodiscard]] constexpr const_iterator nth(const size_type rank) const noexcept
+        requires HAS_SUBTREE_SIZES
+    {
+        return create_const_iterator(tree().index_of_nth(rank));
+    }
+
+    /**
+     * Number of keys that are less than `key`, i.e. the position of `lower_bound(key)`. O(log n).
+     * Requires `OrderStatisticTreeAugmentation`.
+     */
+    [[nodiscard]] constexpr size_type rank(const K& key) const noexcept
+        requires HAS_SUBTREE_SIZES
+    {
+        return tree().rank_of(key);
+    }
+    template <class K0>
+    [[nodiscard]] constexpr size_type rank(const K0& key) const noexcept
+        requires HAS_SUBTREE_SIZES && IsTransparent<Compare>
+    {
+        return tree().rank_of(key);
+    }
+
+    /**
+     * Number of keys in [from, to). O(log n).
+     * Requires `OrderStatisticTreeAugmentation`.
+     */
+    [[nodiscard]] constexpr size_type count_in_range(const K& from, const K& to) const noexcept
+        requires HAS_SUBTREE_SIZES
+    {
+        return count_in_range_impl(from, to);
+    }
+    template <class K0, class K1>
+    [[nodiscard]] constexpr size_type count_in_range(const K0& from, const K1& to) const noexcept
+        requires HAS_SUBTREE_SIZES && IsTransparent<Compare>
+    {
+        return count_in_range_impl(from, to);
+    }
+
+    /**
+     * `Augmentation::combine()` of the data of every entry, in key order. O(1).
+     * Requires an `Augmentation` that is a `TreeAggregatePolicy`.
+     *
+     * If the data of an entry depends on its value, the values are const: `at()`, `operator[]`
+     * and the iterators give const references, and the values change through `modify()` or
+     * `insert_or_assign()`, which keep the aggregates up to date.
+     */
+    [[nodiscard]] constexpr auto aggregate() const noexcept
+        requires HAS_AGGREGATE
+    {
+        return tree().aggregate_of_all();
+    }
+
+    /**
+     * Same as `aggregate()`, for the entries whose key is in [from, to). O(log n).
+     */
+    [[nodiscard]] constexpr auto aggregate_in_range(const K& from, const K& to) const noexcept
+        requires HAS_AGGREGATE
+    {
+        return tree().aggregate_of_range(from, to);
+    }
+    template <class K0, class K1>
+    [[nodiscard]] constexpr auto aggregate_in_range(const K0& from, const K1& to) const noexcept
+        requires HAS_AGGREGATE && IsTransparent<Compare>
+    {
+        return tree().aggregate_of_range(from, to);
+    }
+
+    /**
+     * Same as `aggregate()`, for the entries whose key is less than `key`. O(log n).
+     */
+    [[nodiscard]] constexpr auto aggregate_before(const K& key) const noexcept
+        requires HAS_AGGREGATE
+    {
+        return tree().aggregate_of_keys_less_than(key);
+    }
+    template <class K0>
+    [[nodiscard]] constexpr auto aggregate_before(const K0& key) const noexcept
+        requires HAS_AGGREGATE && IsTransparent<Compare>
+    {
+        return tree().aggregate_of_keys_less_than(key);
+    }
+
+    /**
+     * First entry at or after `first` whose own data (see `Augmentation::lift()`) satisfies
+     * `predicate`, or `end()`. Subtrees whose aggregate does not satisfy `predicate` are skipped
+     * as a whole, so `predicate(combine(a, b))` must be `predicate(a) || predicate(b)`, which is
+     * the case for `x > bound` on a maximum. O(log n).
+     *
+     * For example, with intervals keyed by their start and the largest end as the aggregate, the
+     * first interval that overlaps [from, to) is the first one that ends after `from`, if it
+     * starts before `to`.
+     */
+    template <class Predicate>
+    [[nodiscard]] constexpr iterator find_first_by_aggregate(const_iterator first,
+                                                             Predicate predicate) noexcept
+        requires HAS_AGGREGATE
+    {
+        return create_iterator(find_first_by_aggregate_impl(first, predicate));
+    }
+    template <class Predicate>
+    [[nodiscard]] constexpr const_iterator find_first_by_aggregate(
+        const_iterator first, Predicate predicate) const noexcept
+        requires HAS_AGGREGATE
+    {
+        return create_const_iterator(find_first_by_aggregate_impl(first, predicate));
+    }
+
+    /**
+     * Calls `function` with a mutable reference to the value at `pos`, which must not be `end()`,
+     * then updates the aggregates of the entry and of the subtrees that contain it. This is how
+     * values change in place when the aggregates depend on them. O(log n).
+     */
+    template <class Function>
+    constexpr void modify(const_iterator pos, Function function) noexcept
+        requires std::invocable<Function&, V&>
+    {
+        assert_or_abort(pos != cend());
+        const NodeIndex index = get_node_index_from_iterator(pos);
+        function(tree().node_at(index).value());
+        if constexpr (HAS_AGGREGATE)
+        {
+            tree().update_subtree_data_after_value_change_at(index);
+        }
+    }
+
+    /**
+     * Updates the aggregates after the value at `pos` changed without `modify()`, e.g. through a
+     * `mutable` member. `pos` must not be `end()`. O(log n).
+     */
+    constexpr void update_aggregate(const_iterator pos) noexcept
+        requires HAS_AGGREGATE
+    {
+        assert_or_abort(pos != cend());
+        tree().update_subtree_data_after_value_change_at(get_node_index_from_iterator(pos));
+    }
+
     template <std::size_t MAXIMUM_SIZE_2,
               class Compare2,
               fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
@@ -621,14 +1298,16 @@ public:
                         ,
                         std::size_t>
               typename StorageTemplate2,
-              customize::MapChecking<K> CheckingType2>
+              customize::MapChecking<K> CheckingType2,
+              class Augmentation2>
     [[nodiscard]] constexpr bool operator==(const FixedMap<K,
                                                            V,
                                                            MAXIMUM_SIZE_2,
                                                            Compare2,
                                                            COMPACTNESS_2,
                                                            StorageTemplate2,
-                                                           CheckingType2>& other) const
+                                                           CheckingType2,
+                                                           Augmentation2>& other) const
     {
         if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2)
         {
@@ -680,6 +1359,15 @@ private:
         }
     }
 
+    constexpr node_type extract_at(const NodeIndex& index) noexcept
+    {
+        auto node = tree().node_at(index);
+        node_type extracted{
+            node_handle_detail::EXTRACTED, std::move(node.key()), std::move(node.value())};
+        tree().delete_at_and_return_successor(index);
+        return extracted;
+    }
+
     [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range_impl(
         const NodeIndexAndParentIndex& np_idxs_idxs) noexcept
     {
@@ -697,10 +1385,39 @@ private:
         return {create_const_iterator(l_idx), create_const_iterator(r_idx)};
     }
 
-    [[nodiscard]] constexpr NodeIndex get_node_index_from_iterator(const_iterator pos)
+    template <class K0, class K1>
+    [[nodiscard]] constexpr size_type count_in_range_impl(const K0& from, const K1& to) const
+    {
+        const size_type rank_of_from = tree().rank_of(from);
+        const size_type rank_of_to = tree().rank_of(to);
+        return rank_of_to > rank_of_from ? rank_of_to - rank_of_from : 0;
+    }
+
+    template <class Predicate>
+    [[nodiscard]] constexpr NodeIndex find_first_by_aggregate_impl(
+        const_iterator first, const Predicate& predicate) const
+    {
+        if (first == cend())
+        {
+            return NULL_INDEX;
+        }
+        return tree().index_of_first_matching_at_or_after(get_node_index_from_iterator(first),
+                                                          predicate);
+    }
+
+    [[nodiscard]] constexpr NodeIndex get_node_index_from_iterator(const_iterator pos) const
     {
         return pos.template private_reference_provider<PairProvider<true>>().current_index();
     }
+
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndexAndParentIndex index_of_node_with_parent_near(
+        const_iterator hint, const K0& key) const
+    {
+        const NodeIndex hint_index =
+            hint == cend() ? NULL_INDEX : get_node_index_from_iterator(hint);
+        return tree().index_of_node_with_parent_near(hint_index, key);
+    }
 };
 
 template <class K,
@@ -713,10 +1430,16 @@ here. clang accepts it */
                     ,
                     std::size_t>
           typename StorageTemplate,
-          customize::MapChecking<K> CheckingType>
-[[nodiscard]] constexpr bool is_full(
-    const FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>&
-        container)
+          customize::MapChecking<K> CheckingType,
+          class Augmentation>
+[[nodiscard]] constexpr bool is_full(const FixedMap<K,
+                                                   V,
+                                                   MAXIMUM_SIZE,
+                                                   Compare,
+                                                   COMPACTNESS,
+                                                   StorageTemplate,
+                                                   CheckingType,
+                                                   Augmentation>& container)
 {
     return container.size() >= container.max_size();
 }
@@ -732,13 +1455,25 @@ here. clang accepts it */
                     std::size_t>
           typename StorageTemplate,
           customize::MapChecking<K> CheckingType,
+          class Augmentation,
           class Predicate>
-constexpr
-    typename FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>::
-        size_type
-        erase_if(FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>&
-                     container,
-                 Predicate predicate)
+constexpr typename FixedMap<K,
+                            V,
+                            MAXIMUM_SIZE,
+                            Compare,
+                            COMPACTNESS,
+                            StorageTemplate,
+                            CheckingType,
+                            Augmentation>::size_type
+erase_if(FixedMap<K,
+                  V,
+                  MAXIMUM_SIZE,
+                  Compare,
+                  COMPACTNESS,
+                  StorageTemplate,
+                  CheckingType,
+                  Augmentation>& container,
+         Predicate predicate)
 {
     return erase_if_detail::erase_if_impl(container, predicate);
 }
@@ -842,10 +1577,16 @@ here. clang accepts it */
               ,
               std::size_t>
     typename StorageTemplate,
-    fixed_containers::customize::MapChecking<K> CheckingType>
-struct tuple_size<
-    fixed_containers::
-        FixedMap<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>>
+    fixed_containers::customize::MapChecking<K> CheckingType,
+    class Augmentation>
+struct tuple_size<fixed_containers::FixedMap<K,
+                                             V,
+                                             MAXIMUM_SIZE,
+                                             Compare,
+                                             COMPACTNESS,
+                                             StorageTemplate,
+                                             CheckingType,
+                                             Augmentation>>
   : std::integral_constant<std::size_t, 0>
 {
     // Implicit Structured Binding due to the fields being public is disabled
@@ -0,0 +1,420 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/erase_if.hpp"
+#include "fixed_containers/forward_iterator.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace fixed_containers
+{
+
+/**
+ * Like `FixedMapAdapter`, but a key can be inserted any number of times. All the values of one key
+ * are next to each other in iteration order, so `equal_range()` is a single run of the table.
+ */
+template <typename K, typename V, typename TableImpl, typename CheckingType>
+class FixedMultiMapAdapter
+{
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using reference = std::pair<const K&, V&>;
+    using const_reference = std::pair<const K&, const V&>;
+    using pointer = std::add_pointer_t<reference>;
+    using const_pointer = std::add_pointer_t<const_reference>;
+    using hasher = typename TableImpl::HashType;
+    using key_equal = typename TableImpl::KeyEqualType;
+
+private:
+    using TableIndex = typename TableImpl::OpaqueIndexType;
+    using TableIteratedIndex = typename TableImpl::OpaqueIteratedType;
+
+    template <bool IS_CONST>
+    class PairProvider
+    {
+        friend class PairProvider<!IS_CONST>;
+        friend class FixedMultiMapAdapter;
+        using ConstOrMutableTable = std::conditional_t<IS_CONST, const TableImpl, TableImpl>;
+
+    private:
+        ConstOrMutableTable* table_;
+        TableIteratedIndex current_index_;
+
+        constexpr PairProvider(ConstOrMutableTable* const table,
+                               const TableIteratedIndex& value_table_index)
+          : table_(table)
+          , current_index_(value_table_index)
+        {
+        }
+
+    public:
+        constexpr PairProvider() noexcept
+          : table_(nullptr)
+          , current_index_(TableImpl::invalid_index())
+        {
+        }
+
+        constexpr PairProvider(const PairProvider&) = default;
+        constexpr PairProvider(PairProvider&&) noexcept = default;
+        constexpr PairProvider& operator=(const PairProvider&) = default;
+        constexpr PairProvider& operator=(PairProvider&&) noexcept = default;
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr PairProvider(const PairProvider<IS_CONST_2>& mutable_other) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : PairProvider{mutable_other.table_, mutable_other.current_index_}
+        {
+        }
+
+        constexpr void advance() noexcept { current_index_ = table_->next_of(current_index_); }
+
+        [[nodiscard]] constexpr std::conditional_t<IS_CONST, const_reference, reference> get()
+            const noexcept
+        {
+            // auto for auto const/mut
+            return {table_->key_at(current_index_), table_->value_at(current_index_)};
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const PairProvider<IS_CONST2>& other) const noexcept
+        {
+            return table_ == other.table_ && current_index_ == other.current_index_;
+        }
+    };
+
+    template <IteratorConstness CONSTNESS>
+    using Iterator = ForwardIterator<PairProvider<true>, PairProvider<false>, CONSTNESS>;
+
+public:
+    using const_iterator = Iterator<IteratorConstness::CONSTANT_ITERATOR>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR>;
+
+    using size_type = std::size_t;
+    using difference_type = ptrdiff_t;
+
+public:
+    static constexpr size_type static_max_size() noexcept { return TableImpl::CAPACITY; }
+
+public:
+    TableImpl IMPLEMENTATION_DETAIL_DO_NOT_USE_table_;
+
+private:
+    constexpr TableImpl& table() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_table_; }
+
+    [[nodiscard]] constexpr const TableImpl& table() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_table_;
+    }
+
+public:
+    template <typename... Args>
+    explicit constexpr FixedMultiMapAdapter(Args&&... args)
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_table_(std::forward<Args>(args)...)
+    {
+    }
+
+    constexpr FixedMultiMapAdapter() = default;
+
+public:
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return const_iterator{PairProvider<true>{std::addressof(table()), table().begin_index()}};
+    }
+
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return const_iterator{PairProvider<true>{std::addressof(table()), table().end_index()}};
+    }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr iterator begin() noexcept
+    {
+        return iterator{PairProvider<false>{std::addressof(table()), table().begin_index()}};
+    }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr iterator end() noexcept
+    {
+        return iterator{PairProvider<false>{std::addressof(table()), table().end_index()}};
+    }
+
+    [[nodiscard]] constexpr size_type max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return table().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return table().size() == 0; }
+
+    [[nodiscard]] constexpr const hasher& hash_function() const noexcept
+    {
+        return table().hash_function();
+    }
+    [[nodiscard]] constexpr const key_equal& key_eq() const noexcept { return table().key_eq(); }
+
+    // How far the entries are from their home buckets, only available for tables that can tell
+    [[nodiscard]] constexpr auto statistics() const noexcept
+        requires requires(const TableImpl& table_impl) { table_impl.statistics(); }
+    {
+        return table().statistics();
+    }
+
+    constexpr void clear() noexcept { table().clear(); }
+
+    constexpr iterator insert(const value_type& pair,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        return emplace_impl(loc, pair.first, pair.first, pair.second);
+    }
+
+    constexpr iterator insert(value_type&& pair,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        return emplace_impl(loc, pair.first, std::move(pair.first), std::move(pair.second));
+    }
+
+    constexpr iterator insert(const_iterator /*hint*/,
+                              const value_type& pair,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        return insert(pair, loc);
+    }
+
+    constexpr iterator insert(const_iterator /*hint*/,
+                              value_type&& pair,
+                              const std_transition::source_location& loc =
+                                  std_transition::source_location::current()) noexcept
+    {
+        return insert(std::move(pair), loc);
+    }
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    template <class... Args>
+    constexpr iterator emplace(Args&&... args) noexcept
+    {
+        return insert(value_type{std::forward<Args>(args)...});
+    }
+
+    template <class... Args>
+    constexpr iterator emplace_hint(const_iterator /*hint*/, Args&&... args) noexcept
+    {
+        return emplace(std::forward<Args>(args)...);
+    }
+
+    constexpr iterator erase(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const PairProvider<true>& provider =
+            pos.template private_reference_provider<const PairProvider<true>&>();
+        // Looking up the key would find the first of its values, not necessarily this one
+        const TableIteratedIndex next_idx =
+            table().erase(table().opaque_index_from_iterated(provider.current_index_));
+        return iterator{PairProvider<false>{std::addressof(table()), next_idx}};
+    }
+
+    constexpr iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        const PairProvider<true>& start =
+            first.template private_reference_provider<const PairProvider<true>&>();
+        const PairProvider<true>& end =
+            last.template private_reference_provider<const PairProvider<true>&>();
+        const TableIteratedIndex next_idx =
+            table().erase_range(start.current_index_, end.current_index_);
+        return iterator{PairProvider<false>{std::addressof(table()), next_idx}};
+    }
+
+    constexpr size_type erase(const key_type& key) noexcept
+    {
+        const std::uint64_t key_hash = table().hash(key);
+        size_type erased = 0;
+        // Each erasure shifts the next value with this key into the bucket that was just emptied
+        for (TableIndex idx = table().opaque_index_of_hash(key, key_hash); table().exists(idx);
+             idx = table().opaque_index_of_hash(key, key_hash))
+        {
+            table().erase(idx);
+            erased++;
+        }
+        return erased;
+    }
+
+    [[nodiscard]] constexpr iterator find(const K& key) noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return end();
+        }
+        return create_iterator(table().iterated_index_from(idx));
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return cend();
+        }
+        return create_const_iterator(table().iterated_index_from(idx));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        return table().exists(idx);
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return 0;
+        }
+        return table().equal_count(idx);
+    }
+
+    [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range(const K& key) noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return {end(), end()};
+        }
+        return {create_iterator(table().iterated_index_from(idx)),
+                create_iterator(table().end_of_equal_range(idx))};
+    }
+
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return {cend(), cend()};
+        }
+        return {create_const_iterator(table().iterated_index_from(idx)),
+                create_const_iterator(table().end_of_equal_range(idx))};
+    }
+
+    // Equal if every key has the same values in both, in any order
+    template <typename MapImpl2, typename CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedMultiMapAdapter<K, V, MapImpl2, CheckingType2>& other) const
+    {
+        if (size() != other.size())
+        {
+            return false;
+        }
+        for (const_iterator it = cbegin(); it != cend();)
+        {
+            // `it` is always at the start of the values of its key
+            const const_iterator range_end = equal_range(it->first).second;
+            const auto other_range = other.equal_range(it->first);
+            const bool same_values = std::is_permutation(
+                it,
+                range_end,
+                other_range.first,
+                other_range.second,
+                [](const auto& lhs, const auto& rhs) { return lhs.second == rhs.second; });
+            if (!same_values)
+            {
+                return false;
+            }
+            it = range_end;
+        }
+        return true;
+    }
+
+private:
+    template <typename... Args>
+    constexpr iterator emplace_impl(const std_transition::source_location& loc,
+                                    const K& key,
+                                    Args&&... args) noexcept
+    {
+        check_not_full(loc);
+        TableIndex idx = table().opaque_index_of(key);
+        if (table().exists(idx))
+        {
+            idx = table().emplace_equal(idx, std::forward<Args>(args)...);
+        }
+        else
+        {
+            idx = table().emplace(idx, std::forward<Args>(args)...);
+        }
+        return create_iterator(table().iterated_index_from(idx));
+    }
+
+    constexpr iterator create_iterator(const TableIteratedIndex& value_index) noexcept
+    {
+        return iterator{PairProvider<false>{std::addressof(table()), value_index}};
+    }
+
+    [[nodiscard]] constexpr const_iterator create_const_iterator(
+        const TableIteratedIndex& value_index) const noexcept
+    {
+        return const_iterator{PairProvider<true>{std::addressof(table()), value_index}};
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(table().size() < TableImpl::CAPACITY))
+        {
+            CheckingType::length_error(TableImpl::CAPACITY + 1, loc);
+        }
+    }
+};
+
+template <typename K, typename V, typename TableImpl, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedMultiMapAdapter<K, V, TableImpl, CheckingType>& container)
+{
+    return container.size() >= container.max_size();
+}
+
+template <typename K, typename V, typename TableImpl, typename CheckingType, typename Predicate>
+constexpr typename FixedMultiMapAdapter<K, V, TableImpl, CheckingType>::size_type erase_if(
+    FixedMultiMapAdapter<K, V, TableImpl, CheckingType>& container, Predicate predicate)
+{
+    if constexpr (erase_if_detail::TableWithEraseIfAt<TableImpl>)
+    {
+        using Reference = typename FixedMultiMapAdapter<K, V, TableImpl, CheckingType>::reference;
+        TableImpl& table = container.IMPLEMENTATION_DETAIL_DO_NOT_USE_table_;
+        return table.erase_if_at(
+            [&table, &predicate](const typename TableImpl::OpaqueIteratedType& value_index)
+            {
+                return predicate(Reference{table.key_at(value_index), table.value_at(value_index)});
+            });
+    }
+    else
+    {
+        return erase_if_detail::erase_if_impl(container, predicate);
+    }
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,351 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/erase_if.hpp"
+#include "fixed_containers/forward_iterator.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace fixed_containers
+{
+
+/**
+ * Like `FixedSetAdapter`, but a key can be inserted any number of times. All the copies of one key
+ * are next to each other in iteration order, so `equal_range()` is a single run of the table.
+ */
+template <typename K, typename TableImpl, typename CheckingType>
+class FixedMultiSetAdapter
+{
+public:
+    using key_type = K;
+    using value_type = K;
+    using reference = const K&;
+    using const_reference = const K&;
+    using pointer = std::add_pointer_t<reference>;
+    using const_pointer = std::add_pointer_t<const_reference>;
+    using hasher = typename TableImpl::HashType;
+    using key_equal = typename TableImpl::KeyEqualType;
+
+private:
+    using TableIndex = typename TableImpl::OpaqueIndexType;
+    using TableIteratedIndex = typename TableImpl::OpaqueIteratedType;
+
+    class ReferenceProvider
+    {
+        friend class FixedMultiSetAdapter;
+
+    private:
+        const TableImpl* table_;
+        TableIteratedIndex current_index_;
+
+        constexpr ReferenceProvider(const TableImpl* const table,
+                                    const TableIteratedIndex& value_table_index)
+          : table_(table)
+          , current_index_(value_table_index)
+        {
+        }
+
+    public:
+        constexpr ReferenceProvider() noexcept
+          : table_(nullptr)
+          , current_index_(TableImpl::invalid_index())
+        {
+        }
+
+        constexpr void advance() noexcept { current_index_ = table_->next_of(current_index_); }
+
+        [[nodiscard]] constexpr const_reference get() const noexcept
+        {
+            return table_->key_at(current_index_);
+        }
+
+        constexpr bool operator==(const ReferenceProvider& other) const noexcept = default;
+    };
+
+    template <IteratorConstness CONSTNESS>
+    using Iterator = ForwardIterator<ReferenceProvider, ReferenceProvider, CONSTNESS>;
+
+public:
+    using const_iterator = Iterator<IteratorConstness::CONSTANT_ITERATOR>;
+    using iterator = const_iterator;
+
+    using size_type = std::size_t;
+    using difference_type = ptrdiff_t;
+
+public:
+    static constexpr size_type static_max_size() noexcept { return TableImpl::CAPACITY; }
+
+public:
+    TableImpl IMPLEMENTATION_DETAIL_DO_NOT_USE_table_;
+
+private:
+    [[nodiscard]] constexpr TableImpl& table() { return IMPLEMENTATION_DETAIL_DO_NOT_USE_table_; }
+
+    [[nodiscard]] constexpr const TableImpl& table() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_table_;
+    }
+
+public:
+    template <typename... Args>
+    explicit constexpr FixedMultiSetAdapter(Args&&... args)
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_table_(std::forward<Args>(args)...)
+    {
+    }
+
+    constexpr FixedMultiSetAdapter() = default;
+
+public:
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(table().begin_index());
+    }
+
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return create_const_iterator(table().end_index());
+    }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
+
+    [[nodiscard]] constexpr size_type max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return table().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return table().size() == 0; }
+
+    [[nodiscard]] constexpr const hasher& hash_function() const noexcept
+    {
+        return table().hash_function();
+    }
+    [[nodiscard]] constexpr const key_equal& key_eq() const noexcept { return table().key_eq(); }
+
+    // How far the entries are from their home buckets, only available for tables that can tell
+    [[nodiscard]] constexpr auto statistics() const noexcept
+        requires requires(const TableImpl& table_impl) { table_impl.statistics(); }
+    {
+        return table().statistics();
+    }
+
+    constexpr void clear() noexcept { table().clear(); }
+
+    constexpr const_iterator insert(const K& value,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return emplace_impl(loc, value, value);
+    }
+
+    constexpr const_iterator insert(K&& value,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return emplace_impl(loc, value, std::move(value));
+    }
+
+    constexpr const_iterator insert(const_iterator /*hint*/,
+                                    const K& value,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert(value, loc);
+    }
+
+    constexpr const_iterator insert(const_iterator /*hint*/,
+                                    K&& value,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert(std::move(value), loc);
+    }
+
+    template <InputIterator InputIt>
+    constexpr void insert(InputIt first,
+                          InputIt last,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            this->insert(*first, loc);
+        }
+    }
+
+    constexpr void insert(std::initializer_list<value_type> list,
+                          const std_transition::source_location& loc =
+                              std_transition::source_location::current()) noexcept
+    {
+        this->insert(list.begin(), list.end(), loc);
+    }
+
+    template <class... Args>
+    constexpr const_iterator emplace(Args&&... args) noexcept
+    {
+        return insert(K{std::forward<Args>(args)...});
+    }
+
+    template <class... Args>
+    constexpr const_iterator emplace_hint(const_iterator /*hint*/, Args&&... args) noexcept
+    {
+        return emplace(std::forward<Args>(args)...);
+    }
+
+    constexpr const_iterator erase(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const ReferenceProvider& provider =
+            pos.template private_reference_provider<const ReferenceProvider&>();
+        // Looking up the key would find the first of its copies, not necessarily this one
+        const TableIteratedIndex next_idx =
+            table().erase(table().opaque_index_from_iterated(provider.current_index_));
+        return create_const_iterator(next_idx);
+    }
+
+    constexpr const_iterator erase(const_iterator first, const_iterator last) noexcept
+    {
+        const ReferenceProvider& start =
+            first.template private_reference_provider<const ReferenceProvider&>();
+        const ReferenceProvider& end =
+            last.template private_reference_provider<const ReferenceProvider&>();
+        return create_const_iterator(
+            table().erase_range(start.current_index_, end.current_index_));
+    }
+
+    constexpr size_type erase(const key_type& key) noexcept
+    {
+        const std::uint64_t key_hash = table().hash(key);
+        size_type erased = 0;
+        // Each erasure shifts the next copy of this key into the bucket that was just emptied
+        for (TableIndex idx = table().opaque_index_of_hash(key, key_hash); table().exists(idx);
+             idx = table().opaque_index_of_hash(key, key_hash))
+        {
+            table().erase(idx);
+            erased++;
+        }
+        return erased;
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return cend();
+        }
+        return create_const_iterator(table().iterated_index_from(idx));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        return table().exists(idx);
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return 0;
+        }
+        return table().equal_count(idx);
+    }
+
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        if (!table().exists(idx))
+        {
+            return {cend(), cend()};
+        }
+        return {create_const_iterator(table().iterated_index_from(idx)),
+                create_const_iterator(table().end_of_equal_range(idx))};
+    }
+
+    // Equal if every key has the same number of copies in both
+    template <typename TableImpl2, typename CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedMultiSetAdapter<K, TableImpl2, CheckingType2>& other) const
+    {
+        if (size() != other.size())
+        {
+            return false;
+        }
+        for (const_iterator it = cbegin(); it != cend();)
+        {
+            // `it` is always at the start of the copies of its key
+            const std::size_t copies = count(*it);
+            if (other.count(*it) != copies)
+            {
+                return false;
+            }
+            std::advance(it, copies);
+        }
+        return true;
+    }
+
+private:
+    template <typename... Args>
+    constexpr const_iterator emplace_impl(const std_transition::source_location& loc,
+                                          const K& key,
+                                          Args&&... args) noexcept
+    {
+        check_not_full(loc);
+        TableIndex idx = table().opaque_index_of(key);
+        if (table().exists(idx))
+        {
+            idx = table().emplace_equal(idx, std::forward<Args>(args)...);
+        }
+        else
+        {
+            idx = table().emplace(idx, std::forward<Args>(args)...);
+        }
+        return create_const_iterator(table().iterated_index_from(idx));
+    }
+
+    [[nodiscard]] constexpr const_iterator create_const_iterator(
+        const TableIteratedIndex& value_index) const noexcept
+    {
+        return const_iterator{ReferenceProvider{std::addressof(table()), value_index}};
+    }
+
+    constexpr void check_not_full(const std_transition::source_location& loc) const
+    {
+        if (preconditions::test(table().size() < TableImpl::CAPACITY))
+        {
+            CheckingType::length_error(TableImpl::CAPACITY + 1, loc);
+        }
+    }
+};
+
+template <typename K, typename TableImpl, typename CheckingType>
+[[nodiscard]] constexpr bool is_full(
+    const FixedMultiSetAdapter<K, TableImpl, CheckingType>& container)
+{
+    return container.size() >= container.max_size();
+}
+
+template <typename K, typename TableImpl, typename CheckingType, typename Predicate>
+constexpr typename FixedMultiSetAdapter<K, TableImpl, CheckingType>::size_type erase_if(
+    FixedMultiSetAdapter<K, TableImpl, CheckingType>& container, Predicate predicate)
+{
+    if constexpr (erase_if_detail::TableWithEraseIfAt<TableImpl>)
+    {
+        TableImpl& table = container.IMPLEMENTATION_DETAIL_DO_NOT_USE_table_;
+        return table.erase_if_at(
+            [&table, &predicate](const typename TableImpl::OpaqueIteratedType& value_index)
+            { return predicate(table.key_at(value_index)); });
+    }
+    else
+    {
+        return erase_if_detail::erase_if_impl(container, predicate);
+    }
+}
+
+}  // namespace fixed_containers
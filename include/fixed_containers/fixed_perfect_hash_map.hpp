@@ -0,0 +1,626 @@
+#pragma once
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/forward_iterator.hpp"
+#include "fixed_containers/index_width.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/map_entry.hpp"
+#include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/source_location.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::fixed_perfect_hash_map_detail
+{
+// Keys are spread over half as many buckets, each bucket needing one pilot. Fewer pilots make the
+// map smaller, at the cost of a longer search when building it.
+constexpr std::size_t default_pilot_count(std::size_t maximum_size)
+{
+    return std::max<std::size_t>(1, (maximum_size + 1) / 2);
+}
+
+// A seed only fails if a bucket runs out of pilots, which is unlikely to happen twice in a row
+inline constexpr std::uint64_t MAX_SEED_ATTEMPTS = 16;
+}  // namespace fixed_containers::fixed_perfect_hash_map_detail
+
+namespace fixed_containers
+{
+
+/**
+ * Fixed-capacity hash map for keys that are all known when it is built, typically in a `constexpr`
+ * context. Building the map searches for a minimal perfect hash of the keys, PTHash-style: keys
+ * are grouped in `PILOT_COUNT` buckets by their hash, and every bucket gets a pilot that moves its
+ * keys to free slots. A lookup is then one hash, one slot and one key comparison.
+ *
+ * Values can be modified, but keys can't be added or removed after construction. Duplicate keys
+ * are ignored, like `insert()` would. The search needs temporary storage proportional to
+ * `MAXIMUM_SIZE`, so large maps should be built at compile time or outside of the stack.
+ */
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash = wyhash::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          std::size_t PILOT_COUNT =
+              fixed_perfect_hash_map_detail::default_pilot_count(MAXIMUM_SIZE),
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+class FixedPerfectHashMap
+{
+    static_assert(MAXIMUM_SIZE <= std::numeric_limits<std::uint32_t>::max(),
+                  "slots are picked from 32 bits of the hash");
+    static_assert(PILOT_COUNT > 0 && PILOT_COUNT <= std::numeric_limits<std::uint32_t>::max(),
+                  "buckets are picked from 32 bits of the hash");
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<const K, V>;
+    using reference = std::pair<const K&, V&>;
+    using const_reference = std::pair<const K&, const V&>;
+    using pointer = std::add_pointer_t<reference>;
+    using const_pointer = std::add_pointer_t<const_reference>;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+
+    using PilotType =
+        std::conditional_t<(MAXIMUM_SIZE <= std::numeric_limits<std::uint16_t>::max()),
+                           std::uint16_t,
+                           std::uint32_t>;
+
+private:
+    using EntryType = MapEntry<K, V>;
+    using SizeType = index_width::SmallestIndexType<MAXIMUM_SIZE + 1>;
+
+    static constexpr bool TRANSPARENT_LOOKUP = IsTransparent<Hash> && IsTransparent<KeyEqual>;
+
+    template <bool IS_CONST>
+    class PairProvider
+    {
+        friend class PairProvider<!IS_CONST>;
+        friend class FixedPerfectHashMap;
+        using ConstOrMutableMap =
+            std::conditional_t<IS_CONST, const FixedPerfectHashMap, FixedPerfectHashMap>;
+
+    private:
+        ConstOrMutableMap* map_;
+        std::size_t current_index_;
+
+        constexpr PairProvider(ConstOrMutableMap* const map, const std::size_t current_index)
+          : map_(map)
+          , current_index_(current_index)
+        {
+        }
+
+    public:
+        constexpr PairProvider() noexcept
+          : PairProvider{nullptr, 0}
+        {
+        }
+
+        constexpr PairProvider(const PairProvider&) = default;
+        constexpr PairProvider(PairProvider&&) noexcept = default;
+        constexpr PairProvider& operator=(const PairProvider&) = default;
+        constexpr PairProvider& operator=(PairProvider&&) noexcept = default;
+
+        // https://github.com/llvm/llvm-project/issues/62555
+        template <bool IS_CONST_2>
+        constexpr PairProvider(const PairProvider<IS_CONST_2>& mutable_other) noexcept
+            requires(IS_CONST and !IS_CONST_2)
+          : PairProvider{mutable_other.map_, mutable_other.current_index_}
+        {
+        }
+
+        constexpr void advance() noexcept { ++current_index_; }
+
+        [[nodiscard]] constexpr std::conditional_t<IS_CONST, const_reference, reference> get()
+            const noexcept
+        {
+            auto& entry = map_->entries()[current_index_];
+            return {entry.key(), entry.value()};
+        }
+
+        template <bool IS_CONST2>
+        constexpr bool operator==(const PairProvider<IS_CONST2>& other) const noexcept
+        {
+            return map_ == other.map_ && current_index_ == other.current_index_;
+        }
+    };
+
+    template <IteratorConstness CONSTNESS>
+    using Iterator = ForwardIterator<PairProvider<true>, PairProvider<false>, CONSTNESS>;
+
+public:
+    using const_iterator = Iterator<IteratorConstness::CONSTANT_ITERATOR>;
+    using iterator = Iterator<IteratorConstness::MUTABLE_ITERATOR>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+public:
+    static constexpr size_type static_max_size() noexcept { return MAXIMUM_SIZE; }
+
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    // The entry at index `i` is the one whose key hashes to slot `i`
+    FixedVector<EntryType, MAXIMUM_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_;
+    std::array<PilotType, PILOT_COUNT> IMPLEMENTATION_DETAIL_DO_NOT_USE_pilots_;
+    std::uint64_t IMPLEMENTATION_DETAIL_DO_NOT_USE_seed_;
+    Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    KeyEqual IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+
+public:
+    constexpr FixedPerfectHashMap(const Hash& hash = Hash(),
+                                  const KeyEqual& equal = KeyEqual()) noexcept
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_pilots_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_seed_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(hash)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(equal)
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedPerfectHashMap(
+        InputIt first,
+        InputIt last,
+        const Hash& hash = Hash(),
+        const KeyEqual& equal = KeyEqual(),
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedPerfectHashMap{hash, equal}
+    {
+        for (; first != last; std::advance(first, 1))
+        {
+            if (preconditions::test(entries().size() < MAXIMUM_SIZE))
+            {
+                CheckingType::length_error(MAXIMUM_SIZE + 1, loc);
+            }
+            const auto& pair = *first;
+            entries().emplace_back(pair.first, pair.second);
+        }
+        build();
+    }
+
+    constexpr FixedPerfectHashMap(
+        std::initializer_list<value_type> list,
+        const Hash& hash = Hash(),
+        const KeyEqual& equal = KeyEqual(),
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedPerfectHashMap{list.begin(), list.end(), hash, equal, loc}
+    {
+    }
+
+public:
+    [[nodiscard]] constexpr V& at(const K& key,
+                                  const std_transition::source_location& loc =
+                                      std_transition::source_location::current()) noexcept
+    {
+        const std::size_t slot = slot_of(key);
+        if (slot == size())
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return entries()[slot].value();
+    }
+
+    [[nodiscard]] constexpr const V& at(
+        const K& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) const noexcept
+    {
+        const std::size_t slot = slot_of(key);
+        if (slot == size())
+        {
+            CheckingType::out_of_range(key, size(), loc);
+        }
+        return entries()[slot].value();
+    }
+
+    [[nodiscard]] constexpr const_iterator cbegin() const noexcept
+    {
+        return create_const_iterator(0);
+    }
+    [[nodiscard]] constexpr const_iterator cend() const noexcept
+    {
+        return create_const_iterator(size());
+    }
+    [[nodiscard]] constexpr const_iterator begin() const noexcept { return cbegin(); }
+    constexpr iterator begin() noexcept { return create_iterator(0); }
+    [[nodiscard]] constexpr const_iterator end() const noexcept { return cend(); }
+    constexpr iterator end() noexcept { return create_iterator(size()); }
+
+    [[nodiscard]] constexpr size_type max_size() const noexcept { return static_max_size(); }
+    [[nodiscard]] constexpr std::size_t size() const noexcept { return entries().size(); }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size() == 0; }
+
+    [[nodiscard]] constexpr const hasher& hash_function() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    }
+    [[nodiscard]] constexpr const key_equal& key_eq() const noexcept
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+    }
+
+    [[nodiscard]] constexpr iterator find(const K& key) noexcept
+    {
+        return create_iterator(slot_of(key));
+    }
+    [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
+    {
+        return create_const_iterator(slot_of(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr iterator find(const K0& key) noexcept
+        requires TRANSPARENT_LOOKUP
+    {
+        return create_iterator(slot_of(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires TRANSPARENT_LOOKUP
+    {
+        return create_const_iterator(slot_of(key));
+    }
+
+    [[nodiscard]] constexpr bool contains(const K& key) const noexcept
+    {
+        return slot_of(key) != size();
+    }
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires TRANSPARENT_LOOKUP
+    {
+        return slot_of(key) != size();
+    }
+
+    [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires TRANSPARENT_LOOKUP
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<iterator, iterator> equal_range(const K& key) noexcept
+    {
+        const std::size_t slot = slot_of(key);
+        return {create_iterator(slot), create_iterator(std::min(slot + 1, size()))};
+    }
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        const std::size_t slot = slot_of(key);
+        return {create_const_iterator(slot), create_const_iterator(std::min(slot + 1, size()))};
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              std::size_t PILOT_COUNT_2,
+              customize::MapChecking<K> CheckingType2>
+    [[nodiscard]] constexpr bool operator==(
+        const FixedPerfectHashMap<K,
+                                  V,
+                                  MAXIMUM_SIZE_2,
+                                  Hash,
+                                  KeyEqual,
+                                  PILOT_COUNT_2,
+                                  CheckingType2>& other) const
+    {
+        if (size() != other.size())
+        {
+            return false;
+        }
+        return std::ranges::all_of(*this,
+                                   [&other](const auto& pair)
+                                   {
+                                       const auto other_it = other.find(pair.first);
+                                       return other_it != other.end() &&
+                                              other_it->second == pair.second;
+                                   });
+    }
+
+private:
+    constexpr FixedVector<EntryType, MAXIMUM_SIZE>& entries()
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_;
+    }
+    [[nodiscard]] constexpr const FixedVector<EntryType, MAXIMUM_SIZE>& entries() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_entries_;
+    }
+
+    constexpr iterator create_iterator(std::size_t slot) noexcept
+    {
+        return iterator{PairProvider<false>{this, slot}};
+    }
+    [[nodiscard]] constexpr const_iterator create_const_iterator(std::size_t slot) const noexcept
+    {
+        return const_iterator{PairProvider<true>{this, slot}};
+    }
+
+    // The user-provided hash is remixed with the seed, so that a seed that fails to produce a
+    // perfect hash can be replaced by another one
+    template <typename Key>
+    [[nodiscard]] constexpr std::uint64_t seeded_hash(const Key& key) const
+    {
+        return wyhash_detail::hash(IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(key) ^
+                                   IMPLEMENTATION_DETAIL_DO_NOT_USE_seed_);
+    }
+
+    // The upper 32 bits of the hash pick the bucket, the lower 32 bits combined with the pilot of
+    // the bucket pick the slot
+    [[nodiscard]] static constexpr std::size_t bucket_from_hash(std::uint64_t key_hash)
+    {
+        return static_cast<std::size_t>(((key_hash >> 32U) * PILOT_COUNT) >> 32U);
+    }
+
+    [[nodiscard]] constexpr std::size_t slot_from_hash(std::uint64_t key_hash,
+                                                       PilotType pilot) const
+    {
+        const std::uint64_t lower_hash = (key_hash ^ wyhash_detail::hash(pilot)) & 0xFFFF'FFFFU;
+        return static_cast<std::size_t>((lower_hash * size()) >> 32U);
+    }
+
+    // Returns `size()` if the key is not in the map
+    template <typename Key>
+    [[nodiscard]] constexpr std::size_t slot_of(const Key& key) const
+    {
+        if (empty())
+        {
+            return 0;
+        }
+        const std::uint64_t key_hash = seeded_hash(key);
+        const std::size_t slot = slot_from_hash(
+            key_hash, IMPLEMENTATION_DETAIL_DO_NOT_USE_pilots_[bucket_from_hash(key_hash)]);
+        if (!IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(entries()[slot].key(), key))
+        {
+            return size();
+        }
+        return slot;
+    }
+
+    // Sorts the entry indices by bucket into `members`, such that the members of bucket `b` are
+    // `members[bucket_start[b]]` to `members[bucket_start[b + 1]]`, by increasing entry index.
+    constexpr void group_by_bucket(const std::array<std::uint64_t, MAXIMUM_SIZE>& hashes,
+                                   std::array<SizeType, PILOT_COUNT + 1>& bucket_start,
+                                   std::array<SizeType, MAXIMUM_SIZE>& members) const
+    {
+        bucket_start.fill(0);
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            bucket_start[bucket_from_hash(hashes[i]) + 1]++;
+        }
+        for (std::size_t bucket = 0; bucket < PILOT_COUNT; bucket++)
+        {
+            bucket_start[bucket + 1] =
+                static_cast<SizeType>(bucket_start[bucket + 1] + bucket_start[bucket]);
+        }
+        std::array<SizeType, PILOT_COUNT + 1> next_member = bucket_start;
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            members[next_member[bucket_from_hash(hashes[i])]++] = static_cast<SizeType>(i);
+        }
+    }
+
+    // Equal keys have equal hashes, so they end up in the same bucket
+    constexpr void remove_duplicate_keys()
+    {
+        std::array<std::uint64_t, MAXIMUM_SIZE> hashes{};
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            hashes[i] = seeded_hash(entries()[i].key());
+        }
+        std::array<SizeType, PILOT_COUNT + 1> bucket_start{};
+        std::array<SizeType, MAXIMUM_SIZE> members{};
+        group_by_bucket(hashes, bucket_start, members);
+
+        std::array<bool, MAXIMUM_SIZE> is_duplicate{};
+        for (std::size_t bucket = 0; bucket < PILOT_COUNT; bucket++)
+        {
+            for (std::size_t i = bucket_start[bucket]; i < bucket_start[bucket + 1]; i++)
+            {
+                const SizeType later = members[i];
+                for (std::size_t j = bucket_start[bucket]; j < i; j++)
+                {
+                    const SizeType earlier = members[j];
+                    if (is_duplicate[earlier] || hashes[earlier] != hashes[later])
+                    {
+                        continue;
+                    }
+                    const K& earlier_key = entries()[earlier].key();
+                    const K& later_key = entries()[later].key();
+                    if (IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(earlier_key, later_key))
+                    {
+                        is_duplicate[later] = true;
+                        break;
+                    }
+                    // Different keys with the same hash always land in the same slot
+                    assert_or_abort(IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(earlier_key) !=
+                                    IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(later_key));
+                }
+            }
+        }
+
+        std::size_t kept_count = 0;
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            if (is_duplicate[i])
+            {
+                continue;
+            }
+            if (kept_count != i)
+            {
+                entries()[kept_count] = std::move(entries()[i]);
+            }
+            kept_count++;
+        }
+        while (size() > kept_count)
+        {
+            entries().pop_back();
+        }
+    }
+
+    // Returns false if some bucket ran out of pilots, in which case another seed should be tried
+    constexpr bool try_place_entries()
+    {
+        std::array<std::uint64_t, MAXIMUM_SIZE> hashes{};
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            hashes[i] = seeded_hash(entries()[i].key());
+        }
+        std::array<SizeType, PILOT_COUNT + 1> bucket_start{};
+        std::array<SizeType, MAXIMUM_SIZE> members{};
+        group_by_bucket(hashes, bucket_start, members);
+
+        // Larger buckets are harder to place, so they go first while most slots are free
+        std::array<std::size_t, PILOT_COUNT> bucket_order{};
+        for (std::size_t bucket = 0; bucket < PILOT_COUNT; bucket++)
+        {
+            bucket_order[bucket] = bucket;
+        }
+        const auto bucket_size = [&bucket_start](std::size_t bucket)
+        { return bucket_start[bucket + 1] - bucket_start[bucket]; };
+        std::sort(bucket_order.begin(),
+                  bucket_order.end(),
+                  [&bucket_size](std::size_t lhs, std::size_t rhs)
+                  { return bucket_size(lhs) > bucket_size(rhs); });
+
+        std::array<bool, MAXIMUM_SIZE> taken{};
+        std::array<SizeType, MAXIMUM_SIZE> slot_of_entry{};
+        for (const std::size_t bucket : bucket_order)
+        {
+            if (bucket_size(bucket) == 0)
+            {
+                break;
+            }
+            if (!try_place_bucket(bucket, hashes, bucket_start, members, taken, slot_of_entry))
+            {
+                return false;
+            }
+        }
+
+        // Move every entry to its slot, following the cycles of the permutation
+        for (std::size_t i = 0; i < size(); i++)
+        {
+            while (slot_of_entry[i] != i)
+            {
+                const SizeType target = slot_of_entry[i];
+                std::swap(entries()[i], entries()[target]);
+                std::swap(slot_of_entry[i], slot_of_entry[target]);
+            }
+        }
+        return true;
+    }
+
+    constexpr bool try_place_bucket(std::size_t bucket,
+                                    const std::array<std::uint64_t, MAXIMUM_SIZE>& hashes,
+                                    const std::array<SizeType, PILOT_COUNT + 1>& bucket_start,
+                                    const std::array<SizeType, MAXIMUM_SIZE>& members,
+                                    std::array<bool, MAXIMUM_SIZE>& taken,
+                                    std::array<SizeType, MAXIMUM_SIZE>& slot_of_entry)
+    {
+        const std::size_t first = bucket_start[bucket];
+        const std::size_t last = bucket_start[bucket + 1];
+        for (PilotType pilot = 0;; pilot++)
+        {
+            std::size_t placed = first;
+            for (; placed < last; placed++)
+            {
+                const SizeType entry = members[placed];
+                const std::size_t slot = slot_from_hash(hashes[entry], pilot);
+                if (taken[slot])
+                {
+                    break;
+                }
+                taken[slot] = true;
+                slot_of_entry[entry] = static_cast<SizeType>(slot);
+            }
+            if (placed == last)
+            {
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_pilots_[bucket] = pilot;
+                return true;
+            }
+            // Undo the partial placement before trying the next pilot
+            for (std::size_t i = first; i < placed; i++)
+            {
+                taken[slot_of_entry[members[i]]] = false;
+            }
+            if (pilot == std::numeric_limits<PilotType>::max())
+            {
+                return false;
+            }
+        }
+    }
+
+    constexpr void build()
+    {
+        remove_duplicate_keys();
+        for (std::uint64_t attempt = 0;
+             attempt < fixed_perfect_hash_map_detail::MAX_SEED_ATTEMPTS;
+             attempt++)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_seed_ = wyhash_detail::hash(attempt);
+            if (try_place_entries())
+            {
+                return;
+            }
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_pilots_.fill(0);
+        }
+        // No perfect hash found, the hash function is probably of poor quality
+        assert_or_abort(false);
+    }
+};
+
+/**
+ * Construct a FixedPerfectHashMap with its capacity being deduced from the number of key-value
+ * pairs being passed.
+ */
+template <typename K,
+          typename V,
+          class Hash = wyhash::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          std::size_t MAXIMUM_SIZE,
+          typename FixedMapType = FixedPerfectHashMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual>>
+[[nodiscard]] constexpr FixedMapType make_fixed_perfect_hash_map(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    return {std::begin(list), std::end(list), hash, key_equal, loc};
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash,
+          class KeyEqual,
+          std::size_t PILOT_COUNT,
+          fixed_containers::customize::MapChecking<K> CheckingType>
+struct tuple_size<
+    fixed_containers::
+        FixedPerfectHashMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, PILOT_COUNT, CheckingType>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -3,13 +3,19 @@
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/fixed_index_based_storage.hpp"
+#include "fixed_containers/fixed_red_black_tree_augmentation.hpp"
 #include "fixed_containers/fixed_red_black_tree_ops.hpp"
 #include "fixed_containers/fixed_red_black_tree_storage.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cstddef>
 #include <functional>
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
@@ -39,8 +45,12 @@ template <class K,
                              here. clang accepts it */
                     ,
                     std::size_t>
-          typename StorageTemplate>
+          typename StorageTemplate,
+          class Augmentation>
 class FixedRedBlackTreeBase
+  : public FixedRedBlackTreeAugmentationStorage<
+        TreeAugmentationTraits<Augmentation, K, V, MAXIMUM_SIZE>,
+        MAXIMUM_SIZE>
 {
 protected:  // [WORKAROUND-1]
     using KeyType = K;
@@ -50,6 +60,10 @@ protected:  // [WORKAROUND-1]
     using NodeType = typename TreeStorage::NodeType;
     using Ops = FixedRedBlackTreeOps<FixedRedBlackTreeBase>;
     friend Ops;
+    using AugmentationTraits = TreeAugmentationTraits<Augmentation, K, V, MAXIMUM_SIZE>;
+    static constexpr bool HAS_AUGMENTATION = AugmentationTraits::ENABLED;
+    static constexpr bool HAS_SUBTREE_SIZES =
+        std::is_same_v<Augmentation, OrderStatisticTreeAugmentation>;
 
 public:
     using size_type = std::size_t;
@@ -59,6 +73,8 @@ public:  // Public so this type is a structural type and can thus be used in tem
     TreeStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_storage_;
     NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
     NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+    // Kept up to date so that appending at the end does not walk down the right spine
+    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_;
     Compare IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{};
 
 public:
@@ -71,6 +87,7 @@ public:
       : IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_storage_{}
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_{NULL_INDEX}
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_size_{}
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_{NULL_INDEX}
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_{comparator}
     {
     }
@@ -85,7 +102,10 @@ public:
 
     constexpr void clear() noexcept
     {
-        delete_range_and_return_successor(index_of_min_at(), NULL_INDEX);
+        const NodeIndex old_root_index = root_index();
+        set_root_index(NULL_INDEX);
+        delete_detached_subtree(old_root_index);
+        set_max_index(NULL_INDEX);
     }
 
     constexpr void insert_node(const K& key) noexcept
@@ -135,10 +155,18 @@ public:
         RedBlackTreeNodeView node_i = tree_storage_at(np_idxs.i);
         node_i.set_parent_index(np_idxs.parent);
 
+        // The new node is the maximum if it is the root or the right child of the old maximum
+        if (np_idxs.parent == NULL_INDEX ||
+            (np_idxs.parent == max_index() && !np_idxs.is_left_child))
+        {
+            set_max_index(np_idxs.i);
+        }
+
         // No parent. Corner case for root node
         if (np_idxs.parent == NULL_INDEX)
         {
             set_root_index(np_idxs.i);
+            update_subtree_data_at(np_idxs.i);
             fix_after_insertion(root_index());
             return;
         }
@@ -153,10 +181,53 @@ public:
             parent.set_right_index(np_idxs.i);
         }
 
+        // Rotations only update the data of the two nodes they move, so the path has to be
+        // correct before rebalancing
+        update_subtree_data_up_to_root(np_idxs.i);
         fix_after_insertion(np_idxs.i);
     }
 
-    constexpr size_type delete_node(const K& key) noexcept
+    /**
+     * Fills an empty tree with the entries of [first, last), which must be sorted by `Compare` and
+     * unique, as a perfectly balanced tree. This is O(n) and compares no key, unlike n insertions
+     * that each take O(log n) comparisons and then rebalance. For maps, the entries are key-value
+     * pairs. `before_each_insertion()` is called before every entry, e.g. to check the capacity.
+     */
+    template <class InputIt, class BeforeEachInsertion>
+    constexpr void build_from_sorted_unique(InputIt first,
+                                            InputIt last,
+                                            BeforeEachInsertion before_each_insertion)
+    {
+        assert_or_abort(empty());
+        // Nodes get the indices 0, 1, 2..., so the index of a node is its rank
+        tree_storage().reset_index_order();
+        NodeIndex count = 0;
+        for (; first != last; ++first, ++count)
+        {
+            before_each_insertion();
+            NodeIndex index{};
+            if constexpr (HAS_ASSOCIATED_VALUE)
+            {
+                auto&& entry = *first;
+                index = tree_storage().emplace_and_return_index(
+                    std::forward<decltype(entry)>(entry).first,
+                    std::forward<decltype(entry)>(entry).second);
+            }
+            else
+            {
+                index = tree_storage().emplace_and_return_index(*first);
+            }
+            assert_or_abort(index == count);
+            increment_size();
+        }
+
+        link_ranked_nodes_as_balanced_tree(count);
+        set_max_index(count == 0 ? NULL_INDEX : count - 1);
+        update_subtree_data_of_all_nodes();
+    }
+
+    template <class K0>
+    constexpr size_type delete_node(const K0& key) noexcept
     {
         const NodeIndex index = index_of_node_or_null(key);
         if (!contains_at(index))
@@ -202,6 +273,248 @@ public:
         return to_idx;
     }
 
+    /**
+     * Deletes every node with a key less than `key`. The tree is split along the path to `key`
+     * with red-black joins in O(log n), then the k nodes on the other side are destroyed without
+     * any rebalancing. This is O(log n + k), instead of O(k log n) for deleting them one by one.
+     */
+    template <class K0>
+    constexpr void delete_nodes_less_than(const K0& key) noexcept
+    {
+        delete_nodes_on_one_side_of(key, /*delete_less=*/true, /*delete_equal=*/false);
+    }
+    template <class K0>
+    constexpr void delete_nodes_greater_than(const K0& key) noexcept
+    {
+        delete_nodes_on_one_side_of(key, /*delete_less=*/false, /*delete_equal=*/false);
+    }
+    template <class K0>
+    constexpr void delete_nodes_not_less_than(const K0& key) noexcept
+    {
+        delete_nodes_on_one_side_of(key, /*delete_less=*/false, /*delete_equal=*/true);
+    }
+
+    // Moves the nodes with keys not less than `key` into `other`, which must be empty and have
+    // room for them. O(log n + k) for k moved nodes without augmentation, as with `join_with()`.
+    template <class OtherTree, class K0>
+    constexpr void move_nodes_not_less_than_into(const K0& key, OtherTree& other) noexcept
+    {
+        assert_or_abort(other.empty());
+        NodeIndex other_max_index = NULL_INDEX;
+        for (NodeIndex i = index_of_node_ceiling(index_of_node_with_parent(key)); i != NULL_INDEX;
+             i = index_of_successor_at(i))
+        {
+            NodeIndexAndParentIndex np_idxs{
+                .i = NULL_INDEX, .parent = other_max_index, .is_left_child = false};
+            move_node_into(other, np_idxs, i);
+            other_max_index = np_idxs.i;
+        }
+        delete_nodes_not_less_than(key);
+    }
+
+    /**
+     * Moves the nodes of `other` into this tree and leaves `other` empty. The keys of `other` must
+     * all be greater than the keys of this tree, or all less. Every node goes right next to the
+     * one moved before it, as the new maximum (minimum), so only the first two keys are compared
+     * and the rebalancing is O(1) amortized per node. With augmentation, the data of the path to
+     * the root is updated for every node, which is O(log n). `other` must be ordered by the same
+     * comparator, as its nodes are taken in its own order. `before_each_insertion()` is called
+     * before every node, e.g. to check the capacity.
+     */
+    template <class OtherTree, class BeforeEachInsertion>
+    constexpr void join_with(OtherTree& other, BeforeEachInsertion before_each_insertion) noexcept
+    {
+        if (other.empty())
+        {
+            return;
+        }
+
+        const bool append =
+            empty() || compare(tree_storage().key(index_of_max_at()),
+                               other.node_at(other.index_of_min_at()).key()) < 0;
+        if (!append)
+        {
+            assert_or_abort(compare(other.node_at(other.index_of_max_at()).key(),
+                                    tree_storage().key(index_of_min_at())) < 0);
+        }
+
+        // The maximum has no right child and the minimum no left child, also after rebalancing
+        NodeIndex end_index = append ? index_of_max_at() : index_of_min_at();
+        NodeIndex other_index = append ? other.index_of_min_at() : other.index_of_max_at();
+        while (other_index != NULL_INDEX)
+        {
+            before_each_insertion();
+            NodeIndexAndParentIndex np_idxs{
+                .i = NULL_INDEX, .parent = end_index, .is_left_child = !append};
+            other.move_node_into(*this, np_idxs, other_index);
+            end_index = np_idxs.i;
+            other_index = append ? other.index_of_successor_at(other_index)
+                                 : other.index_of_predecessor_at(other_index);
+        }
+        other.clear();
+    }
+
+    // Inserts a new node into `other` at `np_idxs`, with the key and value moved out of the node at
+    // `index`, which is left in place
+    template <class OtherTree>
+    constexpr void move_node_into(OtherTree& other,
+                                  NodeIndexAndParentIndex& np_idxs,
+                                  const NodeIndex& index) noexcept
+    {
+        RedBlackTreeNodeView node = tree_storage_at(index);
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            other.insert_new_at(np_idxs, std::move(node.key()), std::move(node.value()));
+        }
+        else
+        {
+            other.insert_new_at(np_idxs, std::move(node.key()));
+        }
+    }
+
+    // Same as `move_node_into()`, with the key and value copied
+    template <class OtherTree>
+    constexpr void copy_node_into(OtherTree& other,
+                                  NodeIndexAndParentIndex& np_idxs,
+                                  const NodeIndex& index) const noexcept
+    {
+        const RedBlackTreeNodeView node = tree_storage_at(index);
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            other.insert_new_at(np_idxs, node.key(), node.value());
+        }
+        else
+        {
+            other.insert_new_at(np_idxs, node.key());
+        }
+    }
+
+    // Set algebra with another tree ordered by the same comparator, in place. Both trees are
+    // walked in key order side by side, and every step skips ahead with
+    // `index_of_node_ceiling_from()` instead of visiting each node. So a run of d keys without a
+    // counterpart in the other tree costs O(log d) comparisons, and the whole walk is
+    // O(m log(n/m + 1)) for trees of sizes m <= n, as with the divide-and-conquer algorithms that
+    // split the larger tree around the keys of the smaller one.
+
+    // Whether every key of `other` is also in this tree
+    template <class OtherTree>
+    [[nodiscard]] constexpr bool contains_all_nodes_of(const OtherTree& other) const noexcept
+    {
+        if (other.size() > size())
+        {
+            return false;
+        }
+
+        NodeIndex index = index_of_min_at();
+        for (NodeIndex other_index = other.index_of_min_at(); other_index != NULL_INDEX;
+             other_index = other.index_of_successor_at(other_index))
+        {
+            const auto& other_key = other.node_at(other_index).key();
+            index = index_of_node_ceiling_from(index, other_key);
+            if (index == NULL_INDEX || compare(other_key, tree_storage().key(index)) < 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Inserts a copy of the nodes of `other` whose key is not in this tree. Every node goes into
+    // the gap next to the ceiling of its key, so no key is compared for the insertion itself.
+    // `before_each_insertion()` is called before every node, e.g. to check the capacity.
+    template <class OtherTree, class BeforeEachInsertion>
+    constexpr void insert_nodes_not_present_from(const OtherTree& other,
+                                                 BeforeEachInsertion before_each_insertion)
+    {
+        NodeIndex index = index_of_min_at();
+        for (NodeIndex other_index = other.index_of_min_at(); other_index != NULL_INDEX;
+             other_index = other.index_of_successor_at(other_index))
+        {
+            const auto& other_key = other.node_at(other_index).key();
+            index = index_of_node_ceiling_from(index, other_key);
+            if (index != NULL_INDEX && compare(other_key, tree_storage().key(index)) >= 0)
+            {
+                continue;
+            }
+
+            before_each_insertion();
+            // `index` stays the ceiling of the next key, as the new node is before it
+            const NodeIndex predecessor_index =
+                index == NULL_INDEX ? index_of_max_at() : index_of_predecessor_at(index);
+            NodeIndexAndParentIndex np_idxs = index_of_gap_between(predecessor_index, index);
+            other.copy_node_into(*this, np_idxs, other_index);
+        }
+    }
+
+    // Deletes the nodes whose key is not in `other`. The nodes below the minimum of `other` and
+    // above its maximum are trimmed with splits, as with `delete_nodes_less_than()`.
+    template <class OtherTree>
+    constexpr void delete_nodes_not_in(const OtherTree& other) noexcept
+    {
+        if (is_same_tree_as(other))
+        {
+            return;
+        }
+        if (other.empty())
+        {
+            clear();
+            return;
+        }
+
+        delete_nodes_less_than(other.node_at(other.index_of_min_at()).key());
+        delete_nodes_greater_than(other.node_at(other.index_of_max_at()).key());
+
+        // Every key left is at most the maximum of `other`, so its ceiling there exists
+        NodeIndex index = index_of_min_at();
+        NodeIndex other_index = other.index_of_min_at();
+        while (index != NULL_INDEX)
+        {
+            other_index = other.index_of_node_ceiling_from(other_index, tree_storage().key(index));
+            const auto& other_key = other.node_at(other_index).key();
+            if (compare(tree_storage().key(index), other_key) < 0)
+            {
+                index = delete_range_and_return_successor(
+                    index, index_of_node_ceiling_from(index, other_key));
+            }
+            else
+            {
+                index = index_of_successor_at(index);
+            }
+        }
+    }
+
+    // Deletes the nodes whose key is in `other`
+    template <class OtherTree>
+    constexpr void delete_nodes_in(const OtherTree& other) noexcept
+    {
+        if (is_same_tree_as(other))
+        {
+            clear();
+            return;
+        }
+
+        NodeIndex index = index_of_min_at();
+        NodeIndex other_index = other.index_of_min_at();
+        while (index != NULL_INDEX && other_index != NULL_INDEX)
+        {
+            other_index = other.index_of_node_ceiling_from(other_index, tree_storage().key(index));
+            if (other_index == NULL_INDEX)
+            {
+                break;
+            }
+
+            const auto& other_key = other.node_at(other_index).key();
+            if (compare(tree_storage().key(index), other_key) < 0)
+            {
+                index = index_of_node_ceiling_from(index, other_key);
+            }
+            else
+            {
+                index = delete_at_and_return_successor(index);
+            }
+        }
+    }
+
     [[nodiscard]] constexpr const NodeIndex& root_index() const
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
@@ -247,6 +560,80 @@ public:
         return np_idxs;
     }
 
+    /**
+     * Same as `index_of_node_with_parent()`, but first tries the position right before the node
+     * at `hint_index` (NULL_INDEX being past the end), then the one right after it. When the hint
+     * is right, this compares `key` with the hint and its neighbour only, instead of with one node
+     * per level, and the neighbour is usually a step away. Otherwise, it falls back to the search
+     * from the root.
+     */
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndexAndParentIndex index_of_node_with_parent_near(
+        const NodeIndex& hint_index, const K0& key) const
+    {
+        if (hint_index == NULL_INDEX)
+        {
+            const NodeIndex max_index = index_of_max_at();
+            if (max_index == NULL_INDEX || compare(tree_storage().key(max_index), key) < 0)
+            {
+                return index_of_gap_between(max_index, NULL_INDEX);
+            }
+            return index_of_node_with_parent(key);
+        }
+
+        const int cmp = compare(key, tree_storage().key(hint_index));
+        if (cmp < 0)
+        {
+            const NodeIndex predecessor_index = index_of_predecessor_at(hint_index);
+            if (predecessor_index == NULL_INDEX ||
+                compare(tree_storage().key(predecessor_index), key) < 0)
+            {
+                return index_of_gap_between(predecessor_index, hint_index);
+            }
+        }
+        else if (cmp > 0)
+        {
+            const NodeIndex successor_index = index_of_successor_at(hint_index);
+            if (successor_index == NULL_INDEX ||
+                compare(key, tree_storage().key(successor_index)) < 0)
+            {
+                return index_of_gap_between(hint_index, successor_index);
+            }
+        }
+        else
+        {
+            const NodeIndex parent_index = tree_storage().parent_index(hint_index);
+            return {.i = hint_index,
+                    .parent = parent_index,
+                    .is_left_child = parent_index == NULL_INDEX ||
+                                     tree_storage().left_index(parent_index) == hint_index};
+        }
+
+        return index_of_node_with_parent(key);
+    }
+
+    // Where `key` goes if it is greater than every key in the tree, which is checked with a single
+    // comparison.
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndexAndParentIndex index_of_node_with_parent_past_max(
+        const K0& key) const
+    {
+        const NodeIndex max_index = index_of_max_at();
+        assert_or_abort(max_index == NULL_INDEX ||
+                        compare(tree_storage().key(max_index), key) < 0);
+        return index_of_gap_between(max_index, NULL_INDEX);
+    }
+    // Where `key` goes if it is less than every key in the tree
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndexAndParentIndex index_of_node_with_parent_before_min(
+        const K0& key) const
+    {
+        const NodeIndex min_index = index_of_min_at();
+        assert_or_abort(min_index == NULL_INDEX ||
+                        compare(key, tree_storage().key(min_index)) < 0);
+        return index_of_gap_between(NULL_INDEX, min_index);
+    }
+
     template <class K0>
     [[nodiscard]] constexpr NodeIndex index_of_node_or_null(const K0& key) const
     {
@@ -327,6 +714,59 @@ public:
         return index_of_node_ceiling(index_of_node_with_parent(key));
     }
 
+    /**
+     * Same as `index_of_node_ceiling()`, given that every node before the one at `start_index`
+     * has a key less than `key`, e.g. because it is the ceiling of a smaller key. The search only
+     * climbs from the start as far as it must before going down again, so it takes O(log d)
+     * comparisons for a ceiling d nodes away, instead of one per level from the root.
+     */
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndex index_of_node_ceiling_from(const NodeIndex& start_index,
+                                                                 const K0& key) const noexcept
+    {
+        NodeIndex index = start_index;
+        if (index == NULL_INDEX || compare(tree_storage().key(index), key) >= 0)
+        {
+            return index;
+        }
+
+        // The key at `index` is less than `key`. The nodes that follow are those of its right
+        // subtree, then the first ancestor that has it in its left subtree, and so on.
+        while (true)
+        {
+            NodeIndex subtree_root = index;
+            NodeIndex next_ancestor = tree_storage().parent_index(subtree_root);
+            while (next_ancestor != NULL_INDEX &&
+                   tree_storage().right_index(next_ancestor) == subtree_root)
+            {
+                subtree_root = next_ancestor;
+                next_ancestor = tree_storage().parent_index(next_ancestor);
+            }
+
+            if (next_ancestor == NULL_INDEX ||
+                compare(tree_storage().key(next_ancestor), key) >= 0)
+            {
+                NodeIndex ceiling = next_ancestor;
+                NodeIndex i = tree_storage().right_index(index);
+                while (i != NULL_INDEX)
+                {
+                    if (compare(tree_storage().key(i), key) < 0)
+                    {
+                        i = tree_storage().right_index(i);
+                    }
+                    else
+                    {
+                        ceiling = i;
+                        i = tree_storage().left_index(i);
+                    }
+                }
+                return ceiling;
+            }
+
+            index = next_ancestor;
+        }
+    }
+
     template <class K0>
     [[nodiscard]] constexpr bool contains_node(const K0& key) const noexcept
     {
@@ -375,10 +815,8 @@ public:
             i = right_index;
         }
     }
-    [[nodiscard]] constexpr NodeIndex index_of_max_at() const noexcept
-    {
-        return index_of_max_at(this->root_index());
-    }
+    // O(1), unlike `index_of_min_at()`
+    [[nodiscard]] constexpr NodeIndex index_of_max_at() const noexcept { return max_index(); }
 
     [[nodiscard]] constexpr NodeIndex index_of_successor_at(const NodeIndex& index) const
     {
@@ -435,6 +873,143 @@ public:
         return predecessor;
     }
 
+    // Index of the node that has `rank` smaller keys, or NULL_INDEX if there are not that many
+    // nodes.
+    [[nodiscard]] constexpr NodeIndex index_of_nth(std::size_t rank) const noexcept
+        requires HAS_SUBTREE_SIZES
+    {
+        NodeIndex i = root_index();
+        while (i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(i);
+            const std::size_t left_size = subtree_data_of(node.left_index());
+            if (rank < left_size)
+            {
+                i = node.left_index();
+            }
+            else if (rank == left_size)
+            {
+                return i;
+            }
+            else
+            {
+                rank -= left_size + 1;
+                i = node.right_index();
+            }
+        }
+        return NULL_INDEX;
+    }
+
+    // Number of nodes whose key is smaller than `key`, with one comparison per level
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t rank_of(const K0& key) const noexcept
+        requires HAS_SUBTREE_SIZES
+    {
+        std::size_t rank = 0;
+        NodeIndex i = root_index();
+        while (i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(i);
+            if (IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(node.key(), key))
+            {
+                rank += static_cast<std::size_t>(subtree_data_of(node.left_index())) + 1;
+                i = node.right_index();
+            }
+            else
+            {
+                i = node.left_index();
+            }
+        }
+        return rank;
+    }
+
+    // Data of all the nodes, combined in key order
+    [[nodiscard]] constexpr auto aggregate_of_all() const noexcept
+        requires HAS_AUGMENTATION
+    {
+        return subtree_data_of(root_index());
+    }
+
+    // Data of the nodes whose key is in [from, to), combined in key order. The ranges below and
+    // above the node where the searches for `from` and `to` part ways are made of whole subtrees
+    // and single nodes along the two paths down.
+    template <class K0, class K1>
+    [[nodiscard]] constexpr auto aggregate_of_range(const K0& from, const K1& to) const noexcept
+        requires HAS_AUGMENTATION
+    {
+        NodeIndex i = root_index();
+        while (i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(i);
+            if (IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(node.key(), from))
+            {
+                i = node.right_index();
+            }
+            else if (!IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(node.key(), to))
+            {
+                i = node.left_index();
+            }
+            else
+            {
+                return AugmentationTraits::combine(
+                    AugmentationTraits::combine(
+                        aggregate_of_keys_not_less_than(node.left_index(), from), lift_at(i)),
+                    aggregate_of_keys_less_than(node.right_index(), to));
+            }
+        }
+        return AugmentationTraits::identity();
+    }
+
+    // Data of the nodes whose key is less than `to`, combined in key order
+    template <class K1>
+    [[nodiscard]] constexpr auto aggregate_of_keys_less_than(const K1& to) const noexcept
+        requires HAS_AUGMENTATION
+    {
+        return aggregate_of_keys_less_than(root_index(), to);
+    }
+
+    /**
+     * First node at or after `from_index`, in key order, whose own data satisfies `predicate`,
+     * or NULL_INDEX. Subtrees whose data does not satisfy `predicate` are skipped, so it must
+     * hold for the combination of two ranges exactly when it holds for either of them.
+     * O(log n): up the ancestors that come after `from_index`, then down a single subtree.
+     */
+    template <class Predicate>
+    [[nodiscard]] constexpr NodeIndex index_of_first_matching_at_or_after(
+        const NodeIndex& from_index, const Predicate& predicate) const
+        requires HAS_AUGMENTATION
+    {
+        NodeIndex i = from_index;
+        while (i != NULL_INDEX)
+        {
+            if (predicate(lift_at(i)))
+            {
+                return i;
+            }
+            const NodeIndex right_index = tree_storage().right_index(i);
+            if (right_index != NULL_INDEX && predicate(subtree_data_of(right_index)))
+            {
+                return index_of_first_matching_in_subtree(right_index, predicate);
+            }
+
+            // Up to the first ancestor that has `i` in its left subtree
+            NodeIndex child = i;
+            i = tree_storage().parent_index(i);
+            while (i != NULL_INDEX && tree_storage().right_index(i) == child)
+            {
+                child = i;
+                i = tree_storage().parent_index(i);
+            }
+        }
+        return NULL_INDEX;
+    }
+
+    // To be called after the value of the node at `index` changed in place
+    constexpr void update_subtree_data_after_value_change_at(const NodeIndex& index)
+    {
+        update_subtree_data_up_to_root(index);
+    }
+
 private:
     constexpr void increment_size(const std::size_t n = 1)
     {
@@ -449,6 +1024,323 @@ private:
         IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ = size;
     }
 
+    template <class OtherTree>
+    [[nodiscard]] constexpr bool is_same_tree_as(const OtherTree& other) const
+    {
+        if constexpr (std::is_base_of_v<FixedRedBlackTreeBase, OtherTree>)
+        {
+            return static_cast<const FixedRedBlackTreeBase*>(&other) == this;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    // The free child slot between two consecutive nodes, either of which can be NULL_INDEX for the
+    // ends. If the predecessor has a right child, the successor is the minimum of that subtree and
+    // thus has no left child.
+    [[nodiscard]] constexpr NodeIndexAndParentIndex index_of_gap_between(
+        const NodeIndex& predecessor_index, const NodeIndex& successor_index) const
+    {
+        if (predecessor_index != NULL_INDEX &&
+            tree_storage().right_index(predecessor_index) == NULL_INDEX)
+        {
+            return {.i = NULL_INDEX, .parent = predecessor_index, .is_left_child = false};
+        }
+        return {.i = NULL_INDEX, .parent = successor_index, .is_left_child = true};
+    }
+
+    template <class K0>
+    constexpr void delete_nodes_on_one_side_of(const K0& key,
+                                               const bool delete_less,
+                                               const bool delete_equal)
+    {
+        SplitSubtrees parts = split_at(key);
+        DetachedSubtree& kept = delete_less ? parts.greater : parts.less;
+        DetachedSubtree& deleted = delete_less ? parts.less : parts.greater;
+        if (parts.equal != NULL_INDEX)
+        {
+            if (!delete_equal)
+            {
+                kept = delete_less ? join(DetachedSubtree{}, parts.equal, kept)
+                                   : join(kept, parts.equal, DetachedSubtree{});
+            }
+            else
+            {
+                // The deleted nodes need not be ordered nor balanced
+                link_children(parts.equal, deleted.root, NULL_INDEX);
+                deleted.root = parts.equal;
+            }
+        }
+
+        make_black_root(kept);
+        set_root_index(kept.root);
+        delete_detached_subtree(deleted.root);
+        // O(log n), like the split
+        set_max_index(index_of_max_at(root_index()));
+    }
+
+    /**
+     * Splits the tree along the path to `key`. Going up from the bottom of the path, every node
+     * and the subtree on its other side are joined to the part they belong to. Each join is
+     * O(1 + the difference of the black heights), and these differences add up to the height of
+     * the tree, so this is O(log n). The tree is left without a root, with the same size.
+     */
+    template <class K0>
+    constexpr SplitSubtrees split_at(const K0& key)
+    {
+        const NodeIndexAndParentIndex np_idxs = index_of_node_with_parent(key);
+        SplitSubtrees parts{};
+        // Of the subtree at the current position on the path. Its sibling has the same one.
+        std::size_t black_height = 0;
+        if (np_idxs.i != NULL_INDEX)
+        {
+            black_height = black_height_at(np_idxs.i);
+            const std::size_t children_black_height =
+                black_height - (color_of(np_idxs.i) == COLOR_BLACK ? 1 : 0);
+            parts.less = {left_index_of(np_idxs.i), children_black_height};
+            parts.greater = {right_index_of(np_idxs.i), children_black_height};
+            parts.equal = np_idxs.i;
+        }
+
+        NodeIndex parent_index = np_idxs.parent;
+        bool is_left_child = np_idxs.is_left_child;
+        while (parent_index != NULL_INDEX)
+        {
+            // Read before the join relinks the parent
+            const NodeIndex grandparent_index = parent_index_of(parent_index);
+            const bool parent_is_left_child = left_index_of(grandparent_index) == parent_index;
+            const std::size_t sibling_black_height = black_height;
+            black_height += color_of(parent_index) == COLOR_BLACK ? 1 : 0;
+            if (is_left_child)
+            {
+                parts.greater = join(parts.greater,
+                                     parent_index,
+                                     {right_index_of(parent_index), sibling_black_height});
+            }
+            else
+            {
+                parts.less = join(
+                    {left_index_of(parent_index), sibling_black_height}, parent_index, parts.less);
+            }
+            parent_index = grandparent_index;
+            is_left_child = parent_is_left_child;
+        }
+
+        if (parts.equal != NULL_INDEX)
+        {
+            make_root(parts.less);
+            make_root(parts.greater);
+            link_children(parts.equal, NULL_INDEX, NULL_INDEX);
+            tree_storage_at(parts.equal).set_parent_index(NULL_INDEX);
+        }
+        set_root_index(NULL_INDEX);
+        return parts;
+    }
+
+    /**
+     * Joins two detached subtrees and the detached node `pivot`, whose key is between theirs. The
+     * pivot replaces the first black node of the same black height as the shorter subtree, on the
+     * side of the taller one that faces the shorter one, and gets both as children. Then the
+     * pivot is red and can only conflict with its parent, as after an insertion. This is
+     * O(1 + the difference of the black heights).
+     */
+    constexpr DetachedSubtree join(DetachedSubtree less,
+                                   const NodeIndex& pivot,
+                                   DetachedSubtree greater)
+    {
+        make_black_root(less);
+        make_black_root(greater);
+        if (less.black_height == greater.black_height)
+        {
+            link_children(pivot, less.root, greater.root);
+            tree_storage_at(pivot).set_parent_index(NULL_INDEX);
+            set_color(pivot, COLOR_BLACK);
+            update_subtree_data_at(pivot);
+            return {pivot, less.black_height + 1};
+        }
+
+        const bool less_is_taller = less.black_height > greater.black_height;
+        const DetachedSubtree& taller = less_is_taller ? less : greater;
+        const DetachedSubtree& shorter = less_is_taller ? greater : less;
+        NodeIndex parent_index = NULL_INDEX;
+        NodeIndex index = taller.root;
+        std::size_t black_height = taller.black_height;
+        while (color_of(index) == COLOR_RED || black_height != shorter.black_height)
+        {
+            black_height -= color_of(index) == COLOR_BLACK ? 1 : 0;
+            parent_index = index;
+            index = less_is_taller ? right_index_of(index) : left_index_of(index);
+        }
+
+        if (less_is_taller)
+        {
+            link_children(pivot, index, greater.root);
+            tree_storage_at(parent_index).set_right_index(pivot);
+        }
+        else
+        {
+            link_children(pivot, less.root, index);
+            tree_storage_at(parent_index).set_left_index(pivot);
+        }
+        tree_storage_at(pivot).set_parent_index(parent_index);
+
+        // The fixup works on the tree at the root index, which is free during a split
+        set_root_index(taller.root);
+        update_subtree_data_up_to_root(pivot);
+        const bool black_height_grew = fix_after_insertion(pivot);
+        return {root_index(), taller.black_height + (black_height_grew ? 1 : 0)};
+    }
+
+    // Destroys the nodes of a detached subtree, leaves first and without rebalancing, in O(k). The
+    // root of the tree is kept up to date if a node is repositioned in the storage.
+    constexpr void delete_detached_subtree(const NodeIndex& subtree_root)
+    {
+        NodeIndex index = subtree_root;
+        while (index != NULL_INDEX)
+        {
+            // Every node is passed once on the way down and once on the way up
+            for (;;)
+            {
+                const RedBlackTreeNodeView node = tree_storage_at(index);
+                if (node.left_index() != NULL_INDEX)
+                {
+                    index = node.left_index();
+                }
+                else if (node.right_index() != NULL_INDEX)
+                {
+                    index = node.right_index();
+                }
+                else
+                {
+                    break;
+                }
+            }
+
+            NodeIndex parent_index = parent_index_of(index);
+            if (parent_index != NULL_INDEX)
+            {
+                RedBlackTreeNodeView parent = tree_storage_at(parent_index);
+                if (parent.left_index() == index)
+                {
+                    parent.set_left_index(NULL_INDEX);
+                }
+                else
+                {
+                    parent.set_right_index(NULL_INDEX);
+                }
+            }
+
+            decrement_size();
+            const NodeIndex repositioned_index =
+                tree_storage().delete_at_and_return_repositioned_index(index);
+            if (repositioned_index != index)
+            {
+                move_subtree_data(repositioned_index, index);
+                Ops::fixup_neighbours_of_node_to_point_to_a_new_index(
+                    *this, tree_storage_at(index), repositioned_index, index);
+                fixup_repositioned_index(
+                    IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_, repositioned_index, index);
+                fixup_repositioned_index(parent_index, repositioned_index, index);
+            }
+            index = parent_index;
+        }
+    }
+
+    [[nodiscard]] constexpr std::size_t black_height_at(const NodeIndex& index) const
+    {
+        std::size_t black_height = 0;
+        for (NodeIndex i = index; i != NULL_INDEX; i = left_index_of(i))
+        {
+            black_height += color_of(i) == COLOR_BLACK ? 1 : 0;
+        }
+        return black_height;
+    }
+
+    constexpr void make_root(const DetachedSubtree& subtree)
+    {
+        if (subtree.root != NULL_INDEX)
+        {
+            tree_storage_at(subtree.root).set_parent_index(NULL_INDEX);
+        }
+    }
+    // Turning a red root black keeps a valid red-black tree, with one more black level
+    constexpr void make_black_root(DetachedSubtree& subtree)
+    {
+        make_root(subtree);
+        if (color_of(subtree.root) == COLOR_RED)
+        {
+            set_color(subtree.root, COLOR_BLACK);
+            subtree.black_height++;
+        }
+    }
+
+    constexpr void link_children(const NodeIndex& index,
+                                 const NodeIndex& left_index,
+                                 const NodeIndex& right_index)
+    {
+        RedBlackTreeNodeView node = tree_storage_at(index);
+        node.set_left_index(left_index);
+        node.set_right_index(right_index);
+        if (left_index != NULL_INDEX)
+        {
+            tree_storage_at(left_index).set_parent_index(index);
+        }
+        if (right_index != NULL_INDEX)
+        {
+            tree_storage_at(right_index).set_parent_index(index);
+        }
+    }
+
+    // Links the nodes at indices [0, count) in index order, with the middle of every range as the
+    // root of its subtree. Only the deepest level can be incomplete: its nodes are red and all the
+    // others black, so every path from the root down has the same number of black nodes.
+    constexpr void link_ranked_nodes_as_balanced_tree(const NodeIndex count)
+    {
+        if (count == 0)
+        {
+            set_root_index(NULL_INDEX);
+            return;
+        }
+
+        const auto middle_of = [](const NodeIndex begin, const NodeIndex end)
+        { return begin == end ? NULL_INDEX : begin + ((end - begin) / 2); };
+        const auto red_depth = static_cast<std::size_t>(std::bit_width(count + 1) - 1);
+
+        struct Subtree
+        {
+            NodeIndex begin;
+            NodeIndex end;
+            NodeIndex parent;
+            std::size_t depth;
+        };
+        // At most one pending sibling per level
+        std::array<Subtree, std::numeric_limits<std::size_t>::digits + 1> pending{};
+        std::size_t pending_count = 0;
+        pending[pending_count++] = {0, count, NULL_INDEX, 0};
+        while (pending_count > 0)
+        {
+            const Subtree subtree = pending[--pending_count];
+            const NodeIndex index = middle_of(subtree.begin, subtree.end);
+            RedBlackTreeNodeView node = tree_storage_at(index);
+            node.set_parent_index(subtree.parent);
+            node.set_left_index(middle_of(subtree.begin, index));
+            node.set_right_index(middle_of(index + 1, subtree.end));
+            node.set_color(subtree.depth == red_depth ? COLOR_RED : COLOR_BLACK);
+
+            if (index + 1 < subtree.end)
+            {
+                pending[pending_count++] = {index + 1, subtree.end, index, subtree.depth + 1};
+            }
+            if (subtree.begin < index)
+            {
+                pending[pending_count++] = {subtree.begin, index, index, subtree.depth + 1};
+            }
+        }
+        set_root_index(middle_of(0, count));
+    }
+
     template <class K1, class K2>
     [[nodiscard]] constexpr int compare(const K1& left, const K2& right) const
     {
@@ -533,6 +1425,10 @@ private:
 
         right.set_left_index(index);
         node.set_parent_index(r_idx);
+
+        // The rotated pair covers the same nodes as before, so the ancestors are unchanged
+        update_subtree_data_at(index);
+        update_subtree_data_at(r_idx);
     }
 
     constexpr void rotate_right(const NodeIndex& index)
@@ -568,9 +1464,14 @@ private:
 
         left.set_right_index(index);
         node.set_parent_index(l_idx);
+
+        update_subtree_data_at(index);
+        update_subtree_data_at(l_idx);
     }
 
-    constexpr void fix_after_insertion(const NodeIndex& index_of_newly_added)
+    // Returns whether the black height of the tree grew, which only happens when the root turns
+    // red while recoloring
+    constexpr bool fix_after_insertion(const NodeIndex& index_of_newly_added)
     {
         NodeIndex idx = index_of_newly_added;
         tree_storage().set_color(idx, COLOR_RED);
@@ -624,7 +1525,9 @@ private:
             }
         }
 
+        const bool black_height_grew = color_of(root_index()) == COLOR_RED;
         tree_storage_at(root_index()).set_color(COLOR_BLACK);
+        return black_height_grew;
     }
 
     constexpr SuccessorIndexAndRepositionedIndex delete_at_and_return_successor_and_repositioned(
@@ -637,6 +1540,7 @@ private:
         {
             tree_storage().delete_at_and_return_repositioned_index(index);
             set_root_index(NULL_INDEX);
+            set_max_index(NULL_INDEX);
             set_size(0);
             return {NULL_INDEX, NULL_INDEX};
         }
@@ -644,6 +1548,11 @@ private:
         decrement_size();
         const NodeIndex index_to_delete = index;
         const NodeIndex successor_index = index_of_successor_at(index_to_delete);
+        // The maximum has no right child, so its predecessor is its parent or the (red) left child
+        if (index_to_delete == max_index())
+        {
+            set_max_index(index_of_predecessor_at(index_to_delete));
+        }
 
         // The canonical way to handle the case where the node_for_deletion has two children is to
         // move successor's element to the original deletion spot, then proceed to delete the
@@ -662,6 +1571,9 @@ private:
         if (has_two_children(index_to_delete))
         {
             Ops::swap_nodes_excluding_key_and_value(*this, index_to_delete, successor_index);
+            // The data belongs to the position in the tree. It is off for the path above the
+            // new position of `index_to_delete`, which gets updated once the node is unlinked.
+            swap_subtree_data(index_to_delete, successor_index);
         }
 
         // Start fixup at replacement node, if it exists
@@ -697,6 +1609,7 @@ private:
             node_to_delete.set_parent_index(NULL_INDEX);
             node_to_delete.set_left_index(NULL_INDEX);
             node_to_delete.set_right_index(NULL_INDEX);
+            update_subtree_data_up_to_root(replacement_node.parent_index());
 
             if (node_to_delete.color() == COLOR_BLACK)
             {
@@ -707,6 +1620,10 @@ private:
         {
             // If there are no children
             RedBlackTreeNodeView node_to_delete = tree_storage_at(index_to_delete);
+            // The node stays linked during the fixup, as an empty subtree. It is never rotated
+            // itself, only its ancestors are.
+            clear_subtree_data_at(index_to_delete);
+            update_subtree_data_up_to_root(node_to_delete.parent_index());
             if (node_to_delete.color() == COLOR_BLACK)
             {
                 fix_after_deletion(index_to_delete);
@@ -734,10 +1651,13 @@ private:
 
         if (repositioned_index != index_to_delete)
         {
+            move_subtree_data(repositioned_index, index_to_delete);
             Ops::fixup_neighbours_of_node_to_point_to_a_new_index(
                 *this, tree_storage_at(index_to_delete), ret.repositioned, index_to_delete);
             fixup_repositioned_index(
                 IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_, ret.repositioned, index_to_delete);
+            fixup_repositioned_index(
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_, ret.repositioned, index_to_delete);
             fixup_repositioned_index(ret.successor, ret.repositioned, index_to_delete);
         }
 
@@ -823,6 +1743,154 @@ private:
         set_color(idx, COLOR_BLACK);
     }
 
+    [[nodiscard]] constexpr auto subtree_data_of(const NodeIndex& index) const
+        requires HAS_AUGMENTATION
+    {
+        if (index == NULL_INDEX)
+        {
+            return AugmentationTraits::identity();
+        }
+        return this->IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_data_[index];
+    }
+
+    [[nodiscard]] constexpr auto lift_at(const NodeIndex& index) const
+        requires HAS_AUGMENTATION
+    {
+        if constexpr (HAS_ASSOCIATED_VALUE)
+        {
+            return AugmentationTraits::lift(tree_storage().key(index), tree_storage().value(index));
+        }
+        else
+        {
+            return AugmentationTraits::lift(tree_storage().key(index));
+        }
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr auto aggregate_of_keys_not_less_than(const NodeIndex& subtree_root,
+                                                                 const K0& from) const
+        requires HAS_AUGMENTATION
+    {
+        auto result = AugmentationTraits::identity();
+        NodeIndex i = subtree_root;
+        while (i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(i);
+            if (IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(node.key(), from))
+            {
+                i = node.right_index();
+                continue;
+            }
+            // The node and its right subtree are in, before anything that was already found
+            result = AugmentationTraits::combine(
+                AugmentationTraits::combine(lift_at(i), subtree_data_of(node.right_index())),
+                result);
+            i = node.left_index();
+        }
+        return result;
+    }
+
+    template <class K1>
+    [[nodiscard]] constexpr auto aggregate_of_keys_less_than(const NodeIndex& subtree_root,
+                                                             const K1& to) const
+        requires HAS_AUGMENTATION
+    {
+        auto result = AugmentationTraits::identity();
+        NodeIndex i = subtree_root;
+        while (i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(i);
+            if (!IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_(node.key(), to))
+            {
+                i = node.left_index();
+                continue;
+            }
+            // The left subtree and the node are in, after anything that was already found
+            result = AugmentationTraits::combine(
+                result,
+                AugmentationTraits::combine(subtree_data_of(node.left_index()), lift_at(i)));
+            i = node.right_index();
+        }
+        return result;
+    }
+
+    // The subtree at `subtree_root` must satisfy `predicate`
+    template <class Predicate>
+    [[nodiscard]] constexpr NodeIndex index_of_first_matching_in_subtree(
+        const NodeIndex& subtree_root, const Predicate& predicate) const
+    {
+        NodeIndex i = subtree_root;
+        while (i != NULL_INDEX)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(i);
+            if (node.left_index() != NULL_INDEX && predicate(subtree_data_of(node.left_index())))
+            {
+                i = node.left_index();
+            }
+            else if (predicate(lift_at(i)))
+            {
+                return i;
+            }
+            else
+            {
+                i = node.right_index();
+            }
+        }
+        return NULL_INDEX;
+    }
+
+    // These do nothing for trees without augmentation
+    constexpr void update_subtree_data_at(const NodeIndex& index)
+    {
+        if constexpr (HAS_AUGMENTATION)
+        {
+            const RedBlackTreeNodeView node = tree_storage_at(index);
+            this->IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_data_[index] =
+                AugmentationTraits::combine(
+                    AugmentationTraits::combine(subtree_data_of(node.left_index()),
+                                                lift_at(index)),
+                    subtree_data_of(node.right_index()));
+        }
+    }
+
+    constexpr void update_subtree_data_up_to_root(const NodeIndex& index)
+    {
+        if constexpr (HAS_AUGMENTATION)
+        {
+            for (NodeIndex i = index; i != NULL_INDEX; i = tree_storage().parent_index(i))
+            {
+                update_subtree_data_at(i);
+            }
+        }
+    }
+
+    constexpr void clear_subtree_data_at(const NodeIndex& index)
+    {
+        if constexpr (HAS_AUGMENTATION)
+        {
+            this->IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_data_[index] =
+                AugmentationTraits::identity();
+        }
+    }
+
+    constexpr void swap_subtree_data(const NodeIndex& index_i, const NodeIndex& index_j)
+    {
+        if constexpr (HAS_AUGMENTATION)
+        {
+            std::swap(this->IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_data_[index_i],
+                      this->IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_data_[index_j]);
+        }
+    }
+
+    constexpr void move_subtree_data(const NodeIndex& from_index, const NodeIndex& to_index)
+    {
+        if constexpr (HAS_AUGMENTATION)
+        {
+            this->IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_data_[to_index] =
+                this->IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_data_[from_index];
+        }
+    }
+
     constexpr void fixup_repositioned_index(NodeIndex& index,
                                             const NodeIndex old_index,
                                             const NodeIndex new_index) const noexcept
@@ -848,6 +1916,42 @@ protected:  // [WORKAROUND-1]
     {
         IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ = new_root_index;
     }
+    [[nodiscard]] constexpr const NodeIndex& max_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_;
+    }
+    constexpr void set_max_index(const NodeIndex& new_max_index)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_ = new_max_index;
+    }
+
+    // Children before parents, iteratively with the parent links
+    constexpr void update_subtree_data_of_all_nodes()
+    {
+        if constexpr (HAS_AUGMENTATION)
+        {
+            NodeIndex previous = NULL_INDEX;
+            NodeIndex i = root_index();
+            while (i != NULL_INDEX)
+            {
+                const RedBlackTreeNodeView node = tree_storage_at(i);
+                const bool from_parent = previous == node.parent_index();
+                if (from_parent && node.left_index() != NULL_INDEX)
+                {
+                    previous = std::exchange(i, node.left_index());
+                    continue;
+                }
+                if ((from_parent || previous == node.left_index()) &&
+                    node.right_index() != NULL_INDEX)
+                {
+                    previous = std::exchange(i, node.right_index());
+                    continue;
+                }
+                update_subtree_data_at(i);
+                previous = std::exchange(i, node.parent_index());
+            }
+        }
+    }
 };
 
 }  // namespace fixed_containers::fixed_red_black_tree_detail
@@ -864,13 +1968,24 @@ template <class K,
                            here. clang accepts it */
                     ,
                     std::size_t>
-          typename StorageTemplate>
+          typename StorageTemplate,
+          class Augmentation>
 class FixedRedBlackTree
-  : public fixed_red_black_tree_detail::
-        FixedRedBlackTreeBase<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>
+  : public fixed_red_black_tree_detail::FixedRedBlackTreeBase<K,
+                                                              V,
+                                                              MAXIMUM_SIZE,
+                                                              Compare,
+                                                              COMPACTNESS,
+                                                              StorageTemplate,
+                                                              Augmentation>
 {
-    using Base = fixed_red_black_tree_detail::
-        FixedRedBlackTreeBase<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+    using Base = fixed_red_black_tree_detail::FixedRedBlackTreeBase<K,
+                                                                    V,
+                                                                    MAXIMUM_SIZE,
+                                                                    Compare,
+                                                                    COMPACTNESS,
+                                                                    StorageTemplate,
+                                                                    Augmentation>;
     using Ops = FixedRedBlackTreeOps<FixedRedBlackTree>;
     friend Ops;
 
@@ -893,43 +2008,19 @@ public:
         requires TriviallyMoveAssignable<K> && TriviallyMoveAssignable<V>
     = default;
 
-    // TODO: Use O(N) algorithm. Do non-recursive
+    constexpr void nontrivial_copy_impl(const FixedRedBlackTree& other) { clone_impl(other); }
+
+    constexpr void nontrivial_move_impl(FixedRedBlackTree& other) { clone_impl(other); }
+
     constexpr FixedRedBlackTree(const FixedRedBlackTree& other)
-      : FixedRedBlackTree()
+      : FixedRedBlackTree(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_)
     {
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            const auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(np_idxs, node.key(), node.value());
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, node.key());
-            }
-        }
+        nontrivial_copy_impl(other);
     }
     constexpr FixedRedBlackTree(FixedRedBlackTree&& other) noexcept
-      : FixedRedBlackTree()
+      : FixedRedBlackTree(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_)
     {
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(
-                    np_idxs, std::move(node.key()), std::move(node.value()));
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, std::move(node.key()));
-            }
-        }
+        nontrivial_move_impl(other);
         // Clear the moved-out-of-map. This is consistent with both std::map
         // as well as the trivial move constructor of this class.
         other.clear();
@@ -942,20 +2033,9 @@ public:
         }
 
         this->clear();
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            const auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(np_idxs, node.key(), node.value());
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, node.key());
-            }
-        }
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+        nontrivial_copy_impl(other);
         return *this;
     }
     constexpr FixedRedBlackTree& operator=(FixedRedBlackTree&& other) noexcept
@@ -966,21 +2046,9 @@ public:
         }
 
         this->clear();
-        for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
-             i = other.index_of_successor_at(i))
-        {
-            auto node = other.tree_storage_at(i);
-            NodeIndexAndParentIndex np_idxs = this->index_of_node_with_parent(node.key());
-            if constexpr (Base::HAS_ASSOCIATED_VALUE)
-            {
-                this->insert_if_not_present_at(
-                    np_idxs, std::move(node.key()), std::move(node.value()));
-            }
-            else
-            {
-                this->insert_if_not_present_at(np_idxs, std::move(node.key()));
-            }
-        }
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_;
+        nontrivial_move_impl(other);
         // The trivial assignment operator does not `other.clear()`, so don't do it here either for
         // consistency across FixedMaps. std::map<T> does clear it, so behavior is different.
         // Both choices are fine, because the state of a moved object is intentionally unspecified
@@ -989,6 +2057,34 @@ public:
     }
 
     constexpr ~FixedRedBlackTree() noexcept { this->clear(); }
+
+private:
+    // Warning: assumes the destination (`this`) is already clear of any values!
+    // Re-inserting every entry would cost O(n log n) comparisons plus the rebalancing. Instead,
+    // every node goes to the same index with the same links and color, so only the keys and
+    // values are copied (or moved, for a non-const `other`) and no key is compared.
+    template <class OtherTree>
+    constexpr void clone_impl(OtherTree& other)
+    {
+        this->tree_storage().clone_nodes_from(
+            other.tree_storage(),
+            other.size(),
+            [&other](const auto& visit)
+            {
+                for (NodeIndex i = other.index_of_min_at(); i != NULL_INDEX;
+                     i = other.index_of_successor_at(i))
+                {
+                    visit(i);
+                }
+            });
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_root_index_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_size_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_size_;
+        this->IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_max_index_;
+        this->update_subtree_data_of_all_nodes();
+    }
 };
 
 template <TriviallyCopyable K,
@@ -1000,13 +2096,24 @@ template <TriviallyCopyable K,
                            here. clang accepts it */
                     ,
                     std::size_t>
-          typename StorageTemplate>
-class FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>
-  : public fixed_red_black_tree_detail::
-        FixedRedBlackTreeBase<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>
+          typename StorageTemplate,
+          class Augmentation>
+class FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, Augmentation>
+  : public fixed_red_black_tree_detail::FixedRedBlackTreeBase<K,
+                                                              V,
+                                                              MAXIMUM_SIZE,
+                                                              Compare,
+                                                              COMPACTNESS,
+                                                              StorageTemplate,
+                                                              Augmentation>
 {
-    using Base = fixed_red_black_tree_detail::
-        FixedRedBlackTreeBase<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+    using Base = fixed_red_black_tree_detail::FixedRedBlackTreeBase<K,
+                                                                    V,
+                                                                    MAXIMUM_SIZE,
+                                                                    Compare,
+                                                                    COMPACTNESS,
+                                                                    StorageTemplate,
+                                                                    Augmentation>;
     using Ops = FixedRedBlackTreeOps<FixedRedBlackTree>;
     friend Ops;
 
@@ -1033,9 +2140,10 @@ template <class K,
                            here. clang accepts it */
                     ,
                     std::size_t>
-          typename StorageTemplate = FixedIndexBasedPoolStorage>
+          typename StorageTemplate = FixedIndexBasedPoolStorage,
+          class Augmentation = NoTreeAugmentation>
 using FixedRedBlackTree = fixed_red_black_tree_detail::specializations::
-    FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+    FixedRedBlackTree<K, V, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, Augmentation>;
 
 template <class K,
           std::size_t MAXIMUM_SIZE,
@@ -1043,7 +2151,13 @@ template <class K,
           RedBlackTreeNodeColorCompactness COMPACTNESS =
               RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
           template <IsFixedIndexBasedStorage, std::size_t> typename StorageTemplate =
-              FixedIndexBasedPoolStorage>
-using FixedRedBlackTreeSet =
-    FixedRedBlackTree<K, EmptyValue, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+              FixedIndexBasedPoolStorage,
+          class Augmentation = NoTreeAugmentation>
+using FixedRedBlackTreeSet = FixedRedBlackTree<K,
+                                               EmptyValue,
+                                               MAXIMUM_SIZE,
+                                               Compare,
+                                               COMPACTNESS,
+                                               StorageTemplate,
+                                               Augmentation>;
 }  // namespace fixed_containers::fixed_red_black_tree_detail
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "fixed_containers/fixed_red_black_tree_types.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+
+namespace fixed_containers
+{
+// Data about every subtree that the red-black tree of `FixedMap` and `FixedSet` can keep up to
+// date through insertions, deletions and rotations. The default keeps nothing and costs nothing.
+struct NoTreeAugmentation
+{
+};
+
+// Keeps the number of entries of every subtree, for `nth()`, `rank()` and `count_in_range()` in
+// O(log n) instead of walking the entries one by one. Costs one narrow index per entry.
+struct OrderStatisticTreeAugmentation
+{
+};
+
+/**
+ * Any other augmentation is a policy that folds the entries of every subtree into one
+ * `value_type`, e.g. the sum of the quantities or the largest end of a set of intervals:
+ *  - `lift(key, value)` (or `lift(key)`, also for sets) is the data of a single entry
+ *  - `combine(left, right)` joins the data of two adjacent ranges, left one first. It must be
+ *    associative, but not necessarily commutative
+ *  - `identity()` is the data of an empty range, neutral for `combine()`
+ *
+ * All three are static. The containers then offer `aggregate()`, `aggregate_in_range()` and
+ * `find_first_by_aggregate()` in O(log n).
+ */
+template <class Policy, class K, class V>
+concept TreeAggregatePolicy =
+    std::semiregular<typename Policy::value_type> &&
+    requires(const K& key, const V& value, const typename Policy::value_type& data) {
+        { Policy::identity() } -> std::convertible_to<typename Policy::value_type>;
+        { Policy::combine(data, data) } -> std::convertible_to<typename Policy::value_type>;
+    } &&
+    (requires(const K& key, const V& value) {
+        { Policy::lift(key, value) } -> std::convertible_to<typename Policy::value_type>;
+    } || requires(const K& key) {
+        { Policy::lift(key) } -> std::convertible_to<typename Policy::value_type>;
+    });
+
+// Aggregates that depend on the mapped values, which then can only change in ways that keep the
+// aggregates up to date.
+template <class Policy, class K, class V>
+concept TreeAggregatePolicyOfValues =
+    TreeAggregatePolicy<Policy, K, V> &&
+    requires(const K& key, const V& value) { Policy::lift(key, value); };
+}  // namespace fixed_containers
+
+namespace fixed_containers::fixed_red_black_tree_detail
+{
+// The data of a subtree is `combine(combine(left, lift(node)), right)`, with `identity()` for null
+// subtrees.
+template <class Augmentation, class K, class V, std::size_t MAXIMUM_SIZE>
+struct TreeAugmentationTraits
+{
+    static constexpr bool ENABLED = false;
+};
+
+template <class K, class V, std::size_t MAXIMUM_SIZE>
+struct TreeAugmentationTraits<OrderStatisticTreeAugmentation, K, V, MAXIMUM_SIZE>
+{
+    static constexpr bool ENABLED = true;
+    // Any subtree size fits, as it is at most MAXIMUM_SIZE
+    using DataType = NodeIndexStorage<MAXIMUM_SIZE>;
+
+    static constexpr DataType identity() { return 0; }
+    template <class... Entry>
+    static constexpr DataType lift(const Entry&... /*entry*/)
+    {
+        return 1;
+    }
+    static constexpr DataType combine(const DataType& left, const DataType& right)
+    {
+        return static_cast<DataType>(left + right);
+    }
+};
+
+template <class Policy, class K, class V, std::size_t MAXIMUM_SIZE>
+    requires TreeAggregatePolicy<Policy, K, V>
+struct TreeAugmentationTraits<Policy, K, V, MAXIMUM_SIZE>
+{
+    static constexpr bool ENABLED = true;
+    using DataType = typename Policy::value_type;
+
+    static constexpr DataType identity() { return Policy::identity(); }
+    static constexpr DataType lift(const K& key, const V& value)
+    {
+        if constexpr (requires { Policy::lift(key, value); })
+        {
+            return Policy::lift(key, value);
+        }
+        else
+        {
+            return Policy::lift(key);
+        }
+    }
+    static constexpr DataType lift(const K& key)
+        requires requires { Policy::lift(key); }
+    {
+        return Policy::lift(key);
+    }
+    static constexpr DataType combine(const DataType& left, const DataType& right)
+    {
+        return Policy::combine(left, right);
+    }
+};
+
+// The data is kept apart from the nodes, at the index of the node, so the nodes have the same
+// layout with and without augmentation. Trees without augmentation get an empty base.
+template <class Traits, std::size_t MAXIMUM_SIZE>
+class FixedRedBlackTreeAugmentationStorage
+{
+};
+
+template <class Traits, std::size_t MAXIMUM_SIZE>
+    requires(Traits::ENABLED)
+class FixedRedBlackTreeAugmentationStorage<Traits, MAXIMUM_SIZE>
+{
+public:  // Public so this type is a structural type and can thus be used in template parameters
+    std::array<typename Traits::DataType, MAXIMUM_SIZE>
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_data_{};
+};
+
+}  // namespace fixed_containers::fixed_red_black_tree_detail
@@ -46,7 +46,7 @@ concept IsRedBlackTreeNodeWithValue =
         mutable_s.value();
     };
 
-template <class K, class V = EmptyValue>
+template <class K, class V = EmptyValue, class IndexStorage = NodeIndex>
 class DefaultRedBlackTreeNode
 {
 public:
@@ -57,9 +57,12 @@ public:
 public:  // Public so this type is a structural type and can thus be used in template parameters
     K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
     V IMPLEMENTATION_DETAIL_DO_NOT_USE_value_;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = NULL_INDEX;
+    IndexStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ =
+        to_node_index_storage<IndexStorage>(NULL_INDEX);
+    IndexStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ =
+        to_node_index_storage<IndexStorage>(NULL_INDEX);
+    IndexStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ =
+        to_node_index_storage<IndexStorage>(NULL_INDEX);
     NodeColor IMPLEMENTATION_DETAIL_DO_NOT_USE_color_ = COLOR_BLACK;
 
 public:
@@ -88,27 +91,30 @@ public:
 
     [[nodiscard]] constexpr NodeIndex parent_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_;
+        return from_node_index_storage(IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_);
     }
     constexpr void set_parent_index(const NodeIndex& new_parent_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = new_parent_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ =
+            to_node_index_storage<IndexStorage>(new_parent_index);
     }
     [[nodiscard]] constexpr NodeIndex left_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_;
+        return from_node_index_storage(IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_);
     }
     constexpr void set_left_index(const NodeIndex& new_left_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = new_left_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ =
+            to_node_index_storage<IndexStorage>(new_left_index);
     }
     [[nodiscard]] constexpr NodeIndex right_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_;
+        return from_node_index_storage(IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_);
     }
     constexpr void set_right_index(const NodeIndex& new_right_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = new_right_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ =
+            to_node_index_storage<IndexStorage>(new_right_index);
     }
     [[nodiscard]] constexpr NodeColor color() const
     {
@@ -120,8 +126,8 @@ public:
     }
 };
 
-template <class K>
-class DefaultRedBlackTreeNode<K, EmptyValue>
+template <class K, class IndexStorage>
+class DefaultRedBlackTreeNode<K, EmptyValue, IndexStorage>
 {
 public:
     using KeyType = K;
@@ -130,9 +136,12 @@ public:
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
     K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = NULL_INDEX;
+    IndexStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ =
+        to_node_index_storage<IndexStorage>(NULL_INDEX);
+    IndexStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ =
+        to_node_index_storage<IndexStorage>(NULL_INDEX);
+    IndexStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ =
+        to_node_index_storage<IndexStorage>(NULL_INDEX);
     NodeColor IMPLEMENTATION_DETAIL_DO_NOT_USE_color_ = COLOR_BLACK;
 
 public:
@@ -150,27 +159,30 @@ public:
 
     [[nodiscard]] constexpr NodeIndex parent_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_;
+        return from_node_index_storage(IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_);
     }
     constexpr void set_parent_index(const NodeIndex& new_parent_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ = new_parent_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_ =
+            to_node_index_storage<IndexStorage>(new_parent_index);
     }
     [[nodiscard]] constexpr NodeIndex left_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_;
+        return from_node_index_storage(IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_);
     }
     constexpr void set_left_index(const NodeIndex& new_left_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = new_left_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ =
+            to_node_index_storage<IndexStorage>(new_left_index);
     }
     [[nodiscard]] constexpr NodeIndex right_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_;
+        return from_node_index_storage(IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_);
     }
     constexpr void set_right_index(const NodeIndex& new_right_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = new_right_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ =
+            to_node_index_storage<IndexStorage>(new_right_index);
     }
     [[nodiscard]] constexpr NodeColor color() const
     {
@@ -186,7 +198,7 @@ public:
 // https://github.com/boostorg/intrusive/blob/a6339068471d26c59e56c1b416239563bb89d99a/include/boost/intrusive/detail/rbtree_node.hpp#L44
 // This is very good not just for the 1 byte saved, but because it improves alignment
 // characteristics.
-template <class K, class V = EmptyValue>
+template <class K, class V = EmptyValue, class IndexStorage = NodeIndex>
 class CompactRedBlackTreeNode
 {
 public:
@@ -198,10 +210,12 @@ public:  // Public so this type is a structural type and can thus be used in tem
     K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
     value_or_reference_storage_detail::ValueOrReferenceStorage<V>
         IMPLEMENTATION_DETAIL_DO_NOT_USE_value_;
-    NodeIndexWithColorEmbeddedInTheMostSignificantBit
+    NodeIndexWithColorEmbeddedInTheMostSignificantBit<IndexStorage>
         IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_and_color_{};
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = NULL_INDEX;
+    IndexStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ =
+        to_node_index_storage<IndexStorage>(NULL_INDEX);
+    IndexStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ =
+        to_node_index_storage<IndexStorage>(NULL_INDEX);
 
 public:
     template <typename... Args>
@@ -237,19 +251,21 @@ public:
     }
     [[nodiscard]] constexpr NodeIndex left_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_;
+        return from_node_index_storage(IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_);
     }
     constexpr void set_left_index(const NodeIndex& new_left_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = new_left_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ =
+            to_node_index_storage<IndexStorage>(new_left_index);
     }
     [[nodiscard]] constexpr NodeIndex right_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_;
+        return from_node_index_storage(IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_);
     }
     constexpr void set_right_index(const NodeIndex& new_right_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = new_right_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ =
+            to_node_index_storage<IndexStorage>(new_right_index);
     }
     [[nodiscard]] constexpr NodeColor color() const
     {
@@ -261,8 +277,8 @@ public:
     }
 };
 
-template <class K>
-class CompactRedBlackTreeNode<K, EmptyValue>
+template <class K, class IndexStorage>
+class CompactRedBlackTreeNode<K, EmptyValue, IndexStorage>
 {
 public:
     using KeyType = K;
@@ -271,10 +287,12 @@ public:
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
     K IMPLEMENTATION_DETAIL_DO_NOT_USE_key_;
-    NodeIndexWithColorEmbeddedInTheMostSignificantBit
+    NodeIndexWithColorEmbeddedInTheMostSignificantBit<IndexStorage>
         IMPLEMENTATION_DETAIL_DO_NOT_USE_parent_index_and_color_{};
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = NULL_INDEX;
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = NULL_INDEX;
+    IndexStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ =
+        to_node_index_storage<IndexStorage>(NULL_INDEX);
+    IndexStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ =
+        to_node_index_storage<IndexStorage>(NULL_INDEX);
 
 public:
     explicit constexpr CompactRedBlackTreeNode(const K& key) noexcept
@@ -299,19 +317,21 @@ public:
     }
     [[nodiscard]] constexpr NodeIndex left_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_;
+        return from_node_index_storage(IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_);
     }
     constexpr void set_left_index(const NodeIndex& new_left_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ = new_left_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_left_index_ =
+            to_node_index_storage<IndexStorage>(new_left_index);
     }
     [[nodiscard]] constexpr NodeIndex right_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_;
+        return from_node_index_storage(IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_);
     }
     constexpr void set_right_index(const NodeIndex& new_right_index)
     {
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ = new_right_index;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_right_index_ =
+            to_node_index_storage<IndexStorage>(new_right_index);
     }
     [[nodiscard]] constexpr NodeColor color() const
     {
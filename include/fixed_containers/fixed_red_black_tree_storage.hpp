@@ -1,9 +1,12 @@
 #pragma once
 
+#include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/fixed_index_based_storage.hpp"
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
 
+#include <cstddef>
+#include <memory>
 #include <type_traits>
 #include <utility>
 
@@ -58,8 +61,8 @@ public:
     using ValueType = V;
     using NodeType =
         std::conditional_t<COMPACTNESS == RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
-                           CompactRedBlackTreeNode<K, V>,
-                           DefaultRedBlackTreeNode<K, V>>;
+                           CompactRedBlackTreeNode<K, V, NodeIndexStorage<MAXIMUM_SIZE>>,
+                           DefaultRedBlackTreeNode<K, V, NodeIndexStorage<MAXIMUM_SIZE>>>;
     static constexpr bool HAS_ASSOCIATED_VALUE = NodeType::HAS_ASSOCIATED_VALUE;
     using size_type = typename StorageTemplate<NodeType, MAXIMUM_SIZE>::size_type;
     using difference_type = typename StorageTemplate<NodeType, MAXIMUM_SIZE>::difference_type;
@@ -148,6 +151,61 @@ public:
         return storage().delete_at_and_return_repositioned_index(index);
     }
 
+    // Makes the next emplaced nodes get the indices 0, 1, 2...
+    // Warning: Assumes `this` does not hold any node!
+    constexpr void reset_index_order()
+    {
+        if constexpr (requires(StorageTemplate<NodeType, MAXIMUM_SIZE>& pool) {
+                          pool.reset_freelist();
+                      })
+        {
+            storage().reset_freelist();
+        }
+    }
+
+    // Puts a copy of every node of `other` at the same index of `this`, links and color included.
+    // The nodes are moved instead if `other` is not const. `for_each_index(visit)` must call
+    // `visit(index)` for every index that holds a node of `other`.
+    // Warning: Assumes `this` does not hold any node!
+    template <class OtherStorage, class ForEachIndex>
+    constexpr void clone_nodes_from(OtherStorage& other,
+                                    const std::size_t node_count,
+                                    ForEachIndex for_each_index)
+    {
+        static_assert(std::is_same_v<std::remove_const_t<OtherStorage>, FixedRedBlackTreeStorage>);
+        const auto node_to_clone = [&other](const NodeIndex& index) -> decltype(auto)
+        {
+            if constexpr (std::is_const_v<OtherStorage>)
+            {
+                return other.storage().at(index);
+            }
+            else
+            {
+                return std::move(other.storage().at(index));
+            }
+        };
+
+        if constexpr (requires(StorageTemplate<NodeType, MAXIMUM_SIZE>& pool) {
+                          pool.set_freelist_state_from_other(pool);
+                      })
+        {
+            // Same freelist, then the nodes go into the slots that it leaves out
+            storage().set_freelist_state_from_other(other.storage());
+            for_each_index([this, &node_to_clone](const NodeIndex& index)
+                           { std::construct_at(&storage().at(index), node_to_clone(index)); });
+        }
+        else
+        {
+            // Storages without a freelist hand out indices in order and keep nodes in [0, count)
+            for (NodeIndex index = 0; index < node_count; index++)
+            {
+                [[maybe_unused]] const NodeIndex new_index =
+                    storage().emplace_and_return_index(node_to_clone(index));
+                assert_or_abort(new_index == index);
+            }
+        }
+    }
+
 private:
     [[nodiscard]] constexpr const StorageTemplate<NodeType, MAXIMUM_SIZE>& storage() const
     {
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/index_width.hpp"
 
 #include <cstddef>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
@@ -14,6 +17,35 @@ using NodeColor = bool;
 constexpr NodeColor COLOR_BLACK = false;
 constexpr NodeColor COLOR_RED = true;
 
+// The links of the nodes are stored in the smallest unsigned integer that can hold every index of
+// a tree with up to MAXIMUM_SIZE nodes plus the null index, with the most significant bit to
+// spare for the color. Indices keep crossing the API as `NodeIndex`, the narrowing only affects
+// how they are stored.
+inline constexpr std::size_t NODE_INDEX_RESERVED_BITS = 1;
+
+template <std::size_t MAXIMUM_SIZE>
+using NodeIndexStorage = index_width::SmallestIndexType<MAXIMUM_SIZE, NODE_INDEX_RESERVED_BITS>;
+
+// The null index is stored as the maximum value of the narrow type
+template <class IndexStorage>
+constexpr IndexStorage to_node_index_storage(const NodeIndex& index)
+{
+    constexpr IndexStorage LOCAL_NULL_INDEX = (std::numeric_limits<IndexStorage>::max)();
+    if (index == NULL_INDEX)
+    {
+        return LOCAL_NULL_INDEX;
+    }
+    assert_or_abort(index < LOCAL_NULL_INDEX);
+    return static_cast<IndexStorage>(index);
+}
+
+template <class IndexStorage>
+constexpr NodeIndex from_node_index_storage(const IndexStorage& stored_index)
+{
+    constexpr IndexStorage LOCAL_NULL_INDEX = (std::numeric_limits<IndexStorage>::max)();
+    return stored_index == LOCAL_NULL_INDEX ? NULL_INDEX : static_cast<NodeIndex>(stored_index);
+}
+
 // boost::container::map has the option to embed the color in one of the pointers
 // https://github.com/boostorg/intrusive/blob/a6339068471d26c59e56c1b416239563bb89d99a/include/boost/intrusive/detail/rbtree_node.hpp#L44
 // https://github.com/boostorg/intrusive/blob/a6339068471d26c59e56c1b416239563bb89d99a/include/boost/intrusive/pointer_plus_bits.hpp#L79
@@ -22,16 +54,21 @@ constexpr NodeColor COLOR_RED = true;
 // bits for storing the color. Also, note for subsequent comment: nullptr is at 0.
 //
 // This class does something similar, except it embeds the color in the high bits of the indexes.
-// This is because it is unlikely that we are going to need maps up to NodeIndex::max() and we
+// This is because it is unlikely that we are going to need maps up to IndexStorage::max() and we
 // care about values 0 to MAXIMUM_SIZE. Furthermore, NULL_INDEX is at max().
+template <class IndexStorage = NodeIndex>
 class NodeIndexWithColorEmbeddedInTheMostSignificantBit
 {
-    static constexpr std::size_t SHIFT_TO_MOST_SIGNIFICANT_BIT = sizeof(NodeIndex) * 8ULL - 1ULL;
-    static constexpr NodeIndex MASK = 1ULL << SHIFT_TO_MOST_SIGNIFICANT_BIT;
-    static constexpr NodeIndex LOCAL_NULL_INDEX = NULL_INDEX >> 1;
+    static_assert(std::is_unsigned_v<IndexStorage>);
+    static constexpr std::size_t SHIFT_TO_MOST_SIGNIFICANT_BIT =
+        sizeof(IndexStorage) * 8ULL - 1ULL;
+    static constexpr IndexStorage MASK =
+        static_cast<IndexStorage>(IndexStorage{1} << SHIFT_TO_MOST_SIGNIFICANT_BIT);
+    static constexpr IndexStorage LOCAL_NULL_INDEX =
+        (std::numeric_limits<IndexStorage>::max)() >> 1U;
 
 public:  // Public so this type is a structural type and can thus be used in template parameters
-    NodeIndex IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_;
+    IndexStorage IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_;
 
 public:
     constexpr NodeIndexWithColorEmbeddedInTheMostSignificantBit()
@@ -49,21 +86,22 @@ public:
 
     [[nodiscard]] constexpr NodeIndex get_index() const
     {
-        const NodeIndex ret = index_and_color() & (~MASK);
+        const IndexStorage ret = index_and_color() & static_cast<IndexStorage>(~MASK);
 
         if (ret == LOCAL_NULL_INDEX)
         {
             return NULL_INDEX;
         }
 
-        return ret;
+        return static_cast<NodeIndex>(ret);
     }
 
     constexpr void set_index(const NodeIndex index)
     {
         const NodeIndex actual_index = index == NULL_INDEX ? LOCAL_NULL_INDEX : index;
         assert_or_abort(actual_index <= LOCAL_NULL_INDEX);
-        index_and_color() = (index_and_color() & MASK) | actual_index;
+        index_and_color() =
+            static_cast<IndexStorage>((index_and_color() & MASK) | actual_index);
     }
 
     [[nodiscard]] constexpr NodeColor get_color() const
@@ -73,16 +111,17 @@ public:
 
     constexpr void set_color(const NodeColor new_color)
     {
-        index_and_color() = (~MASK & index_and_color()) |
-                            (static_cast<NodeIndex>(new_color) << SHIFT_TO_MOST_SIGNIFICANT_BIT);
+        index_and_color() = static_cast<IndexStorage>(
+            (static_cast<IndexStorage>(~MASK) & index_and_color()) |
+            (static_cast<IndexStorage>(new_color) << SHIFT_TO_MOST_SIGNIFICANT_BIT));
     }
 
 private:
-    [[nodiscard]] constexpr const NodeIndex& index_and_color() const
+    [[nodiscard]] constexpr const IndexStorage& index_and_color() const
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_;
     }
-    [[nodiscard]] constexpr NodeIndex& index_and_color()
+    [[nodiscard]] constexpr IndexStorage& index_and_color()
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_index_and_color_;
     }
@@ -101,6 +140,22 @@ struct SuccessorIndexAndRepositionedIndex
     NodeIndex repositioned;
 };
 
+// A valid red-black tree made of nodes of the storage that are not reachable from the root, e.g.
+// the parts of a tree being split. The black height is the number of black nodes on every path
+// from the root down to a missing child, root included.
+struct DetachedSubtree
+{
+    NodeIndex root = NULL_INDEX;
+    std::size_t black_height = 0;
+};
+
+struct SplitSubtrees
+{
+    DetachedSubtree less;
+    NodeIndex equal = NULL_INDEX;  // Detached, without children
+    DetachedSubtree greater;
+};
+
 enum class RedBlackTreeStorageType
 {
     FIXED_INDEX_POOL,
@@ -3,9 +3,13 @@
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
 #include "fixed_containers/fixed_red_black_tree_types.hpp"
+#include "fixed_containers/index_width.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <type_traits>
 
@@ -33,9 +37,11 @@ public:
     private:
         const std::byte* base_;
         std::size_t elem_size_bytes_;
+        std::size_t elem_align_bytes_;
         std::size_t max_size_bytes_;
         Compactness compactness_;
         StorageType storage_type_;
+        std::size_t index_size_bytes_;
         std::size_t storage_elem_size_bytes_;
 
         NodeIndex index_;
@@ -52,15 +58,20 @@ public:
 
         Iterator(const std::byte* ptr,
                  std::size_t elem_size_bytes,
+                 std::size_t elem_align_bytes,
                  std::size_t max_size_bytes,
                  Compactness compactness,
                  StorageType storage_type,
                  bool end = false) noexcept
           : base_{ptr}
           , elem_size_bytes_{elem_size_bytes}
+          , elem_align_bytes_{elem_align_bytes}
           , max_size_bytes_{max_size_bytes}
           , compactness_{compactness}
           , storage_type_{storage_type}
+          , index_size_bytes_{
+                index_width::smallest_index_size_bytes(
+                    max_size_bytes, fixed_red_black_tree_detail::NODE_INDEX_RESERVED_BITS)}
           , storage_elem_size_bytes_{storage_elem_size_bytes()}
           , index_{end ? NULL_INDEX : min_index()}
           , cur_pointer_{node_pointer(index_)}
@@ -68,7 +79,7 @@ public:
         }
 
         Iterator() noexcept
-          : Iterator(nullptr, {}, {}, {}, {}, false)
+          : Iterator(nullptr, {}, 1, {}, {}, {}, false)
         {
         }
 
@@ -159,11 +170,8 @@ public:
          */
         [[nodiscard]] NodeIndex left_index(NodeIndex index) const
         {
-            const auto* const node = node_pointer(index); /* key_ */
-            const auto parent_index_offset = align_up(elem_size_bytes_, sizeof(uintptr_t));
-            const auto left_index_offset =
-                static_cast<difference_type>(parent_index_offset + sizeof(NodeIndex));
-            return *reinterpret_cast<const NodeIndex*>(std::next(node, left_index_offset));
+            const auto left_index_offset = links_offset_bytes() + index_size_bytes_;
+            return read_index(node_pointer(index), left_index_offset, false);
         }
 
         /**
@@ -172,12 +180,8 @@ public:
          */
         [[nodiscard]] NodeIndex right_index(NodeIndex index) const
         {
-            const auto* const node = node_pointer(index);
-            const auto parent_index_offset = align_up(elem_size_bytes_, sizeof(uintptr_t));
-            const auto left_index_offset = parent_index_offset + sizeof(NodeIndex);
-            const auto right_index_offset =
-                static_cast<difference_type>(left_index_offset + sizeof(NodeIndex));
-            return *reinterpret_cast<const NodeIndex*>(std::next(node, right_index_offset));
+            const auto right_index_offset = links_offset_bytes() + (2 * index_size_bytes_);
+            return read_index(node_pointer(index), right_index_offset, false);
         }
 
         /**
@@ -186,28 +190,64 @@ public:
          */
         [[nodiscard]] NodeIndex parent_index(NodeIndex index) const
         {
-            using fixed_red_black_tree_detail::NodeIndexWithColorEmbeddedInTheMostSignificantBit;
-
-            const auto* const node = node_pointer(index);
-            const auto parent_index_offset =
-                static_cast<difference_type>(align_up(elem_size_bytes_, sizeof(uintptr_t)));
-            const auto* const parent_idx_ptr = std::next(node, parent_index_offset);
-
             switch (compactness_)
             {
             case Compactness::DEDICATED_COLOR: /* default node */
-                return *reinterpret_cast<const NodeIndex*>(parent_idx_ptr);
+                return read_index(node_pointer(index), links_offset_bytes(), false);
 
             case Compactness::EMBEDDED_COLOR: /* compact node*/
-                return reinterpret_cast<const NodeIndexWithColorEmbeddedInTheMostSignificantBit*>(
-                           parent_idx_ptr)
-                    ->get_index();
+                return read_index(node_pointer(index), links_offset_bytes(), true);
             }
 
             assert_or_abort(false);
             return NULL_INDEX;
         }
 
+        /**
+         * Read an index stored with the width the tree picks for `max_size_bytes_` (see
+         * `NodeIndexStorage`), in which the null index is the maximum value.
+         * If the color is embedded, it is in the most significant bit and is dropped.
+         */
+        [[nodiscard]] NodeIndex read_index(const std::byte* node,
+                                           std::size_t offset,
+                                           bool color_embedded) const
+        {
+            const auto* const index_ptr = std::next(node, static_cast<difference_type>(offset));
+            std::uint64_t stored = 0;
+            switch (index_size_bytes_)
+            {
+            case sizeof(std::uint8_t):
+                stored = *reinterpret_cast<const std::uint8_t*>(index_ptr);
+                break;
+            case sizeof(std::uint16_t):
+                stored = *reinterpret_cast<const std::uint16_t*>(index_ptr);
+                break;
+            case sizeof(std::uint32_t):
+                stored = *reinterpret_cast<const std::uint32_t*>(index_ptr);
+                break;
+            default:
+                stored = *reinterpret_cast<const std::uint64_t*>(index_ptr);
+                break;
+            }
+
+            std::uint64_t local_null_index = (std::numeric_limits<std::uint64_t>::max)() >>
+                                             (64U - (8U * index_size_bytes_));
+            if (color_embedded)
+            {
+                local_null_index >>= 1U;
+                stored &= local_null_index;
+            }
+            return stored == local_null_index ? NULL_INDEX : static_cast<NodeIndex>(stored);
+        }
+
+        /**
+         * The links come right after the key, aligned to the width of the indices.
+         */
+        [[nodiscard]] std::size_t links_offset_bytes() const
+        {
+            return align_up(elem_size_bytes_, index_size_bytes_);
+        }
+
         /**
          * Traverse the tree starting at the node corresponding to `index` to find the successor
          * node and return its index.
@@ -329,7 +369,8 @@ public:
             {
             case StorageType::FIXED_INDEX_POOL:
                 // IndexOrValueStorage is a union containing a size_t (index) or the node itself.
-                return std::max(sizeof(std::size_t), node_size_bytes);
+                return align_up(std::max(sizeof(std::size_t), node_size_bytes),
+                                std::max(alignof(std::size_t), tree_node_align_bytes()));
 
             case StorageType::FIXED_INDEX_CONTIGUOUS:
                 return node_size_bytes;
@@ -341,49 +382,46 @@ public:
 
         /**
          * Calculate the size of each tree node used in the red-black tree, using the input sizes
-         * as the size of the key and value types.
+         * as the size of the key and value types: the key, then the parent, left and right
+         * indices, then the color if it is not embedded in the parent index.
          */
         [[nodiscard]] std::size_t tree_node_size_bytes() const
         {
-            using fixed_red_black_tree_detail::CompactRedBlackTreeNode;
-            using fixed_red_black_tree_detail::DefaultRedBlackTreeNode;
-
-            /*
-             * Calculate the size of the tree node by calculating the compile-time size with a
-             * native pointer type as the Key, adding the size of the value type, subtracting the
-             * pointer size from the result and rounding up for alignment.
-             */
-            std::size_t base_node_size_bytes = 0;
-            switch (compactness_)
+            std::size_t links_size_bytes = 3 * index_size_bytes_;
+            if (compactness_ == Compactness::DEDICATED_COLOR)
             {
-            case Compactness::DEDICATED_COLOR:
-                base_node_size_bytes = sizeof(DefaultRedBlackTreeNode<uintptr_t>);
-                break;
-            case Compactness::EMBEDDED_COLOR:
-                base_node_size_bytes = sizeof(CompactRedBlackTreeNode<uintptr_t>);
-                break;
+                links_size_bytes += sizeof(fixed_red_black_tree_detail::NodeColor);
             }
+            return align_up(links_offset_bytes() + links_size_bytes, tree_node_align_bytes());
+        }
 
-            return align_up(base_node_size_bytes - sizeof(uintptr_t) + elem_size_bytes_,
-                            sizeof(uintptr_t));
+        [[nodiscard]] std::size_t tree_node_align_bytes() const
+        {
+            return std::max(elem_align_bytes_, index_size_bytes_);
         }
     };
 
 private:
     const std::byte* tree_ptr_;
     const std::size_t elem_size_bytes_;
+    const std::size_t elem_align_bytes_;
     const std::size_t max_size_bytes_;
     const Compactness compactness_;
     const StorageType storage_type_;
 
 public:
+    // `elem_align_bytes` (the `alignof` of the element) locates the narrow links inside the nodes.
+    // It was added as the third argument, so callers of the former five-argument constructor must
+    // be updated.
     FixedRedBlackTreeRawView(const void* tree_ptr,
                              std::size_t elem_size_bytes,
+                             std::size_t elem_align_bytes,
                              std::size_t max_size_bytes,
                              Compactness compactness,
                              StorageType storage_type)
       : tree_ptr_{reinterpret_cast<const std::byte*>(tree_ptr)}
       , elem_size_bytes_{elem_size_bytes}
+      , elem_align_bytes_{elem_align_bytes}
       , max_size_bytes_{max_size_bytes}
       , compactness_{compactness}
       , storage_type_{storage_type}
@@ -392,13 +430,23 @@ public:
 
     [[nodiscard]] Iterator begin() const
     {
-        return Iterator(tree_ptr_, elem_size_bytes_, max_size_bytes_, compactness_, storage_type_);
+        return Iterator(tree_ptr_,
+                        elem_size_bytes_,
+                        elem_align_bytes_,
+                        max_size_bytes_,
+                        compactness_,
+                        storage_type_);
     }
 
     [[nodiscard]] Iterator end() const
     {
-        return Iterator(
-            tree_ptr_, elem_size_bytes_, max_size_bytes_, compactness_, storage_type_, true);
+        return Iterator(tree_ptr_,
+                        elem_size_bytes_,
+                        elem_align_bytes_,
+                        max_size_bytes_,
+                        compactness_,
+                        storage_type_,
+                        true);
     }
 
     [[nodiscard]] std::size_t size() const { return end().size(); }
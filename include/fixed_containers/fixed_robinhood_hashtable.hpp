@@ -1,11 +1,18 @@
 #pragma once
 
+#include "fixed_containers/concepts.hpp"
 #include "fixed_containers/fixed_doubly_linked_list.hpp"
+#include "fixed_containers/fixed_vector.hpp"
+#include "fixed_containers/index_width.hpp"
 #include "fixed_containers/map_entry.hpp"
+#include "fixed_containers/memory.hpp"
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstdint>
+#include <span>
+#include <type_traits>
 #include <utility>
 
 // This is a modified version of the dense hashmap from https://github.com/martinus/unordered_dense,
@@ -37,115 +44,231 @@
 namespace fixed_containers::fixed_robinhood_hashtable_detail
 {
 
-// TODO: Include a "giant bucket" to support > 2^24 elements
-struct Bucket
+template <typename DistAndFingerprintT, typename ValueIndexT>
+struct BasicBucket
 {
-    using DistAndFingerprintType = std::uint32_t;
-    using ValueIndexType = std::uint32_t;
+    using DistAndFingerprintType = DistAndFingerprintT;
+    using ValueIndexType = ValueIndexT;
 
     // control how many bits to use for the hash fingerprint. The rest are used as the distance
     // between this element and its "ideal" location in the table
     static constexpr DistAndFingerprintType FINGERPRINT_BITS = 8;
 
-    static constexpr DistAndFingerprintType DIST_INC = 1U << FINGERPRINT_BITS;
+    static constexpr DistAndFingerprintType DIST_INC = DistAndFingerprintType{1}
+                                                       << FINGERPRINT_BITS;
     static constexpr DistAndFingerprintType FINGERPRINT_MASK = DIST_INC - 1;
 
     // we can only track a bucket this far away from its ideal location. In a pathological worst
     // case, every bucket is a collision so we can only guarantee correct behavior up to this bucket
     // count.
     static constexpr std::size_t MAX_NUM_BUCKETS =
-        (1U << (sizeof(DistAndFingerprintType) * 8 - FINGERPRINT_BITS)) - 1;
+        (std::uint64_t{1} << (sizeof(DistAndFingerprintType) * 8 - FINGERPRINT_BITS)) - 1;
 
     DistAndFingerprintType dist_and_fingerprint_;
     ValueIndexType value_index_;
 
     [[nodiscard]] constexpr DistAndFingerprintType dist() const
     {
-        return dist_and_fingerprint_ >> FINGERPRINT_BITS;
+        return static_cast<DistAndFingerprintType>(dist_and_fingerprint_ >> FINGERPRINT_BITS);
     }
 
     [[nodiscard]] constexpr DistAndFingerprintType fingerprint() const
     {
-        return dist_and_fingerprint_ & FINGERPRINT_MASK;
+        return static_cast<DistAndFingerprintType>(dist_and_fingerprint_ & FINGERPRINT_MASK);
     }
 
     [[nodiscard]] static constexpr DistAndFingerprintType dist_and_fingerprint_from_hash(
         std::uint64_t hash)
     {
-        return DIST_INC | (static_cast<DistAndFingerprintType>(hash) & FINGERPRINT_MASK);
+        return static_cast<DistAndFingerprintType>(
+            DIST_INC | (static_cast<DistAndFingerprintType>(hash) & FINGERPRINT_MASK));
     }
 
     [[nodiscard]] static constexpr DistAndFingerprintType increment_dist(
         DistAndFingerprintType dist_and_fingerprint)
     {
-        return dist_and_fingerprint + DIST_INC;
+        return static_cast<DistAndFingerprintType>(dist_and_fingerprint + DIST_INC);
     }
 
     [[nodiscard]] static constexpr DistAndFingerprintType decrement_dist(
         DistAndFingerprintType dist_and_fingerprint)
     {
-        return dist_and_fingerprint - DIST_INC;
+        return static_cast<DistAndFingerprintType>(dist_and_fingerprint - DIST_INC);
     }
 
-    [[nodiscard]] constexpr Bucket plus_dist() const
+    [[nodiscard]] constexpr BasicBucket plus_dist() const
     {
         return {increment_dist(dist_and_fingerprint_), value_index_};
     }
 
-    [[nodiscard]] constexpr Bucket minus_dist() const
+    [[nodiscard]] constexpr BasicBucket minus_dist() const
     {
         return {decrement_dist(dist_and_fingerprint_), value_index_};
     }
 };
 
+using Bucket = BasicBucket<std::uint32_t, std::uint32_t>;
+
+// Tables with up to 255 buckets fit the distance in the 8 bits next to the fingerprint, tables with
+// more than 2^24 buckets need the "giant" 64-bit buckets.
+template <std::size_t INTERNAL_TABLE_SIZE>
+using DistAndFingerprintTypeFor = std::conditional_t<
+    INTERNAL_TABLE_SIZE <= BasicBucket<std::uint16_t, std::uint8_t>::MAX_NUM_BUCKETS,
+    std::uint16_t,
+    std::conditional_t<INTERNAL_TABLE_SIZE <= Bucket::MAX_NUM_BUCKETS,
+                       std::uint32_t,
+                       std::uint64_t>>;
+
+enum class BucketIndexing
+{
+    // `hash % BUCKET_COUNT`. Works with any bucket count, but costs an integer division.
+    MODULO,
+    // Rounds the bucket count up to a power of two and masks the hash. The cheapest mapping, but
+    // relies on the low bits of the hash being well mixed.
+    POWER_OF_TWO_MASK,
+    // Lemire's multiply-shift "fastrange" reduction of the upper bits of the hash. Works with any
+    // bucket count without a division, but relies on the high bits of the hash being well mixed.
+    FASTRANGE,
+};
+
+enum class ValueStorage
+{
+    // Values live in a doubly linked list, so iteration follows insertion order and erasing never
+    // moves other values.
+    LINKED_LIST,
+    // Values are contiguous. Erasing moves the last value into the hole, so iteration order is
+    // arbitrary and erasing invalidates iterators to the moved value, but iteration is a linear
+    // scan and the values can be accessed as a span.
+    DENSE,
+};
+
+struct RobinhoodHashtableOptions
+{
+    BucketIndexing bucket_indexing = BucketIndexing::MODULO;
+    ValueStorage value_storage = ValueStorage::LINKED_LIST;
+    // Keep the full hash of every value next to it, so that erasing and copying into other tables
+    // never has to hash a key again, at the cost of 8 bytes per value.
+    bool store_hashes = false;
+};
+
+// How far the values of a table are from their home buckets, see
+// `FixedRobinhoodHashtable::statistics()`. A successful lookup probes one bucket more than the
+// displacement of the value it finds.
+struct RobinhoodHashtableStatistics
+{
+    // Displacements this large or larger are all counted in the last slot of the histogram
+    static constexpr std::size_t HISTOGRAM_SIZE = 16;
+
+    std::size_t size = 0;
+    std::size_t bucket_count = 0;
+    std::size_t max_displacement = 0;
+    std::size_t total_displacement = 0;
+    std::array<std::size_t, HISTOGRAM_SIZE> displacement_histogram{};
+    // Buckets with the same home bucket and fingerprint as the value being looked up, but a
+    // different key, summed over the lookups of every value. Each costs a key comparison. In
+    // multimaps and multisets, this also counts the earlier values of a key for each later one.
+    std::size_t fingerprint_false_positives = 0;
+
+    [[nodiscard]] constexpr double load_factor() const
+    {
+        return static_cast<double>(size) / static_cast<double>(bucket_count);
+    }
+
+    [[nodiscard]] constexpr double mean_displacement() const
+    {
+        return size == 0 ? 0.0
+                         : static_cast<double>(total_displacement) / static_cast<double>(size);
+    }
+
+    [[nodiscard]] constexpr double mean_probe_length() const
+    {
+        return size == 0 ? 0.0 : mean_displacement() + 1.0;
+    }
+};
+
+[[nodiscard]] constexpr std::size_t internal_table_size(std::size_t bucket_count,
+                                                        BucketIndexing bucket_indexing)
+{
+    // 0 size is problematic because it leads to modulo 0 (undefined behavior)
+    const std::size_t nonzero_bucket_count = std::max<std::size_t>(1, bucket_count);
+    if (bucket_indexing == BucketIndexing::POWER_OF_TWO_MASK)
+    {
+        return std::bit_ceil(nonzero_bucket_count);
+    }
+    return nonzero_bucket_count;
+}
+
 template <typename K,
           typename V,
           std::size_t MAXIMUM_VALUE_COUNT,
           std::size_t BUCKET_COUNT,
           class Hash,
-          class KeyEqual>
+          class KeyEqual,
+          RobinhoodHashtableOptions OPTIONS = RobinhoodHashtableOptions{}>
 class FixedRobinhoodHashtable
 {
 public:
     using PairType = MapEntry<K, V>;
     using HashType = Hash;
     using KeyEqualType = KeyEqual;
-    using SizeType = Bucket::ValueIndexType;
+
+    static constexpr std::size_t CAPACITY = MAXIMUM_VALUE_COUNT;
+    static constexpr std::size_t INTERNAL_TABLE_SIZE =
+        internal_table_size(BUCKET_COUNT, OPTIONS.bucket_indexing);
+
+    // Index types are as narrow as the capacity and bucket count allow, so that small tables have
+    // small buckets and a small value list.
+    using SizeType = index_width::SmallestIndexType<CAPACITY + 1>;
+    using BucketIndexType = std::size_t;
+    using BucketType = BasicBucket<DistAndFingerprintTypeFor<INTERNAL_TABLE_SIZE>, SizeType>;
+
+    static constexpr bool DENSE_VALUE_STORAGE = OPTIONS.value_storage == ValueStorage::DENSE;
+    using ValueStorageType = std::conditional_t<
+        DENSE_VALUE_STORAGE,
+        FixedVector<PairType, CAPACITY>,
+        fixed_doubly_linked_list_detail::FixedDoublyLinkedList<PairType, CAPACITY, SizeType>>;
+
+    static constexpr bool STORE_HASHES = OPTIONS.store_hashes;
+    // Indexed like the values. Empty unless hashes are stored.
+    using StoredHashesType = std::array<std::uint64_t, STORE_HASHES ? CAPACITY : 0>;
 
     static_assert(MAXIMUM_VALUE_COUNT <= BUCKET_COUNT,
                   "need at least enough buckets to point to every value in array");
-    static_assert(BUCKET_COUNT <= Bucket::MAX_NUM_BUCKETS,
+    static_assert(INTERNAL_TABLE_SIZE <= BucketType::MAX_NUM_BUCKETS,
                   "specified too many buckets for the current bucket memory layout");
 
-    static constexpr std::size_t CAPACITY = MAXIMUM_VALUE_COUNT;
-    // 0 size is problematic because it leads to modulo 0 (undefined behavior)
-    static constexpr std::size_t INTERNAL_TABLE_SIZE = std::max<std::size_t>(1, BUCKET_COUNT);
-
-    fixed_doubly_linked_list_detail::FixedDoublyLinkedList<PairType, CAPACITY, SizeType>
-        IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_{};
-    std::array<Bucket, INTERNAL_TABLE_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_{};
+    ValueStorageType IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_{};
+    std::array<BucketType, INTERNAL_TABLE_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_{};
 
     Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{};
     KeyEqual IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_{};
+    StoredHashesType IMPLEMENTATION_DETAIL_DO_NOT_USE_stored_hashes_{};
+
+    struct NoKeyHash
+    {
+    };
 
     struct OpaqueIndexType
     {
-        SizeType bucket_index;
+        BucketIndexType bucket_index;
         // we need a dist_and_fingerprint for emplace(), but not for checks where the value exists.
         // We make this field pull double duty by setting it to 0 for keys that exist, but the valid
         // dist_and_fingerprint for those that don't.
-        Bucket::DistAndFingerprintType dist_and_fingerprint;
+        typename BucketType::DistAndFingerprintType dist_and_fingerprint;
+        // With stored hashes, the hash of a key that does not exist, so that `emplace()` does not
+        // have to hash it again. Fits in the padding otherwise.
+        std::conditional_t<STORE_HASHES, std::uint64_t, NoKeyHash> key_hash{};
     };
 
     using OpaqueIteratedType = SizeType;
 
     ////////////////////// helper functions
 public:
-    [[nodiscard]] constexpr Bucket& bucket_at(SizeType idx)
+    [[nodiscard]] constexpr BucketType& bucket_at(BucketIndexType idx)
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_[idx];
     }
-    [[nodiscard]] constexpr const Bucket& bucket_at(SizeType idx) const
+    [[nodiscard]] constexpr const BucketType& bucket_at(BucketIndexType idx) const
     {
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_[idx];
     }
@@ -162,18 +285,39 @@ public:
         return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(key1, key2);
     }
 
-    [[nodiscard]] static constexpr SizeType bucket_index_from_hash(std::uint64_t hash)
+    [[nodiscard]] static constexpr BucketIndexType bucket_index_from_hash(std::uint64_t hash)
     {
-        // Shift the hash right so that the bits of the hash used to compute the bucket index are
-        // totally distinct from the bits used in the fingerprint. Without this, the fingerprint
-        // would tend to be totally useless as it encodes information that the resident index of the
-        // bucket also encodes. This does not restrict the size of the table because we store the
-        // value_index in 32 bits, so the 56 left in this hash are plenty for our needs.
-        const std::uint64_t shifted_hash = hash >> Bucket::FINGERPRINT_BITS;
-        return static_cast<SizeType>(shifted_hash % INTERNAL_TABLE_SIZE);
+        if constexpr (OPTIONS.bucket_indexing == BucketIndexing::FASTRANGE)
+        {
+            // Map the upper 32 bits of the hash to [0, INTERNAL_TABLE_SIZE). These never overlap
+            // with the fingerprint bits, and the product can't overflow for tables with at most
+            // 2^32 buckets.
+            static_assert(INTERNAL_TABLE_SIZE <= (std::uint64_t{1} << 32U),
+                          "FASTRANGE indexing supports at most 2^32 buckets");
+            const std::uint64_t upper_hash = hash >> 32U;
+            return static_cast<BucketIndexType>((upper_hash * INTERNAL_TABLE_SIZE) >> 32U);
+        }
+        else
+        {
+            // Shift the hash right so that the bits of the hash used to compute the bucket index
+            // are totally distinct from the bits used in the fingerprint. Without this, the
+            // fingerprint would tend to be totally useless as it encodes information that the
+            // resident index of the bucket also encodes. This does not restrict the size of the
+            // table because even giant buckets only track 2^56 buckets, so the 56 left in this
+            // hash are plenty for our needs.
+            const std::uint64_t shifted_hash = hash >> BucketType::FINGERPRINT_BITS;
+            if constexpr (OPTIONS.bucket_indexing == BucketIndexing::POWER_OF_TWO_MASK)
+            {
+                return static_cast<BucketIndexType>(shifted_hash & (INTERNAL_TABLE_SIZE - 1));
+            }
+            else
+            {
+                return static_cast<BucketIndexType>(shifted_hash % INTERNAL_TABLE_SIZE);
+            }
+        }
     }
 
-    [[nodiscard]] static constexpr SizeType next_bucket_index(SizeType bucket_index)
+    [[nodiscard]] static constexpr BucketIndexType next_bucket_index(BucketIndexType bucket_index)
     {
         if (bucket_index + 1 < INTERNAL_TABLE_SIZE)
         {
@@ -182,7 +326,16 @@ public:
         return 0;
     }
 
-    constexpr void place_and_shift_up(Bucket bucket, SizeType table_loc)
+    [[nodiscard]] static constexpr BucketIndexType prev_bucket_index(BucketIndexType bucket_index)
+    {
+        if (bucket_index > 0)
+        {
+            return bucket_index - 1;
+        }
+        return INTERNAL_TABLE_SIZE - 1;
+    }
+
+    constexpr void place_and_shift_up(BucketType bucket, BucketIndexType table_loc)
     {
         // replace the current bucket at the location with the given bucket, bubbling up elements
         // until we hit an empty one
@@ -197,11 +350,11 @@ public:
 
     constexpr void erase_bucket(const OpaqueIndexType& index)
     {
-        SizeType table_loc = index.bucket_index;
+        BucketIndexType table_loc = index.bucket_index;
 
         // shift down until either empty or an element with correct spot is found
-        SizeType next_loc = next_bucket_index(table_loc);
-        while (bucket_at(next_loc).dist_and_fingerprint_ >= Bucket::DIST_INC * 2)
+        BucketIndexType next_loc = next_bucket_index(table_loc);
+        while (bucket_at(next_loc).dist_and_fingerprint_ >= BucketType::DIST_INC * 2)
         {
             bucket_at(table_loc) = bucket_at(next_loc).minus_dist();
             table_loc = std::exchange(next_loc, next_bucket_index(next_loc));
@@ -209,13 +362,160 @@ public:
         bucket_at(table_loc) = {};
     }
 
+    // A bucket where no probe sequence starts earlier and ends later: either empty, or holding a
+    // value in its home bucket. Returns `INTERNAL_TABLE_SIZE` if there is none.
+    [[nodiscard]] constexpr BucketIndexType first_probe_start() const
+    {
+        for (BucketIndexType table_loc = 0; table_loc < INTERNAL_TABLE_SIZE; table_loc++)
+        {
+            if (bucket_at(table_loc).dist_and_fingerprint_ < BucketType::DIST_INC * 2)
+            {
+                return table_loc;
+            }
+        }
+        return INTERNAL_TABLE_SIZE;
+    }
+
+    // Removes the buckets of all the values for which `is_victim(value_index)` is true, and shifts
+    // every other bucket back as far as its home bucket and the buckets before it allow. This ends
+    // up with the same buckets as `erase_bucket()` one victim at a time, in a single pass.
+    template <typename IsVictim>
+    constexpr void erase_buckets_if(IsVictim is_victim)
+    {
+        const BucketIndexType start = first_probe_start();
+        // Counted in steps from `start`, so that wrapping around the end of the array is free
+        std::size_t first_free_step = 0;
+        BucketIndexType table_loc = start;
+        for (std::size_t step = 0; step < INTERNAL_TABLE_SIZE; step++)
+        {
+            BucketType bucket = bucket_at(table_loc);
+            if (bucket.dist_and_fingerprint_ == 0)
+            {
+                first_free_step = step + 1;
+            }
+            else if (is_victim(bucket.value_index_))
+            {
+                bucket_at(table_loc) = {};
+            }
+            else
+            {
+                const std::size_t shift =
+                    std::min<std::size_t>(step - first_free_step, bucket.dist() - 1U);
+                if (shift > 0)
+                {
+                    bucket_at(table_loc) = {};
+                    bucket.dist_and_fingerprint_ = static_cast<
+                        typename BucketType::DistAndFingerprintType>(
+                        bucket.dist_and_fingerprint_ - (shift * BucketType::DIST_INC));
+                    bucket_at((table_loc + INTERNAL_TABLE_SIZE - shift) % INTERNAL_TABLE_SIZE) =
+                        bucket;
+                }
+                first_free_step = step - shift + 1;
+            }
+            table_loc = next_bucket_index(table_loc);
+        }
+    }
+
+    // Finds the bucket by the value index instead of the key, for dense storage where values move
+    // around and their bucket has to follow, and for values that share their key with others.
+    [[nodiscard]] constexpr BucketIndexType bucket_index_of_value(SizeType value_index) const
+    {
+        BucketIndexType table_loc = bucket_index_from_hash(hash_at(value_index));
+        while (bucket_at(table_loc).value_index_ != value_index)
+        {
+            table_loc = next_bucket_index(table_loc);
+        }
+        return table_loc;
+    }
+
+    // Values with equal keys are in consecutive buckets, see `emplace_equal()`
+    [[nodiscard]] constexpr BucketIndexType last_equal_bucket_index(
+        BucketIndexType bucket_index) const
+    {
+        const BucketType& first = bucket_at(bucket_index);
+        const K& key = key_at(first.value_index_);
+        typename BucketType::DistAndFingerprintType dist_and_fingerprint =
+            first.dist_and_fingerprint_;
+        BucketIndexType next_loc = next_bucket_index(bucket_index);
+        dist_and_fingerprint = BucketType::increment_dist(dist_and_fingerprint);
+        while (bucket_at(next_loc).dist_and_fingerprint_ == dist_and_fingerprint &&
+               key_equal(key, key_at(bucket_at(next_loc).value_index_)))
+        {
+            bucket_index = std::exchange(next_loc, next_bucket_index(next_loc));
+            dist_and_fingerprint = BucketType::increment_dist(dist_and_fingerprint);
+        }
+        return bucket_index;
+    }
+
     constexpr SizeType erase_value(SizeType value_index)
     {
-        const SizeType next =
-            IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.delete_at_and_return_next_index(
-                value_index);
+        if constexpr (DENSE_VALUE_STORAGE)
+        {
+            // swap-and-pop: move the last value into the hole and point its bucket to the new spot
+            auto& values = IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_;
+            const auto last_index = static_cast<SizeType>(values.size() - 1);
+            if (value_index != last_index)
+            {
+                bucket_at(bucket_index_of_value(last_index)).value_index_ = value_index;
+                values[value_index] = std::move(values[last_index]);
+                if constexpr (STORE_HASHES)
+                {
+                    IMPLEMENTATION_DETAIL_DO_NOT_USE_stored_hashes_[value_index] =
+                        IMPLEMENTATION_DETAIL_DO_NOT_USE_stored_hashes_[last_index];
+                }
+            }
+            values.pop_back();
+            // Dense storage is iterated from the back, so the moved value has already been visited
+            return next_of(value_index);
+        }
+        else
+        {
+            const SizeType next =
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.delete_at_and_return_next_index(
+                    value_index);
+
+            return next;
+        }
+    }
+
+    [[nodiscard]] constexpr const PairType& entry_at(const SizeType& value_index) const
+    {
+        if constexpr (DENSE_VALUE_STORAGE)
+        {
+            return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_[value_index];
+        }
+        else
+        {
+            return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.at(value_index);
+        }
+    }
+    constexpr PairType& entry_at(const SizeType& value_index)
+    {
+        if constexpr (DENSE_VALUE_STORAGE)
+        {
+            return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_[value_index];
+        }
+        else
+        {
+            return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.at(value_index);
+        }
+    }
 
-        return next;
+    template <typename... Args>
+    constexpr SizeType emplace_value(Args&&... args)
+    {
+        if constexpr (DENSE_VALUE_STORAGE)
+        {
+            const auto value_loc = static_cast<SizeType>(size());
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.emplace_back(
+                std::forward<Args>(args)...);
+            return value_loc;
+        }
+        else
+        {
+            return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.emplace_back_and_return_index(
+                std::forward<Args>(args)...);
+        }
     }
 
     //////////////////////// Common Interface Impl
@@ -225,43 +525,145 @@ public:
         return static_cast<std::size_t>(IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.size());
     }
 
+    // Dense storage is iterated from the last value to the first, so that swap-and-pop erasure
+    // during iteration only ever moves values that have already been visited and the end index
+    // stays stable.
     [[nodiscard]] constexpr OpaqueIteratedType begin_index() const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.front_index();
+        if constexpr (DENSE_VALUE_STORAGE)
+        {
+            return size() == 0 ? invalid_index() : static_cast<SizeType>(size() - 1);
+        }
+        else
+        {
+            return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.front_index();
+        }
     }
 
     static constexpr OpaqueIteratedType invalid_index()
     {
-        return decltype(IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_)::NULL_INDEX;
+        // matches `FixedDoublyLinkedList::NULL_INDEX`
+        return static_cast<SizeType>(CAPACITY);
     }
 
     [[nodiscard]] constexpr OpaqueIteratedType end_index() const { return invalid_index(); }
 
     [[nodiscard]] constexpr OpaqueIteratedType next_of(const OpaqueIteratedType& value_index) const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.next_of(value_index);
+        if constexpr (DENSE_VALUE_STORAGE)
+        {
+            return value_index == 0 ? invalid_index() : static_cast<SizeType>(value_index - 1);
+        }
+        else
+        {
+            return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.next_of(value_index);
+        }
     }
 
     [[nodiscard]] constexpr OpaqueIteratedType prev_of(const OpaqueIteratedType& value_index) const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.prev_of(value_index);
+        if constexpr (DENSE_VALUE_STORAGE)
+        {
+            return value_index == invalid_index() ? SizeType{0}
+                                                  : static_cast<SizeType>(value_index + 1);
+        }
+        else
+        {
+            return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.prev_of(value_index);
+        }
     }
 
     [[nodiscard]] constexpr const K& key_at(const OpaqueIteratedType& value_index) const
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.at(value_index).key();
+        return entry_at(value_index).key();
+    }
+
+    // Only for moving the key out right before erasing it, as changing it breaks the lookup
+    constexpr K& mutable_key_at(const OpaqueIteratedType& value_index)
+    {
+        return entry_at(value_index).key();
     }
 
     [[nodiscard]] constexpr const V& value_at(const OpaqueIteratedType& value_index) const
         requires PairType::HAS_ASSOCIATED_VALUE
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.at(value_index).value();
+        return entry_at(value_index).value();
     }
 
     constexpr V& value_at(const OpaqueIteratedType& value_index)
         requires PairType::HAS_ASSOCIATED_VALUE
     {
-        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.at(value_index).value();
+        return entry_at(value_index).value();
+    }
+
+    // Contiguous view of all the entries, in no particular order
+    [[nodiscard]] constexpr std::span<const PairType> entries() const
+        requires DENSE_VALUE_STORAGE
+    {
+        return {IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.data(), size()};
+    }
+
+    // The hash of the key at `value_index`, without rehashing the key if hashes are stored
+    [[nodiscard]] constexpr std::uint64_t hash_at(const OpaqueIteratedType& value_index) const
+    {
+        if constexpr (STORE_HASHES)
+        {
+            return IMPLEMENTATION_DETAIL_DO_NOT_USE_stored_hashes_[value_index];
+        }
+        else
+        {
+            return hash(key_at(value_index));
+        }
+    }
+
+    [[nodiscard]] constexpr const Hash& hash_function() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    }
+
+    [[nodiscard]] constexpr const KeyEqual& key_eq() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+    }
+
+    // Computed from the buckets on demand, so tracking them costs nothing, and they can be checked
+    // in a `static_assert` for constexpr tables. Linear in the bucket count plus the total
+    // displacement.
+    [[nodiscard]] constexpr RobinhoodHashtableStatistics statistics() const
+    {
+        RobinhoodHashtableStatistics stats{};
+        stats.size = size();
+        stats.bucket_count = INTERNAL_TABLE_SIZE;
+        for (BucketIndexType table_loc = 0; table_loc < INTERNAL_TABLE_SIZE; table_loc++)
+        {
+            const BucketType& bucket = bucket_at(table_loc);
+            if (bucket.dist_and_fingerprint_ == 0)
+            {
+                continue;
+            }
+            const std::size_t displacement = static_cast<std::size_t>(bucket.dist()) - 1;
+            stats.max_displacement = std::max(stats.max_displacement, displacement);
+            stats.total_displacement += displacement;
+            stats.displacement_histogram[std::min(
+                displacement, RobinhoodHashtableStatistics::HISTOGRAM_SIZE - 1)]++;
+
+            // The lookup of this value compares its dist_and_fingerprint against every bucket from
+            // its home bucket up to here. Only buckets with the same home bucket and fingerprint
+            // can match.
+            typename BucketType::DistAndFingerprintType dist_and_fingerprint =
+                bucket.dist_and_fingerprint_;
+            BucketIndexType earlier_loc = table_loc;
+            for (std::size_t i = 0; i < displacement; i++)
+            {
+                dist_and_fingerprint = BucketType::decrement_dist(dist_and_fingerprint);
+                earlier_loc = prev_bucket_index(earlier_loc);
+                if (bucket_at(earlier_loc).dist_and_fingerprint_ == dist_and_fingerprint)
+                {
+                    stats.fingerprint_false_positives++;
+                }
+            }
+        }
+        return stats;
     }
 
     [[nodiscard]] constexpr OpaqueIteratedType iterated_index_from(
@@ -270,13 +672,38 @@ public:
         return bucket_at(index.bucket_index).value_index_;
     }
 
-    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of(const K& key) const
+    // `Key` is `K`, or any type that `Hash` and `KeyEqual` transparently accept
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of(const Key& key) const
     {
-        const std::uint64_t key_hash = hash(key);
-        Bucket::DistAndFingerprintType dist_and_fingerprint =
-            Bucket::dist_and_fingerprint_from_hash(key_hash);
-        SizeType table_loc = bucket_index_from_hash(key_hash);
-        Bucket bucket = bucket_at(table_loc);
+        return opaque_index_of_hash(key, hash(key));
+    }
+
+    // Batch lookups call these for many hashes before resolving any of them, so that the cache
+    // misses of all the lookups overlap. The first brings in the home bucket, the second the value
+    // that bucket points to.
+    constexpr void prefetch_bucket(std::uint64_t key_hash) const
+    {
+        memory::prefetch_for_read(bucket_at(bucket_index_from_hash(key_hash)));
+    }
+
+    constexpr void prefetch_value(std::uint64_t key_hash) const
+    {
+        const BucketType& bucket = bucket_at(bucket_index_from_hash(key_hash));
+        if (bucket.dist_and_fingerprint_ != 0)
+        {
+            memory::prefetch_for_read(entry_at(bucket.value_index_));
+        }
+    }
+
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of_hash(const Key& key,
+                                                                 std::uint64_t key_hash) const
+    {
+        typename BucketType::DistAndFingerprintType dist_and_fingerprint =
+            BucketType::dist_and_fingerprint_from_hash(key_hash);
+        BucketIndexType table_loc = bucket_index_from_hash(key_hash);
+        BucketType bucket = bucket_at(table_loc);
 
         while (true)
         {
@@ -291,9 +718,14 @@ public:
             // the key if it ends up getting inserted.
             if (dist_and_fingerprint > bucket.dist_and_fingerprint_)
             {
-                return {table_loc, dist_and_fingerprint};
+                OpaqueIndexType out{table_loc, dist_and_fingerprint};
+                if constexpr (STORE_HASHES)
+                {
+                    out.key_hash = key_hash;
+                }
+                return out;
             }
-            dist_and_fingerprint = Bucket::increment_dist(dist_and_fingerprint);
+            dist_and_fingerprint = BucketType::increment_dist(dist_and_fingerprint);
             table_loc = next_bucket_index(table_loc);
             bucket = bucket_at(table_loc);
         }
@@ -322,17 +754,86 @@ public:
     template <typename... Args>
     constexpr OpaqueIndexType emplace(const OpaqueIndexType& index, Args&&... args)
     {
-        const SizeType value_loc =
-            IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.emplace_back_and_return_index(
-                std::forward<Args>(args)...);
+        const SizeType value_loc = emplace_value(std::forward<Args>(args)...);
+        if constexpr (STORE_HASHES)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_stored_hashes_[value_loc] = index.key_hash;
+        }
 
         // place the bucket at the correct location
-        place_and_shift_up(
-            Bucket{index.dist_and_fingerprint, static_cast<std::uint32_t>(value_loc)},
-            index.bucket_index);
+        place_and_shift_up(BucketType{index.dist_and_fingerprint, value_loc}, index.bucket_index);
+        return {index.bucket_index, 0};
+    }
+
+    // Same as `emplace()`, for callers that already know the hash that `index` was looked up with
+    template <typename... Args>
+    constexpr OpaqueIndexType emplace_with_hash(const OpaqueIndexType& index,
+                                                std::uint64_t key_hash,
+                                                Args&&... args)
+    {
+        const SizeType value_loc = emplace_value(std::forward<Args>(args)...);
+        if constexpr (STORE_HASHES)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_stored_hashes_[value_loc] = key_hash;
+        }
+
+        place_and_shift_up(BucketType{index.dist_and_fingerprint, value_loc}, index.bucket_index);
         return {index.bucket_index, 0};
     }
 
+    /**
+     * Inserts another value with the same key as the existing one at `index`, for multimaps and
+     * multisets. It goes right after the last value with that key, both in the buckets and in the
+     * iteration order, so that all the values with one key form a single run. Lookups still find
+     * the first of them, and the same-key buckets are never separated: shifting moves them all
+     * together. `index` must exist.
+     */
+    template <typename... Args>
+    constexpr OpaqueIndexType emplace_equal(const OpaqueIndexType& index, Args&&... args)
+        requires(!DENSE_VALUE_STORAGE)
+    {
+        const BucketIndexType last_loc = last_equal_bucket_index(index.bucket_index);
+        const BucketType& last = bucket_at(last_loc);
+        const SizeType value_loc =
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.emplace_after_index_and_return_index(
+                last.value_index_, std::forward<Args>(args)...);
+        if constexpr (STORE_HASHES)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_stored_hashes_[value_loc] =
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_stored_hashes_[last.value_index_];
+        }
+
+        const BucketIndexType table_loc = next_bucket_index(last_loc);
+        place_and_shift_up(
+            BucketType{BucketType::increment_dist(last.dist_and_fingerprint_), value_loc},
+            table_loc);
+        return {table_loc, 0};
+    }
+
+    // Past the last value with the same key as the one at `index`, in iteration order
+    [[nodiscard]] constexpr OpaqueIteratedType end_of_equal_range(
+        const OpaqueIndexType& index) const
+        requires(!DENSE_VALUE_STORAGE)
+    {
+        return next_of(bucket_at(last_equal_bucket_index(index.bucket_index)).value_index_);
+    }
+
+    [[nodiscard]] constexpr std::size_t equal_count(const OpaqueIndexType& index) const
+    {
+        const BucketIndexType last_loc = last_equal_bucket_index(index.bucket_index);
+        return static_cast<std::size_t>(bucket_at(last_loc).dist() -
+                                        bucket_at(index.bucket_index).dist()) +
+               1;
+    }
+
+    // The opposite of `iterated_index_from()`. Unlike a lookup of the key, this finds the bucket of
+    // exactly this value when others share its key.
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_from_iterated(
+        const OpaqueIteratedType& value_index) const
+    {
+        return {bucket_index_of_value(value_index), 0};
+    }
+
     constexpr OpaqueIteratedType erase(const OpaqueIndexType& index)
     {
         const SizeType value_index = bucket_at(index.bucket_index).value_index_;
@@ -349,13 +850,96 @@ public:
         SizeType cur_index = start_value_index;
         while (cur_index != end_value_index)
         {
-            cur_index = erase(opaque_index_of(key_at(cur_index)));
+            cur_index = erase(opaque_index_from_iterated(cur_index));
         }
 
         return end_value_index;
     }
 
-    constexpr void clear() { erase_range(begin_index(), end_index()); }
+    // Erases every value for which `predicate(value_index)` is true, calling it in iteration order.
+    // Instead of looking up and shifting the bucket of each value separately, this marks the values
+    // in one pass over them and removes their buckets in one pass over the buckets. Returns the
+    // number of erased values.
+    template <typename Predicate>
+    constexpr std::size_t erase_if_at(Predicate predicate)
+    {
+        constexpr std::size_t BITS = 64;
+        std::array<std::uint64_t, (CAPACITY + BITS - 1) / BITS> victims{};
+        const auto is_victim = [&victims](SizeType value_index)
+        { return ((victims[value_index / BITS] >> (value_index % BITS)) & 1U) != 0; };
+
+        std::size_t victim_count = 0;
+        SizeType some_victim{};
+        for (OpaqueIteratedType value_index = begin_index(); value_index != end_index();
+             value_index = next_of(value_index))
+        {
+            if (predicate(std::as_const(value_index)))
+            {
+                victims[value_index / BITS] |= std::uint64_t{1} << (value_index % BITS);
+                victim_count++;
+                some_victim = value_index;
+            }
+        }
+        if (victim_count == 0)
+        {
+            return 0;
+        }
+
+        // The sweep needs a bucket to start from. A full table might have none, but erasing any
+        // one bucket makes one.
+        if (first_probe_start() == INTERNAL_TABLE_SIZE)
+        {
+            erase_bucket(opaque_index_from_iterated(some_victim));
+        }
+        erase_buckets_if(is_victim);
+
+        if constexpr (DENSE_VALUE_STORAGE)
+        {
+            // The buckets of the survivors are in place, so `erase_value()` can move the last
+            // value into each hole as usual, as long as that value is not a victim itself.
+            auto& values = IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_;
+            for (SizeType value_index = 0; value_index < values.size(); value_index++)
+            {
+                if (!is_victim(value_index))
+                {
+                    continue;
+                }
+                while (values.size() - 1 > value_index &&
+                       is_victim(static_cast<SizeType>(values.size() - 1)))
+                {
+                    values.pop_back();
+                }
+                erase_value(value_index);
+            }
+        }
+        else
+        {
+            for (std::size_t word = 0; word < victims.size(); word++)
+            {
+                for (std::uint64_t bits = victims[word]; bits != 0; bits &= bits - 1)
+                {
+                    const auto bit = static_cast<std::size_t>(std::countr_zero(bits));
+                    erase_value(static_cast<SizeType>((word * BITS) + bit));
+                }
+            }
+        }
+        return victim_count;
+    }
+
+    constexpr void clear()
+    {
+        // Every bucket goes away, so there is no need to look up and shift them one at a time
+        if constexpr (!DENSE_VALUE_STORAGE && TriviallyDestructible<PairType>)
+        {
+            // Linear in the capacity like the bucket array reset, but without chasing the list
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.clear_by_resetting_indices();
+        }
+        else
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.clear();
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_bucket_array_.fill({});
+    }
 
 public:
     constexpr FixedRobinhoodHashtable() = default;
@@ -378,6 +962,8 @@ public:
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_)
       , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(
             other.IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_stored_hashes_(
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_stored_hashes_)
     {
     }
     constexpr FixedRobinhoodHashtable(const FixedRobinhoodHashtable& other)
@@ -396,6 +982,8 @@ public:
         IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_ = other.IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
         IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_ =
             other.IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_stored_hashes_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_stored_hashes_;
         return *this;
     }
     constexpr FixedRobinhoodHashtable& operator=(const FixedRobinhoodHashtable& other)
@@ -405,12 +993,48 @@ public:
     constexpr FixedRobinhoodHashtable& operator=(FixedRobinhoodHashtable&& other) = default;
 };
 
-constexpr std::size_t default_bucket_count(std::size_t value_count)
+// By default, oversize the bucket array by 30%, i.e. a maximum load factor of ~77%
+inline constexpr std::size_t DEFAULT_OVERSIZE_PERCENTAGE = 130;
+
+// `oversize_percentage` is the inverse of the maximum load factor: 200 means that the table will be
+// at most half full. Larger tables mean shorter probe sequences, at the cost of memory.
+constexpr std::size_t default_bucket_count(
+    std::size_t value_count, std::size_t oversize_percentage = DEFAULT_OVERSIZE_PERCENTAGE)
+{
+    return (value_count * oversize_percentage) / 100;
+}
+
+// The bucket count that `BucketIndexing::POWER_OF_TWO_MASK` will actually use. Useful to see how
+// much memory the rounding costs, or to pick an oversize percentage that does not get rounded up.
+constexpr std::size_t power_of_two_bucket_count(
+    std::size_t value_count, std::size_t oversize_percentage = DEFAULT_OVERSIZE_PERCENTAGE)
 {
-    // oversize the bucket array by 30%
-    // TODO: think about the oversize percentage
-    // TODO: round to a nearby power of 2 to improve modulus performance
-    return (value_count * 130) / 100;
+    return internal_table_size(default_bucket_count(value_count, oversize_percentage),
+                               BucketIndexing::POWER_OF_TWO_MASK);
 }
 
 }  // namespace fixed_containers::fixed_robinhood_hashtable_detail
+
+namespace fixed_containers
+{
+
+/**
+ * Table policy for `FixedUnorderedMap`/`FixedUnorderedSet` that uses a `FixedRobinhoodHashtable`.
+ * This is the default, `OPTIONS` selects how hashes are mapped to buckets and how values are
+ * stored.
+ */
+template <fixed_robinhood_hashtable_detail::RobinhoodHashtableOptions OPTIONS =
+              fixed_robinhood_hashtable_detail::RobinhoodHashtableOptions{}>
+struct RobinhoodHashtablePolicy
+{
+    template <typename K,
+              typename V,
+              std::size_t MAXIMUM_VALUE_COUNT,
+              std::size_t BUCKET_COUNT,
+              class Hash,
+              class KeyEqual>
+    using Table = fixed_robinhood_hashtable_detail::
+        FixedRobinhoodHashtable<K, V, MAXIMUM_VALUE_COUNT, BUCKET_COUNT, Hash, KeyEqual, OPTIONS>;
+};
+
+}  // namespace fixed_containers
@@ -5,7 +5,9 @@
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/erase_if.hpp"
 #include "fixed_containers/fixed_red_black_tree.hpp"
+#include "fixed_containers/node_handle.hpp"
 #include "fixed_containers/preconditions.hpp"
+#include "fixed_containers/sorted_unique.hpp"
 #include "fixed_containers/set_checking.hpp"
 #include "fixed_containers/source_location.hpp"
 
@@ -14,6 +16,8 @@
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 namespace fixed_containers
 {
@@ -25,6 +29,12 @@ namespace fixed_containers
  *  - no pointers stored (data layout is purely self-referential and can be serialized directly)
  *  - no dynamic allocations
  *  - no recursion
+ *
+ * Iterator invalidation: with the default `FixedIndexBasedPoolStorage`, iterators and references
+ * stay valid until their entry is erased, as with `std::set`. With
+ * `FixedIndexBasedContiguousStorage`, erasing any entry invalidates all of them. `FixedBTreeSet`
+ * keeps the keys of a node packed together for faster lookups, with the same guarantee as the
+ * default storage.
  */
 template <class K,
           std::size_t MAXIMUM_SIZE,
@@ -36,7 +46,8 @@ template <class K,
                     ,
                     std::size_t>
           typename StorageTemplate = FixedIndexBasedPoolStorage,
-          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>>
+          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>,
+          class Augmentation = NoTreeAugmentation>
 class FixedSet
 {
 public:
@@ -52,7 +63,10 @@ private:
     using NodeIndexAndParentIndex = fixed_red_black_tree_detail::NodeIndexAndParentIndex;
     static constexpr NodeIndex NULL_INDEX = fixed_red_black_tree_detail::NULL_INDEX;
     using Tree = fixed_red_black_tree_detail::
-        FixedRedBlackTreeSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate>;
+        FixedRedBlackTreeSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, Augmentation>;
+    static constexpr bool HAS_SUBTREE_SIZES =
+        std::is_same_v<Augmentation, OrderStatisticTreeAugmentation>;
+    static constexpr bool HAS_AGGREGATE = TreeAggregatePolicy<Augmentation, K, EmptyValue>;
 
     class ReferenceProvider
     {
@@ -127,6 +141,8 @@ public:
     using reverse_iterator = const_reverse_iterator;
     using size_type = typename Tree::size_type;
     using difference_type = typename Tree::difference_type;
+    using node_type = SetNodeHandle<K>;
+    using insert_return_type = NodeInsertReturnType<iterator, node_type>;
 
 public:
     [[nodiscard]] static constexpr std::size_t static_max_size() noexcept { return MAXIMUM_SIZE; }
@@ -165,6 +181,41 @@ public:
         this->insert(list, loc);
     }
 
+    /**
+     * Same as the iterator constructor, for input that is already sorted by `Compare` and has no
+     * duplicate keys. Builds a perfectly balanced tree in O(n) without comparing any key.
+     */
+    template <InputIterator InputIt>
+    constexpr FixedSet(
+        sorted_unique_t /*tag*/,
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedSet{comparator}
+    {
+        tree().build_from_sorted_unique(first, last, [this, &loc]() { check_not_full(loc); });
+    }
+
+    constexpr FixedSet(sorted_unique_t tag,
+                       std::initializer_list<value_type> list,
+                       const Compare& comparator = {},
+                       const std_transition::source_location& loc =
+                           std_transition::source_location::current()) noexcept
+      : FixedSet{tag, list.begin(), list.end(), comparator, loc}
+    {
+    }
+
+    template <InputIterator InputIt>
+    [[nodiscard]] static constexpr FixedSet from_sorted_unique(
+        InputIt first,
+        InputIt last,
+        const Compare& comparator = {},
+        const std_transition::source_location& loc = std_transition::source_location::current())
+    {
+        return FixedSet{sorted_unique, first, last, comparator, loc};
+    }
+
 public:
     [[nodiscard]] constexpr const_iterator cbegin() const noexcept
     {
@@ -224,19 +275,84 @@ public:
         tree().insert_new_at(np_idxs, std::move(value));
         return {create_const_iterator(np_idxs.i), true};
     }
-    constexpr const_iterator insert(const_iterator /*hint*/,
+    // The hinted overloads only compare `key` with `hint` and its neighbour if `key` goes right
+    // before `hint`, or right after it, e.g. `end()` when keys come in increasing order. Any other
+    // hint costs a few more comparisons than no hint.
+    constexpr const_iterator insert(const_iterator hint,
                                     const K& key,
                                     const std_transition::source_location& loc =
                                         std_transition::source_location::current()) noexcept
     {
-        return insert(key, loc).first;
+        NodeIndexAndParentIndex np_idxs = index_of_node_with_parent_near(hint, key);
+        if (tree().contains_at(np_idxs.i))
+        {
+            return create_const_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, key);
+        return create_const_iterator(np_idxs.i);
     }
-    constexpr const_iterator insert(const_iterator /*hint*/,
+    constexpr const_iterator insert(const_iterator hint,
                                     K&& key,
                                     const std_transition::source_location& loc =
                                         std_transition::source_location::current()) noexcept
     {
-        return insert(std::move(key), loc).first;
+        NodeIndexAndParentIndex np_idxs = index_of_node_with_parent_near(hint, key);
+        if (tree().contains_at(np_idxs.i))
+        {
+            return create_const_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, std::move(key));
+        return create_const_iterator(np_idxs.i);
+    }
+
+    /**
+     * Inserts `key`, which must be greater than every key in the set, with a single comparison to
+     * check that. For filling a set in increasing order.
+     */
+    constexpr const_iterator append_max(
+        const K& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        NodeIndexAndParentIndex np_idxs = tree().index_of_node_with_parent_past_max(key);
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, key);
+        return create_const_iterator(np_idxs.i);
+    }
+    constexpr const_iterator append_max(
+        K&& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        NodeIndexAndParentIndex np_idxs = tree().index_of_node_with_parent_past_max(key);
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, std::move(key));
+        return create_const_iterator(np_idxs.i);
+    }
+    // Same as `append_max()`, for a `key` that is less than every key in the set
+    constexpr const_iterator prepend_min(
+        const K& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        NodeIndexAndParentIndex np_idxs = tree().index_of_node_with_parent_before_min(key);
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, key);
+        return create_const_iterator(np_idxs.i);
+    }
+    constexpr const_iterator prepend_min(
+        K&& key,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        NodeIndexAndParentIndex np_idxs = tree().index_of_node_with_parent_before_min(key);
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, std::move(key));
+        return create_const_iterator(np_idxs.i);
     }
 
     template <InputIterator InputIt>
@@ -291,6 +407,351 @@ public:
 
     constexpr size_type erase(const K& key) noexcept { return tree().delete_node(key); }
 
+    template <class K0>
+    constexpr size_type erase(K0&& key) noexcept
+        requires(IsTransparent<Compare> and !std::is_convertible_v<K0 &&, iterator> and
+                 !std::is_convertible_v<K0 &&, const_iterator>)
+    {
+        return tree().delete_node(key);
+    }
+
+    /**
+     * Erases every key less than `key` and returns how many, in O(log n + k) for k erased keys.
+     * See `FixedMap::erase_before()`.
+     */
+    constexpr size_type erase_before(const K& key) noexcept
+    {
+        const size_type old_size = size();
+        tree().delete_nodes_less_than(key);
+        return old_size - size();
+    }
+    template <class K0>
+    constexpr size_type erase_before(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        const size_type old_size = size();
+        tree().delete_nodes_less_than(key);
+        return old_size - size();
+    }
+    // Same as `erase_before()`, for the keys greater than `key`
+    constexpr size_type erase_after(const K& key) noexcept
+    {
+        const size_type old_size = size();
+        tree().delete_nodes_greater_than(key);
+        return old_size - size();
+    }
+    template <class K0>
+    constexpr size_type erase_after(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        const size_type old_size = size();
+        tree().delete_nodes_greater_than(key);
+        return old_size - size();
+    }
+
+    /**
+     * Moves the key at `pos` out of the set and into the returned handle, which can be inserted
+     * into a `FixedSet` of any capacity.
+     */
+    constexpr node_type extract(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const NodeIndex index = get_node_index_from_iterator(pos);
+        assert_or_abort(tree().contains_at(index));
+        return extract_at(index);
+    }
+
+    // Returns an empty handle if `key` is not present
+    constexpr node_type extract(const K& key) noexcept
+    {
+        const NodeIndex index = tree().index_of_node_or_null(key);
+        if (!tree().contains_at(index))
+        {
+            return node_type{};
+        }
+        return extract_at(index);
+    }
+
+    constexpr insert_return_type insert(
+        node_type&& node,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        if (node.empty())
+        {
+            return {cend(), false, node_type{}};
+        }
+
+        NodeIndexAndParentIndex np_idxs =
+            tree().index_of_node_with_parent(std::as_const(node).value());
+        if (tree().contains_at(np_idxs.i))
+        {
+            return {create_const_iterator(np_idxs.i), false, std::move(node)};
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, std::move(node.value()));
+        node = node_type{};
+        return {create_const_iterator(np_idxs.i), true, node_type{}};
+    }
+
+    constexpr const_iterator insert(const_iterator hint,
+                                    node_type&& node,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        if (node.empty())
+        {
+            return cend();
+        }
+
+        NodeIndexAndParentIndex np_idxs =
+            index_of_node_with_parent_near(hint, std::as_const(node).value());
+        if (tree().contains_at(np_idxs.i))
+        {
+            return create_const_iterator(np_idxs.i);
+        }
+
+        check_not_full(loc);
+        tree().insert_new_at(np_idxs, std::move(node.value()));
+        node = node_type{};
+        return create_const_iterator(np_idxs.i);
+    }
+
+    /**
+     * Moves every key of `source` that is not present into this set. Keys that are present stay
+     * in `source`. See `FixedMap::merge()`.
+     */
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Compare2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::SetChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void merge(
+        FixedSet<K,
+                 MAXIMUM_SIZE_2,
+                 Compare2,
+                 COMPACTNESS_2,
+                 StorageTemplate2,
+                 CheckingType2,
+                 Augmentation2>& source,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        auto& source_tree = source.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_;
+        NodeIndex source_index = source_tree.index_of_min_at();
+        while (source_index != NULL_INDEX)
+        {
+            auto source_node = source_tree.node_at(source_index);
+            NodeIndexAndParentIndex np_idxs =
+                tree().index_of_node_with_parent(std::as_const(source_node).key());
+            if (tree().contains_at(np_idxs.i))
+            {
+                source_index = source_tree.index_of_successor_at(source_index);
+                continue;
+            }
+
+            check_not_full(loc);
+            tree().insert_new_at(np_idxs, std::move(source_node.key()));
+            source_index = source_tree.delete_at_and_return_successor(source_index);
+        }
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              class Compare2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::SetChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void merge(
+        FixedSet<K,
+                 MAXIMUM_SIZE_2,
+                 Compare2,
+                 COMPACTNESS_2,
+                 StorageTemplate2,
+                 CheckingType2,
+                 Augmentation2>&& source,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        merge(source, loc);
+    }
+
+    /**
+     * Moves the keys that are not less than `key` into the returned set, which then holds the
+     * right part. See `FixedMap::split()`. O(log n + k) for k moved keys, without an
+     * `Augmentation`.
+     */
+    [[nodiscard]] constexpr FixedSet split(const K& key) noexcept
+    {
+        FixedSet right{tree().IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_};
+        tree().move_nodes_not_less_than_into(key, right.tree());
+        return right;
+    }
+    template <class K0>
+    [[nodiscard]] constexpr FixedSet split(const K0& key) noexcept
+        requires IsTransparent<Compare>
+    {
+        FixedSet right{tree().IMPLEMENTATION_DETAIL_DO_NOT_USE_comparator_};
+        tree().move_nodes_not_less_than_into(key, right.tree());
+        return right;
+    }
+
+    /**
+     * Moves every key of `other` into this set. The keys of `other` must all be greater than the
+     * keys of this set, or all less. See `FixedMap::join()`. O(k) amortized for k moved keys, or
+     * O(k log n) with an `Augmentation`.
+     */
+    template <std::size_t MAXIMUM_SIZE_2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::SetChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void join(
+        FixedSet<K,
+                 MAXIMUM_SIZE_2,
+                 Compare,
+                 COMPACTNESS_2,
+                 StorageTemplate2,
+                 CheckingType2,
+                 Augmentation2>& other,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        tree().join_with(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_,
+                         [this, &loc]() { check_not_full(loc); });
+    }
+
+    template <std::size_t MAXIMUM_SIZE_2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::SetChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void join(
+        FixedSet<K,
+                 MAXIMUM_SIZE_2,
+                 Compare,
+                 COMPACTNESS_2,
+                 StorageTemplate2,
+                 CheckingType2,
+                 Augmentation2>&& other,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        join(other, loc);
+    }
+
+    /**
+     * Inserts the keys of `other` that are not in this set. `other` must be ordered by the same
+     * comparator. Unlike `std::set_union()` over the iterators, the runs of keys that are only in
+     * this set are skipped instead of walked, so this takes O(m log(n/m + 1)) comparisons for
+     * sizes m <= n.
+     */
+    template <std::size_t MAXIMUM_SIZE_2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::SetChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void set_union(
+        const FixedSet<K,
+                       MAXIMUM_SIZE_2,
+                       Compare,
+                       COMPACTNESS_2,
+                       StorageTemplate2,
+                       CheckingType2,
+                       Augmentation2>& other,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        tree().insert_nodes_not_present_from(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_,
+                                             [this, &loc]() { check_not_full(loc); });
+    }
+
+    // Erases the keys that are not in `other`. Same requirements and complexity as `set_union()`.
+    template <std::size_t MAXIMUM_SIZE_2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::SetChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void set_intersection(const FixedSet<K,
+                                                   MAXIMUM_SIZE_2,
+                                                   Compare,
+                                                   COMPACTNESS_2,
+                                                   StorageTemplate2,
+                                                   CheckingType2,
+                                                   Augmentation2>& other) noexcept
+    {
+        tree().delete_nodes_not_in(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_);
+    }
+
+    // Erases the keys that are in `other`. Same requirements and complexity as `set_union()`.
+    template <std::size_t MAXIMUM_SIZE_2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::SetChecking<K> CheckingType2,
+              class Augmentation2>
+    constexpr void set_difference(const FixedSet<K,
+                                                 MAXIMUM_SIZE_2,
+                                                 Compare,
+                                                 COMPACTNESS_2,
+                                                 StorageTemplate2,
+                                                 CheckingType2,
+                                                 Augmentation2>& other) noexcept
+    {
+        tree().delete_nodes_in(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_);
+    }
+
+    // Whether every key of `other` is in this set. Same requirements and complexity as
+    // `set_union()`.
+    template <std::size_t MAXIMUM_SIZE_2,
+              fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
+              template <class /*Would be IsFixedIndexBasedStorage but gcc doesn't like the
+                                 constraints here. clang accepts it */
+                        ,
+                        std::size_t>
+              typename StorageTemplate2,
+              customize::SetChecking<K> CheckingType2,
+              class Augmentation2>
+    [[nodiscard]] constexpr bool includes(const FixedSet<K,
+                                                         MAXIMUM_SIZE_2,
+                                                         Compare,
+                                                         COMPACTNESS_2,
+                                                         StorageTemplate2,
+                                                         CheckingType2,
+                                                         Augmentation2>& other) const noexcept
+    {
+        return tree().contains_all_nodes_of(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_tree_);
+    }
+
     [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
     {
         const NodeIndex index = tree().index_of_node_or_null(key);
@@ -378,6 +839,105 @@ public:
         return equal_range_impl(np_idxs);
     }
 
+    /**
+     * Iterator to the key that has `rank` keys before it, or `end()` if there are not that many
+     * keys. See `FixedMap::nth()`. Requires `OrderStatisticTreeAugmentation`.
+     */
+    [[nodiscard]] constexpr const_iterator nth(const size_type rank) const noexcept
+        requires HAS_SUBTREE_SIZES
+    {
+        return create_const_iterator(tree().index_of_nth(rank));
+    }
+
+    /**
+     * Number of keys that are less than `key`. See `FixedMap::rank()`.
+     * Requires `OrderStatisticTreeAugmentation`.
+     */
+    [[nodiscard]] constexpr size_type rank(const K& key) const noexcept
+        requires HAS_SUBTREE_SIZES
+    {
+        return tree().rank_of(key);
+    }
+    template <class K0>
+    [[nodiscard]] constexpr size_type rank(const K0& key) const noexcept
+        requires HAS_SUBTREE_SIZES && IsTransparent<Compare>
+    {
+        return tree().rank_of(key);
+    }
+
+    /**
+     * Number of keys in [from, to). See `FixedMap::count_in_range()`.
+     * Requires `OrderStatisticTreeAugmentation`.
+     */
+    [[nodiscard]] constexpr size_type count_in_range(const K& from, const K& to) const noexcept
+        requires HAS_SUBTREE_SIZES
+    {
+        return count_in_range_impl(from, to);
+    }
+    template <class K0, class K1>
+    [[nodiscard]] constexpr size_type count_in_range(const K0& from, const K1& to) const noexcept
+        requires HAS_SUBTREE_SIZES && IsTransparent<Compare>
+    {
+        return count_in_range_impl(from, to);
+    }
+
+    /**
+     * `Augmentation::combine()` of the data of every key, in order. See `FixedMap::aggregate()`.
+     * Requires an `Augmentation` that is a `TreeAggregatePolicy`.
+     */
+    [[nodiscard]] constexpr auto aggregate() const noexcept
+        requires HAS_AGGREGATE
+    {
+        return tree().aggregate_of_all();
+    }
+
+    /**
+     * Same as `aggregate()`, for the keys in [from, to). O(log n).
+     */
+    [[nodiscard]] constexpr auto aggregate_in_range(const K& from, const K& to) const noexcept
+        requires HAS_AGGREGATE
+    {
+        return tree().aggregate_of_range(from, to);
+    }
+    template <class K0, class K1>
+    [[nodiscard]] constexpr auto aggregate_in_range(const K0& from, const K1& to) const noexcept
+        requires HAS_AGGREGATE && IsTransparent<Compare>
+    {
+        return tree().aggregate_of_range(from, to);
+    }
+
+    /**
+     * Same as `aggregate()`, for the keys that are less than `key`. O(log n).
+     */
+    [[nodiscard]] constexpr auto aggregate_before(const K& key) const noexcept
+        requires HAS_AGGREGATE
+    {
+        return tree().aggregate_of_keys_less_than(key);
+    }
+    template <class K0>
+    [[nodiscard]] constexpr auto aggregate_before(const K0& key) const noexcept
+        requires HAS_AGGREGATE && IsTransparent<Compare>
+    {
+        return tree().aggregate_of_keys_less_than(key);
+    }
+
+    /**
+     * First key at or after `first` whose own data satisfies `predicate`, or `end()`.
+     * See `FixedMap::find_first_by_aggregate()`. O(log n).
+     */
+    template <class Predicate>
+    [[nodiscard]] constexpr const_iterator find_first_by_aggregate(
+        const_iterator first, Predicate predicate) const noexcept
+        requires HAS_AGGREGATE
+    {
+        if (first == cend())
+        {
+            return cend();
+        }
+        return create_const_iterator(tree().index_of_first_matching_at_or_after(
+            get_node_index_from_iterator(first), predicate));
+    }
+
     template <std::size_t MAXIMUM_SIZE_2,
               class Compare2,
               fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness COMPACTNESS_2,
@@ -386,10 +946,16 @@ public:
                         ,
                         std::size_t>
               typename StorageTemplate2,
-              customize::SetChecking<K> CheckingType2>
+              customize::SetChecking<K> CheckingType2,
+              class Augmentation2>
     [[nodiscard]] constexpr bool operator==(
-        const FixedSet<K, MAXIMUM_SIZE_2, Compare2, COMPACTNESS_2, StorageTemplate2, CheckingType2>&
-            other) const
+        const FixedSet<K,
+                       MAXIMUM_SIZE_2,
+                       Compare2,
+                       COMPACTNESS_2,
+                       StorageTemplate2,
+                       CheckingType2,
+                       Augmentation2>& other) const
     {
         if constexpr (MAXIMUM_SIZE == MAXIMUM_SIZE_2)
         {
@@ -429,6 +995,13 @@ private:
         }
     }
 
+    constexpr node_type extract_at(const NodeIndex& index) noexcept
+    {
+        node_type extracted{node_handle_detail::EXTRACTED, std::move(tree().node_at(index).key())};
+        tree().delete_at_and_return_successor(index);
+        return extracted;
+    }
+
     [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range_impl(
         const NodeIndexAndParentIndex& np_idxs) const noexcept
     {
@@ -438,10 +1011,27 @@ private:
         return {create_const_iterator(l_idx), create_const_iterator(r_idx)};
     }
 
-    [[nodiscard]] constexpr NodeIndex get_node_index_from_iterator(const_iterator pos)
+    template <class K0, class K1>
+    [[nodiscard]] constexpr size_type count_in_range_impl(const K0& from, const K1& to) const
+    {
+        const size_type rank_of_from = tree().rank_of(from);
+        const size_type rank_of_to = tree().rank_of(to);
+        return rank_of_to > rank_of_from ? rank_of_to - rank_of_from : 0;
+    }
+
+    [[nodiscard]] constexpr NodeIndex get_node_index_from_iterator(const_iterator pos) const
     {
         return pos.template private_reference_provider<ReferenceProvider>().current_index();
     }
+
+    template <class K0>
+    [[nodiscard]] constexpr NodeIndexAndParentIndex index_of_node_with_parent_near(
+        const_iterator hint, const K0& key) const
+    {
+        const NodeIndex hint_index =
+            hint == cend() ? NULL_INDEX : get_node_index_from_iterator(hint);
+        return tree().index_of_node_with_parent_near(hint_index, key);
+    }
 };
 
 template <class K,
@@ -453,9 +1043,15 @@ here. clang accepts it */
                     ,
                     std::size_t>
           typename StorageTemplate,
-          customize::SetChecking<K> CheckingType>
-[[nodiscard]] constexpr bool is_full(
-    const FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>& container)
+          customize::SetChecking<K> CheckingType,
+          class Augmentation>
+[[nodiscard]] constexpr bool is_full(const FixedSet<K,
+                                                   MAXIMUM_SIZE,
+                                                   Compare,
+                                                   COMPACTNESS,
+                                                   StorageTemplate,
+                                                   CheckingType,
+                                                   Augmentation>& container)
 {
     return container.size() >= container.max_size();
 }
@@ -470,12 +1066,23 @@ here. clang accepts it */
                     std::size_t>
           typename StorageTemplate,
           customize::SetChecking<K> CheckingType,
+          class Augmentation,
           class Predicate>
-constexpr typename FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>::
-    size_type
-    erase_if(
-        FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>& container,
-        Predicate predicate)
+constexpr typename FixedSet<K,
+                            MAXIMUM_SIZE,
+                            Compare,
+                            COMPACTNESS,
+                            StorageTemplate,
+                            CheckingType,
+                            Augmentation>::size_type
+erase_if(FixedSet<K,
+                  MAXIMUM_SIZE,
+                  Compare,
+                  COMPACTNESS,
+                  StorageTemplate,
+                  CheckingType,
+                  Augmentation>& container,
+         Predicate predicate)
 {
     return erase_if_detail::erase_if_impl(container, predicate);
 }
@@ -572,10 +1179,15 @@ here. clang accepts it */
               ,
               std::size_t>
     typename StorageTemplate,
-    fixed_containers::customize::SetChecking<K> CheckingType>
-struct tuple_size<
-    fixed_containers::
-        FixedSet<K, MAXIMUM_SIZE, Compare, COMPACTNESS, StorageTemplate, CheckingType>>
+    fixed_containers::customize::SetChecking<K> CheckingType,
+    class Augmentation>
+struct tuple_size<fixed_containers::FixedSet<K,
+                                             MAXIMUM_SIZE,
+                                             Compare,
+                                             COMPACTNESS,
+                                             StorageTemplate,
+                                             CheckingType,
+                                             Augmentation>>
   : std::integral_constant<std::size_t, 0>
 {
     // Implicit Structured Binding due to the fields being public is disabled
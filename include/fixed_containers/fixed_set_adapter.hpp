@@ -1,13 +1,22 @@
 #pragma once
 
 #include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
 #include "fixed_containers/erase_if.hpp"
 #include "fixed_containers/forward_iterator.hpp"
+#include "fixed_containers/node_handle.hpp"
 #include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/source_location.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
 #include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 namespace fixed_containers
 {
@@ -22,11 +31,20 @@ public:
     using const_reference = const K&;
     using pointer = std::add_pointer_t<reference>;
     using const_pointer = std::add_pointer_t<const_reference>;
+    using hasher = typename TableImpl::HashType;
+    using key_equal = typename TableImpl::KeyEqualType;
 
 private:
     using TableIndex = typename TableImpl::OpaqueIndexType;
     using TableIteratedIndex = typename TableImpl::OpaqueIteratedType;
 
+    // Heterogeneous lookup needs both the hash and the key equality to accept other key types
+    static constexpr bool TRANSPARENT_LOOKUP = IsTransparent<typename TableImpl::HashType> &&
+                                               IsTransparent<typename TableImpl::KeyEqualType>;
+
+    // How many lookups of a batch are in flight at a time
+    static constexpr std::size_t BATCH_LOOKUP_SIZE = 16;
+
     class ReferenceProvider
     {
         friend class FixedSetAdapter;
@@ -68,6 +86,8 @@ public:
 
     using size_type = std::size_t;
     using difference_type = ptrdiff_t;
+    using node_type = SetNodeHandle<K, hasher>;
+    using insert_return_type = NodeInsertReturnType<iterator, node_type>;
 
 public:
     static constexpr size_type static_max_size() noexcept { return TableImpl::CAPACITY; }
@@ -109,6 +129,26 @@ public:
     [[nodiscard]] constexpr std::size_t size() const noexcept { return table().size(); }
     [[nodiscard]] constexpr bool empty() const noexcept { return table().size() == 0; }
 
+    [[nodiscard]] constexpr const hasher& hash_function() const noexcept
+    {
+        return table().hash_function();
+    }
+    [[nodiscard]] constexpr const key_equal& key_eq() const noexcept { return table().key_eq(); }
+
+    // Contiguous view of the entries, only available for tables that store them densely
+    [[nodiscard]] constexpr auto entries() const noexcept
+        requires requires(const TableImpl& table_impl) { table_impl.entries(); }
+    {
+        return table().entries();
+    }
+
+    // How far the entries are from their home buckets, only available for tables that can tell
+    [[nodiscard]] constexpr auto statistics() const noexcept
+        requires requires(const TableImpl& table_impl) { table_impl.statistics(); }
+    {
+        return table().statistics();
+    }
+
     constexpr void clear() noexcept { table().clear(); }
 
     constexpr std::pair<iterator, bool> insert(
@@ -143,6 +183,45 @@ public:
         return {create_const_iterator(idx), true};
     }
 
+    /**
+     * Same as `insert()`, with `key_hash` as the hash of `value`. Lets a key that is looked up or
+     * inserted in several sets with the same hasher be hashed only once. `key_hash` must be
+     * `hash_function()(value)`, for example from `hash_of()` of another set.
+     */
+    constexpr std::pair<iterator, bool> insert_with_hash(
+        std::uint64_t key_hash,
+        const K& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        TableIndex idx = table().opaque_index_of_hash(value, key_hash);
+        if (table().exists(idx))
+        {
+            return {create_const_iterator(idx), false};
+        }
+
+        check_not_full(loc);
+        idx = table().emplace_with_hash(idx, key_hash, value);
+        return {create_const_iterator(idx), true};
+    }
+
+    constexpr std::pair<iterator, bool> insert_with_hash(
+        std::uint64_t key_hash,
+        K&& value,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        TableIndex idx = table().opaque_index_of_hash(value, key_hash);
+        if (table().exists(idx))
+        {
+            return {create_const_iterator(idx), false};
+        }
+
+        check_not_full(loc);
+        idx = table().emplace_with_hash(idx, key_hash, std::move(value));
+        return {create_const_iterator(idx), true};
+    }
+
     constexpr const_iterator insert(const_iterator /*hint*/,
                                     const K& key,
                                     const std_transition::source_location& loc =
@@ -239,7 +318,7 @@ public:
     {
         // TODO: shouldn't these be CheckingType:: checks?
         assert_or_abort(pos != cend());
-        const TableIndex idx = table().opaque_index_of(*pos);
+        const TableIndex idx = table().opaque_index_of_hash(*pos, hash_of(pos));
         assert_or_abort(table().exists(idx));
         const TableIteratedIndex next_idx = table().erase(idx);
         return iterator{ReferenceProvider{std::addressof(table()), next_idx}};
@@ -256,15 +335,119 @@ public:
         return iterator{ReferenceProvider{std::addressof(table()), next_idx}};
     }
 
-    constexpr size_type erase(const key_type& key) noexcept
+    constexpr size_type erase(const key_type& key) noexcept { return erase_impl(key); }
+
+    // `key_hash` must be `hash_function()(key)`, see `insert_with_hash()`
+    constexpr size_type erase(const key_type& key, std::uint64_t key_hash) noexcept
+    {
+        return erase_impl(key, key_hash);
+    }
+
+    template <class K0>
+    constexpr size_type erase(K0&& key) noexcept
+        requires(TRANSPARENT_LOOKUP and !std::is_convertible_v<K0 &&, iterator> and
+                 !std::is_convertible_v<K0 &&, const_iterator>)
     {
-        const TableIndex idx = table().opaque_index_of(key);
+        return erase_impl(key);
+    }
+
+    /**
+     * Moves the key at `pos` out of the set and into the returned handle, which can be inserted
+     * into a set of any capacity. The handle keeps the hash of the key, see
+     * `FixedMapAdapter::extract()`.
+     */
+    constexpr node_type extract(const_iterator pos) noexcept
+    {
+        assert_or_abort(pos != cend());
+        const std::uint64_t key_hash = hash_of(pos);
+        const TableIndex idx = table().opaque_index_of_hash(*pos, key_hash);
+        assert_or_abort(table().exists(idx));
+        return extract_at(idx, key_hash);
+    }
+
+    // Returns an empty handle if `key` is not present
+    constexpr node_type extract(const K& key) noexcept
+    {
+        const std::uint64_t key_hash = table().hash(key);
+        const TableIndex idx = table().opaque_index_of_hash(key, key_hash);
         if (!table().exists(idx))
         {
-            return 0;
+            return node_type{};
         }
-        table().erase(idx);
-        return 1;
+        return extract_at(idx, key_hash);
+    }
+
+    constexpr insert_return_type insert(
+        node_type&& node,
+        const std_transition::source_location& loc =
+            std_transition::source_location::current()) noexcept
+    {
+        if (node.empty())
+        {
+            return {cend(), false, node_type{}};
+        }
+
+        const std::uint64_t key_hash = hash_of_node(node);
+        TableIndex idx = table().opaque_index_of_hash(std::as_const(node).value(), key_hash);
+        if (table().exists(idx))
+        {
+            return {create_const_iterator(idx), false, std::move(node)};
+        }
+
+        check_not_full(loc);
+        idx = table().emplace_with_hash(idx, key_hash, std::move(node.value()));
+        node = node_type{};
+        return {create_const_iterator(idx), true, node_type{}};
+    }
+
+    constexpr const_iterator insert(const_iterator /*hint*/,
+                                    node_type&& node,
+                                    const std_transition::source_location& loc =
+                                        std_transition::source_location::current()) noexcept
+    {
+        return insert(std::move(node), loc).position;
+    }
+
+    /**
+     * Moves every key of `source` that is not present into this set. Keys that are present stay
+     * in `source`. See `FixedMapAdapter::merge()`.
+     */
+    template <typename TableImpl2, typename CheckingType2>
+    constexpr void merge(FixedSetAdapter<K, TableImpl2, CheckingType2>& source,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        constexpr bool SAME_HASH =
+            std::is_same_v<hasher, typename TableImpl2::HashType> && std::is_empty_v<hasher>;
+
+        TableImpl2& source_table = source.IMPLEMENTATION_DETAIL_DO_NOT_USE_table_;
+        auto source_index = source_table.begin_index();
+        while (source_index != source_table.end_index())
+        {
+            const K& key = source_table.key_at(source_index);
+            const std::uint64_t source_hash = source_table.hash_at(source_index);
+            const std::uint64_t key_hash = SAME_HASH ? source_hash : table().hash(key);
+            const TableIndex idx = table().opaque_index_of_hash(key, key_hash);
+            if (table().exists(idx))
+            {
+                source_index = source_table.next_of(source_index);
+                continue;
+            }
+
+            check_not_full(loc);
+            const auto source_idx = source_table.opaque_index_of_hash(key, source_hash);
+            table().emplace_with_hash(
+                idx, key_hash, std::move(source_table.mutable_key_at(source_index)));
+            source_index = source_table.erase(source_idx);
+        }
+    }
+
+    template <typename TableImpl2, typename CheckingType2>
+    constexpr void merge(FixedSetAdapter<K, TableImpl2, CheckingType2>&& source,
+                         const std_transition::source_location& loc =
+                             std_transition::source_location::current()) noexcept
+    {
+        merge(source, loc);
     }
 
     [[nodiscard]] constexpr iterator find(const K& key) noexcept
@@ -275,15 +458,21 @@ public:
 
     [[nodiscard]] constexpr const_iterator find(const K& key) const noexcept
     {
-        TableIndex idx = table().opaque_index_of(key);
-        if (!table().exists(idx))
-        {
-            return cend();
-        }
-        return create_const_iterator(idx);
+        return find_impl(key);
     }
 
-    // TODO: handle transparent versions of functions (need to check tranparency carefully)
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find(const K0& key) const noexcept
+        requires TRANSPARENT_LOOKUP
+    {
+        return find_impl(key);
+    }
+
+    [[nodiscard]] constexpr const_iterator find(const K& key,
+                                                std::uint64_t key_hash) const noexcept
+    {
+        return find_impl(key, key_hash);
+    }
 
     [[nodiscard]] constexpr bool contains(const K& key) const noexcept
     {
@@ -291,11 +480,89 @@ public:
         return table().exists(idx);
     }
 
+    [[nodiscard]] constexpr bool contains(const K& key, std::uint64_t key_hash) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of_hash(key, key_hash);
+        return table().exists(idx);
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr bool contains(const K0& key) const noexcept
+        requires TRANSPARENT_LOOKUP
+    {
+        const TableIndex idx = table().opaque_index_of(key);
+        return table().exists(idx);
+    }
+
     [[nodiscard]] constexpr std::size_t count(const K& key) const noexcept
     {
         return static_cast<std::size_t>(contains(key));
     }
 
+    [[nodiscard]] constexpr std::size_t count(const K& key, std::uint64_t key_hash) const noexcept
+    {
+        return static_cast<std::size_t>(contains(key, key_hash));
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr std::size_t count(const K0& key) const noexcept
+        requires TRANSPARENT_LOOKUP
+    {
+        return static_cast<std::size_t>(contains(key));
+    }
+
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K& key) const noexcept
+    {
+        return equal_range_impl(find(key));
+    }
+    template <class K0>
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range(
+        const K0& key) const noexcept
+        requires TRANSPARENT_LOOKUP
+    {
+        return equal_range_impl(find(key));
+    }
+
+    /**
+     * Equivalent to `out[i] = find(keys[i])` for every key, but faster for more than a handful of
+     * keys because the memory accesses of the lookups overlap. `out` must be at least as large as
+     * `keys`.
+     */
+    constexpr void find_batch(std::span<const K> keys,
+                              std::span<const_iterator> out) const noexcept
+    {
+        assert_or_abort(out.size() >= keys.size());
+        for_each_batched_lookup(keys,
+                                [this, &out](std::size_t i, const TableIndex& idx)
+                                {
+                                    out[i] = table().exists(idx) ? create_const_iterator(idx)
+                                                                 : cend();
+                                });
+    }
+
+    // Equivalent to `out[i] = contains(keys[i])` for every key, see `find_batch()`
+    constexpr void contains_batch(std::span<const K> keys, std::span<bool> out) const noexcept
+    {
+        assert_or_abort(out.size() >= keys.size());
+        for_each_batched_lookup(keys,
+                                [this, &out](std::size_t i, const TableIndex& idx)
+                                { out[i] = table().exists(idx); });
+    }
+
+    /**
+     * The hash of the key at `pos`, as computed by `hash_function()`. Tables that store their
+     * hashes return it without hashing the key again, which makes copying into a set with a
+     * different bucket count through `insert_with_hash()` free of rehashing.
+     */
+    [[nodiscard]] constexpr std::uint64_t hash_of(const_iterator pos) const noexcept
+    {
+        assert_or_abort(pos != cend());
+        const ReferenceProvider& provider =
+            pos.template private_reference_provider<const ReferenceProvider&>();
+        return table().hash_at(provider.current_index_);
+    }
+
     template <typename TableImpl2, typename CheckingType2>
     [[nodiscard]] constexpr bool operator==(
         const FixedSetAdapter<K, TableImpl2, CheckingType2>& other) const
@@ -309,6 +576,104 @@ public:
     }
 
 private:
+    template <class K0>
+    constexpr size_type erase_impl(const K0& key) noexcept
+    {
+        return erase_impl(key, table().hash(key));
+    }
+
+    template <class K0>
+    constexpr size_type erase_impl(const K0& key, std::uint64_t key_hash) noexcept
+    {
+        const TableIndex idx = table().opaque_index_of_hash(key, key_hash);
+        if (!table().exists(idx))
+        {
+            return 0;
+        }
+        table().erase(idx);
+        return 1;
+    }
+
+    constexpr node_type extract_at(const TableIndex& idx, std::uint64_t key_hash) noexcept
+    {
+        node_type node{node_handle_detail::EXTRACTED,
+                       std::move(table().mutable_key_at(table().iterated_index_from(idx))),
+                       key_hash};
+        table().erase(idx);
+        return node;
+    }
+
+    // The hash kept by the handle can only be trusted if the hasher has no state
+    [[nodiscard]] constexpr std::uint64_t hash_of_node(const node_type& node) const
+    {
+        if constexpr (std::is_empty_v<hasher>)
+        {
+            if (node.key_hash().has_value())
+            {
+                return *node.key_hash();
+            }
+        }
+        return table().hash(node.value());
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find_impl(const K0& key) const noexcept
+    {
+        return find_impl(key, table().hash(key));
+    }
+
+    template <class K0>
+    [[nodiscard]] constexpr const_iterator find_impl(const K0& key,
+                                                     std::uint64_t key_hash) const noexcept
+    {
+        const TableIndex idx = table().opaque_index_of_hash(key, key_hash);
+        if (!table().exists(idx))
+        {
+            return cend();
+        }
+        return create_const_iterator(idx);
+    }
+
+    // Looks keys up in batches: first hash all of them and prefetch their home buckets, then
+    // prefetch the values those buckets point to, and only then probe. This overlaps the cache
+    // misses of the whole batch, which a loop of `find()` can't do.
+    template <typename Callback>
+    constexpr void for_each_batched_lookup(std::span<const K> keys, Callback callback) const
+    {
+        std::array<std::uint64_t, BATCH_LOOKUP_SIZE> hashes{};
+        for (std::size_t batch_start = 0; batch_start < keys.size();
+             batch_start += BATCH_LOOKUP_SIZE)
+        {
+            const std::size_t batch_size =
+                std::min(BATCH_LOOKUP_SIZE, keys.size() - batch_start);
+            const std::span<const K> batch = keys.subspan(batch_start, batch_size);
+            for (std::size_t i = 0; i < batch_size; i++)
+            {
+                hashes[i] = table().hash(batch[i]);
+                table().prefetch_bucket(hashes[i]);
+            }
+            for (std::size_t i = 0; i < batch_size; i++)
+            {
+                table().prefetch_value(hashes[i]);
+            }
+            for (std::size_t i = 0; i < batch_size; i++)
+            {
+                callback(batch_start + i, table().opaque_index_of_hash(batch[i], hashes[i]));
+            }
+        }
+    }
+
+    // keys are unique, so the range is either empty or has exactly the found element
+    [[nodiscard]] constexpr std::pair<const_iterator, const_iterator> equal_range_impl(
+        const_iterator found) const noexcept
+    {
+        if (found == cend())
+        {
+            return {found, found};
+        }
+        return {found, std::next(found)};
+    }
+
     constexpr iterator create_checked_iterator(const TableIndex& index) noexcept
     {
         // check for nonexistent indices and replace them with end() so the iterator compares
@@ -320,9 +685,10 @@ private:
         return create_const_iterator(index);
     }
 
-    constexpr iterator create_const_iterator(const TableIndex& start_index) noexcept
+    [[nodiscard]] constexpr const_iterator create_const_iterator(
+        const TableIndex& start_index) const noexcept
     {
-        return iterator{
+        return const_iterator{
             ReferenceProvider{std::addressof(table()), table().iterated_index_from(start_index)}};
     }
 
@@ -345,7 +711,17 @@ template <typename K, typename TableImpl, typename CheckingType, typename Predic
 constexpr typename FixedSetAdapter<K, TableImpl, CheckingType>::size_type erase_if(
     FixedSetAdapter<K, TableImpl, CheckingType>& container, Predicate predicate)
 {
-    return erase_if_detail::erase_if_impl(container, predicate);
+    if constexpr (erase_if_detail::TableWithEraseIfAt<TableImpl>)
+    {
+        TableImpl& table = container.IMPLEMENTATION_DETAIL_DO_NOT_USE_table_;
+        return table.erase_if_at(
+            [&table, &predicate](const typename TableImpl::OpaqueIteratedType& value_index)
+            { return predicate(table.key_at(value_index)); });
+    }
+    else
+    {
+        return erase_if_detail::erase_if_impl(container, predicate);
+    }
 }
 
 }  // namespace fixed_containers
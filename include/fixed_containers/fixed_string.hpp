@@ -6,6 +6,7 @@
 #include "fixed_containers/preconditions.hpp"
 #include "fixed_containers/sequence_container_checking.hpp"
 #include "fixed_containers/source_location.hpp"
+#include "fixed_containers/wyhash.hpp"
 
 #include <array>
 #include <cstddef>
@@ -735,6 +736,15 @@ template <std::size_t MAXIMUM_LENGTH_WITH_NULL_TERMINATOR>
 
 }  // namespace fixed_containers
 
+namespace fixed_containers::wyhash
+{
+// Hashes identically to `std::string_view`, so it can be used for heterogeneous lookups
+template <std::size_t MAXIMUM_LENGTH, customize::SequenceContainerChecking CheckingType>
+struct hash<FixedString<MAXIMUM_LENGTH, CheckingType>> : string_hash<char>
+{
+};
+}  // namespace fixed_containers::wyhash
+
 // Specializations
 namespace std
 {
@@ -0,0 +1,621 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_doubly_linked_list.hpp"
+#include "fixed_containers/index_width.hpp"
+#include "fixed_containers/map_entry.hpp"
+#include "fixed_containers/memory.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define FIXED_CONTAINERS_SWISS_HASHTABLE_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define FIXED_CONTAINERS_SWISS_HASHTABLE_NEON 1
+#endif
+
+// A "Swiss table" style open-addressing hashtable, in the spirit of
+// https://abseil.io/about/design/swisstables.
+//
+// The table keeps a byte of metadata per slot (the control bytes) in an array separate from the
+// slots themselves. Slots are grouped in groups of 16, and a lookup compares the 7-bit fingerprint
+// of the key against all 16 control bytes of a group at once, only touching the slot array (and the
+// value storage) for candidate matches. Values live in a `FixedDoublyLinkedList` exactly like in
+// `FixedRobinhoodHashtable`, so iteration order and iterator stability are the same for both
+// tables.
+
+namespace fixed_containers::fixed_swiss_hashtable_detail
+{
+
+struct ControlByte
+{
+    using Type = std::uint8_t;
+
+    // The control byte is 0 for empty slots so that a value-initialized table is a valid empty
+    // table. Full slots have the most significant bit set, and store the 7-bit fingerprint of the
+    // hash in the rest of the byte.
+    static constexpr Type EMPTY = 0b0000'0000;
+    static constexpr Type DELETED = 0b0000'0001;
+    static constexpr Type FULL_BIT = 0b1000'0000;
+
+    static constexpr std::uint64_t FINGERPRINT_BITS = 7;
+    static constexpr std::uint64_t FINGERPRINT_MASK = (1U << FINGERPRINT_BITS) - 1;
+
+    [[nodiscard]] static constexpr Type full_from_hash(std::uint64_t hash)
+    {
+        return static_cast<Type>(FULL_BIT | (hash & FINGERPRINT_MASK));
+    }
+
+    [[nodiscard]] static constexpr bool is_full(Type control) { return (control & FULL_BIT) != 0; }
+};
+
+// Bitmask with one bit per slot of a group, bit `i` corresponding to slot `i` of the group.
+using GroupMask = std::uint32_t;
+
+struct Group
+{
+    static constexpr std::size_t WIDTH = 16;
+
+    [[nodiscard]] static constexpr GroupMask match_scalar(const ControlByte::Type* group,
+                                                          ControlByte::Type control)
+    {
+        GroupMask out = 0;
+        for (std::size_t i = 0; i < WIDTH; i++)
+        {
+            if (group[i] == control)
+            {
+                out |= GroupMask{1} << i;
+            }
+        }
+        return out;
+    }
+
+    [[nodiscard]] static constexpr GroupMask match_full_scalar(const ControlByte::Type* group)
+    {
+        GroupMask out = 0;
+        for (std::size_t i = 0; i < WIDTH; i++)
+        {
+            if (ControlByte::is_full(group[i]))
+            {
+                out |= GroupMask{1} << i;
+            }
+        }
+        return out;
+    }
+
+    // Returns the slots in the group whose control byte is equal to `control`.
+    [[nodiscard]] static constexpr GroupMask match(const ControlByte::Type* group,
+                                                   ControlByte::Type control)
+    {
+        if (std::is_constant_evaluated())
+        {
+            return match_scalar(group, control);
+        }
+#if defined(FIXED_CONTAINERS_SWISS_HASHTABLE_SSE2)
+        // 16-wide groups are a single SSE2 register; AVX2 builds use the VEX-encoded version of the
+        // same instructions.
+        const __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        const __m128i needle = _mm_set1_epi8(static_cast<char>(control));
+        return static_cast<GroupMask>(_mm_movemask_epi8(_mm_cmpeq_epi8(needle, ctrl)));
+#elif defined(FIXED_CONTAINERS_SWISS_HASHTABLE_NEON)
+        const uint8x16_t ctrl = vld1q_u8(group);
+        const uint8x16_t matches = vceqq_u8(ctrl, vdupq_n_u8(control));
+        return movemask_neon(matches);
+#else
+        return match_scalar(group, control);
+#endif
+    }
+
+    // Returns the slots in the group that are occupied.
+    [[nodiscard]] static constexpr GroupMask match_full(const ControlByte::Type* group)
+    {
+        if (std::is_constant_evaluated())
+        {
+            return match_full_scalar(group);
+        }
+#if defined(FIXED_CONTAINERS_SWISS_HASHTABLE_SSE2)
+        const __m128i ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+        return static_cast<GroupMask>(_mm_movemask_epi8(ctrl));
+#elif defined(FIXED_CONTAINERS_SWISS_HASHTABLE_NEON)
+        const uint8x16_t ctrl = vld1q_u8(group);
+        return movemask_neon(vcltq_s8(vreinterpretq_s8_u8(ctrl), vdupq_n_s8(0)));
+#else
+        return match_full_scalar(group);
+#endif
+    }
+
+    [[nodiscard]] static constexpr GroupMask match_empty(const ControlByte::Type* group)
+    {
+        return match(group, ControlByte::EMPTY);
+    }
+
+    // Returns the slots in the group that are available for insertion (empty or deleted).
+    [[nodiscard]] static constexpr GroupMask match_empty_or_deleted(const ControlByte::Type* group)
+    {
+        constexpr GroupMask ALL_SLOTS = (GroupMask{1} << WIDTH) - 1;
+        return ~match_full(group) & ALL_SLOTS;
+    }
+
+#if defined(FIXED_CONTAINERS_SWISS_HASHTABLE_NEON)
+    static GroupMask movemask_neon(uint8x16_t matches)
+    {
+        // NEON has no movemask; weigh each lane by its bit and sum each half horizontally.
+        static constexpr std::array<std::uint8_t, WIDTH> WEIGHTS = {
+            1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+        const uint8x16_t weighted = vandq_u8(matches, vld1q_u8(WEIGHTS.data()));
+        const GroupMask low = vaddv_u8(vget_low_u8(weighted));
+        const GroupMask high = vaddv_u8(vget_high_u8(weighted));
+        return low | (high << 8U);
+    }
+#endif
+};
+
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_VALUE_COUNT,
+          std::size_t BUCKET_COUNT,
+          class Hash,
+          class KeyEqual>
+class FixedSwissHashtable
+{
+public:
+    using PairType = MapEntry<K, V>;
+    using HashType = Hash;
+    using KeyEqualType = KeyEqual;
+
+    static constexpr std::size_t CAPACITY = MAXIMUM_VALUE_COUNT;
+    // Round the requested bucket count up to whole groups. Always have at least one group, so that
+    // the group index computation never does a modulo 0.
+    static constexpr std::size_t GROUP_COUNT =
+        std::max<std::size_t>(1, (BUCKET_COUNT + Group::WIDTH - 1) / Group::WIDTH);
+    static constexpr std::size_t INTERNAL_TABLE_SIZE = GROUP_COUNT * Group::WIDTH;
+
+    // Slots only store value indices, so they are as narrow as the capacity allows.
+    using SizeType = index_width::SmallestIndexType<CAPACITY + 1>;
+    using SlotIndexType = std::size_t;
+    using DeletedCountType = index_width::SmallestIndexType<INTERNAL_TABLE_SIZE + 1>;
+
+    static_assert(MAXIMUM_VALUE_COUNT <= INTERNAL_TABLE_SIZE,
+                  "need at least enough slots to point to every value in array");
+
+    fixed_doubly_linked_list_detail::FixedDoublyLinkedList<PairType, CAPACITY, SizeType>
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_{};
+    std::array<ControlByte::Type, INTERNAL_TABLE_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_control_{};
+    std::array<SizeType, INTERNAL_TABLE_SIZE> IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_{};
+    DeletedCountType IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_{};
+
+    Hash IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_{};
+    KeyEqual IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_{};
+
+    struct OpaqueIndexType
+    {
+        SlotIndexType slot_index;
+        // Same trick as `FixedRobinhoodHashtable`: 0 for keys that exist, otherwise the (always
+        // non-zero) control byte that `emplace()` should write at `slot_index`.
+        ControlByte::Type control;
+    };
+
+    using OpaqueIteratedType = SizeType;
+
+    ////////////////////// helper functions
+public:
+    [[nodiscard]] constexpr ControlByte::Type control_at(SlotIndexType slot_index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_control_[slot_index];
+    }
+
+    [[nodiscard]] constexpr SizeType slot_at(SlotIndexType slot_index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_[slot_index];
+    }
+
+    [[nodiscard]] constexpr const ControlByte::Type* group_at(SlotIndexType group_index) const
+    {
+        return std::next(IMPLEMENTATION_DETAIL_DO_NOT_USE_control_.data(),
+                         static_cast<std::ptrdiff_t>(group_index * Group::WIDTH));
+    }
+
+    template <typename Key>
+    [[nodiscard]] constexpr std::uint64_t hash(const Key& key) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(key);
+    }
+
+    template <typename K1, typename K2>
+    [[nodiscard]] constexpr bool key_equal(const K1& key1, const K2& key2) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(key1, key2);
+    }
+
+    [[nodiscard]] static constexpr SlotIndexType group_index_from_hash(std::uint64_t hash)
+    {
+        // The lowest bits are the fingerprint, use the rest to pick the group.
+        const std::uint64_t shifted_hash = hash >> ControlByte::FINGERPRINT_BITS;
+        return static_cast<SlotIndexType>(shifted_hash % GROUP_COUNT);
+    }
+
+    [[nodiscard]] static constexpr SlotIndexType next_group_index(SlotIndexType group_index)
+    {
+        if (group_index + 1 < GROUP_COUNT)
+        {
+            return group_index + 1;
+        }
+        return 0;
+    }
+
+    [[nodiscard]] constexpr SlotIndexType first_available_slot(std::uint64_t key_hash) const
+    {
+        SlotIndexType group_index = group_index_from_hash(key_hash);
+        while (true)
+        {
+            const GroupMask available = Group::match_empty_or_deleted(group_at(group_index));
+            if (available != 0)
+            {
+                return group_index * Group::WIDTH +
+                       static_cast<SlotIndexType>(std::countr_zero(available));
+            }
+            group_index = next_group_index(group_index);
+        }
+    }
+
+    constexpr void set_control(SlotIndexType slot_index, ControlByte::Type control)
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_control_[slot_index] = control;
+    }
+
+    constexpr void erase_slot(SlotIndexType slot_index)
+    {
+        // A lookup stops at the first group that has an empty slot. So we can only make this slot
+        // empty if the group already had an empty slot, otherwise we might cut short the probe
+        // sequence of a key that was displaced past this group.
+        const SlotIndexType group_index = slot_index / Group::WIDTH;
+        if (Group::match_empty(group_at(group_index)) != 0)
+        {
+            set_control(slot_index, ControlByte::EMPTY);
+            return;
+        }
+
+        set_control(slot_index, ControlByte::DELETED);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_++;
+        // Tombstones are never reclaimed by the fixed-size table growing, so rebuild the control
+        // bytes once they start to dominate, to keep the probe sequences short.
+        if (IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_ > INTERNAL_TABLE_SIZE / 4)
+        {
+            rebuild_control_bytes();
+        }
+    }
+
+    constexpr void rebuild_control_bytes()
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_control_.fill(ControlByte::EMPTY);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_ = 0;
+        for (SizeType value_index = begin_index(); value_index != end_index();
+             value_index = next_of(value_index))
+        {
+            const std::uint64_t key_hash = hash(key_at(value_index));
+            const SlotIndexType slot_index = first_available_slot(key_hash);
+            set_control(slot_index, ControlByte::full_from_hash(key_hash));
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_[slot_index] = value_index;
+        }
+    }
+
+    //////////////////////// Common Interface Impl
+public:
+    [[nodiscard]] constexpr std::size_t size() const
+    {
+        return static_cast<std::size_t>(IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.size());
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType begin_index() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.front_index();
+    }
+
+    static constexpr OpaqueIteratedType invalid_index()
+    {
+        return decltype(IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_)::NULL_INDEX;
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType end_index() const { return invalid_index(); }
+
+    [[nodiscard]] constexpr OpaqueIteratedType next_of(const OpaqueIteratedType& value_index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.next_of(value_index);
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType prev_of(const OpaqueIteratedType& value_index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.prev_of(value_index);
+    }
+
+    [[nodiscard]] constexpr const K& key_at(const OpaqueIteratedType& value_index) const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.at(value_index).key();
+    }
+
+    // Only for moving the key out right before erasing it, as changing it breaks the lookup
+    constexpr K& mutable_key_at(const OpaqueIteratedType& value_index)
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.at(value_index).key();
+    }
+
+    [[nodiscard]] constexpr const V& value_at(const OpaqueIteratedType& value_index) const
+        requires PairType::HAS_ASSOCIATED_VALUE
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.at(value_index).value();
+    }
+
+    constexpr V& value_at(const OpaqueIteratedType& value_index)
+        requires PairType::HAS_ASSOCIATED_VALUE
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.at(value_index).value();
+    }
+
+    [[nodiscard]] constexpr OpaqueIteratedType iterated_index_from(
+        const OpaqueIndexType& index) const
+    {
+        return slot_at(index.slot_index);
+    }
+
+    // Only the fingerprint of the hash is kept, so the key is hashed again
+    [[nodiscard]] constexpr std::uint64_t hash_at(const OpaqueIteratedType& value_index) const
+    {
+        return hash(key_at(value_index));
+    }
+
+    [[nodiscard]] constexpr const Hash& hash_function() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+    }
+
+    [[nodiscard]] constexpr const KeyEqual& key_eq() const
+    {
+        return IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+    }
+
+    // `Key` is `K`, or any type that `Hash` and `KeyEqual` transparently accept
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of(const Key& key) const
+    {
+        return opaque_index_of_hash(key, hash(key));
+    }
+
+    // Batch lookups call these for many hashes before resolving any of them, so that the cache
+    // misses of all the lookups overlap. The first brings in the home group, the second the value
+    // of the first fingerprint match in it.
+    constexpr void prefetch_bucket(std::uint64_t key_hash) const
+    {
+        const SlotIndexType group_index = group_index_from_hash(key_hash);
+        memory::prefetch_for_read(*group_at(group_index));
+        memory::prefetch_for_read(
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_[group_index * Group::WIDTH]);
+    }
+
+    constexpr void prefetch_value(std::uint64_t key_hash) const
+    {
+        const SlotIndexType group_index = group_index_from_hash(key_hash);
+        const GroupMask candidates =
+            Group::match(group_at(group_index), ControlByte::full_from_hash(key_hash));
+        if (candidates != 0)
+        {
+            const SlotIndexType slot_index =
+                group_index * Group::WIDTH +
+                static_cast<SlotIndexType>(std::countr_zero(candidates));
+            memory::prefetch_for_read(
+                IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.at(slot_at(slot_index)));
+        }
+    }
+
+    template <typename Key>
+    [[nodiscard]] constexpr OpaqueIndexType opaque_index_of_hash(const Key& key,
+                                                                 std::uint64_t key_hash) const
+    {
+        const ControlByte::Type control = ControlByte::full_from_hash(key_hash);
+        SlotIndexType group_index = group_index_from_hash(key_hash);
+
+        // Remember the first slot we could insert into, so that `emplace()` does not need to probe
+        // again. Stays at `INTERNAL_TABLE_SIZE` only if the table is completely full.
+        SlotIndexType insertion_slot = INTERNAL_TABLE_SIZE;
+
+        for (std::size_t probed_groups = 0; probed_groups < GROUP_COUNT; probed_groups++)
+        {
+            const ControlByte::Type* group = group_at(group_index);
+            const SlotIndexType group_start = group_index * Group::WIDTH;
+
+            for (GroupMask candidates = Group::match(group, control); candidates != 0;
+                 candidates &= candidates - 1)
+            {
+                const SlotIndexType slot_index =
+                    group_start + static_cast<SlotIndexType>(std::countr_zero(candidates));
+                if (key_equal(key, key_at(slot_at(slot_index))))
+                {
+                    return {slot_index, 0};
+                }
+            }
+
+            if (insertion_slot == INTERNAL_TABLE_SIZE)
+            {
+                const GroupMask available = Group::match_empty_or_deleted(group);
+                if (available != 0)
+                {
+                    insertion_slot =
+                        group_start + static_cast<SlotIndexType>(std::countr_zero(available));
+                }
+            }
+
+            // An empty slot means that the key was never displaced past this group.
+            if (Group::match_empty(group) != 0)
+            {
+                break;
+            }
+            group_index = next_group_index(group_index);
+        }
+
+        return {insertion_slot, control};
+    }
+
+    [[nodiscard]] constexpr bool exists(const OpaqueIndexType& index) const
+    {
+        return index.control == 0;
+    }
+
+    [[nodiscard]] constexpr const V& value(const OpaqueIndexType& index) const
+        requires PairType::HAS_ASSOCIATED_VALUE
+    {
+        // no safety checks
+        return value_at(slot_at(index.slot_index));
+    }
+
+    constexpr V& value(const OpaqueIndexType& index)
+        requires PairType::HAS_ASSOCIATED_VALUE
+    {
+        // no safety checks
+        return value_at(slot_at(index.slot_index));
+    }
+
+    template <typename... Args>
+    constexpr OpaqueIndexType emplace(const OpaqueIndexType& index, Args&&... args)
+    {
+        const SizeType value_loc =
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.emplace_back_and_return_index(
+                std::forward<Args>(args)...);
+
+        if (control_at(index.slot_index) == ControlByte::DELETED)
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_--;
+        }
+        set_control(index.slot_index, index.control);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_[index.slot_index] = value_loc;
+        return {index.slot_index, 0};
+    }
+
+    // `index` already carries the control byte derived from the hash, nothing else needs it
+    template <typename... Args>
+    constexpr OpaqueIndexType emplace_with_hash(const OpaqueIndexType& index,
+                                                std::uint64_t /*key_hash*/,
+                                                Args&&... args)
+    {
+        return emplace(index, std::forward<Args>(args)...);
+    }
+
+    constexpr OpaqueIteratedType erase(const OpaqueIndexType& index)
+    {
+        const SizeType value_index = slot_at(index.slot_index);
+
+        const SizeType next_index =
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.delete_at_and_return_next_index(
+                value_index);
+        erase_slot(index.slot_index);
+
+        return next_index;
+    }
+
+    constexpr OpaqueIteratedType erase_range(const OpaqueIteratedType& start_value_index,
+                                             const OpaqueIteratedType& end_value_index)
+    {
+        SizeType cur_index = start_value_index;
+        while (cur_index != end_value_index)
+        {
+            cur_index = erase(opaque_index_of(key_at(cur_index)));
+        }
+
+        return end_value_index;
+    }
+
+    constexpr void clear()
+    {
+        if constexpr (TriviallyDestructible<PairType>)
+        {
+            // Linear in the capacity like the control byte reset, but without chasing the list
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.clear_by_resetting_indices();
+        }
+        else
+        {
+            IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_.clear();
+        }
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_control_.fill(ControlByte::EMPTY);
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_ = 0;
+    }
+
+public:
+    constexpr FixedSwissHashtable() = default;
+
+    constexpr FixedSwissHashtable(const Hash& hash, const KeyEqual& equal = KeyEqual())
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(hash)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(equal)
+    {
+    }
+
+    // disable trivial copyability when using reference value types
+    // this is an artificial limitation needed because `std::reference_wrapper` is trivially
+    // copyable
+    constexpr FixedSwissHashtable(const FixedSwissHashtable& other)
+        requires IsReference<V>
+      : IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_(
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_control_(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_control_)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_(
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_(other.IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_)
+      , IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_(
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_)
+    {
+    }
+    constexpr FixedSwissHashtable(const FixedSwissHashtable& other)
+        requires(!IsReference<V>)
+    = default;
+
+    constexpr FixedSwissHashtable(FixedSwissHashtable&& other) = default;
+
+    constexpr FixedSwissHashtable& operator=(const FixedSwissHashtable& other)
+        requires IsReference<V>
+    {
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_value_storage_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_control_ = other.IMPLEMENTATION_DETAIL_DO_NOT_USE_control_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_ = other.IMPLEMENTATION_DETAIL_DO_NOT_USE_slots_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_ = other.IMPLEMENTATION_DETAIL_DO_NOT_USE_hash_;
+        IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_ =
+            other.IMPLEMENTATION_DETAIL_DO_NOT_USE_key_equal_;
+        return *this;
+    }
+    constexpr FixedSwissHashtable& operator=(const FixedSwissHashtable& other)
+        requires(!IsReference<V>)
+    = default;
+
+    constexpr FixedSwissHashtable& operator=(FixedSwissHashtable&& other) = default;
+};
+
+}  // namespace fixed_containers::fixed_swiss_hashtable_detail
+
+namespace fixed_containers
+{
+
+/**
+ * Table policy for `FixedUnorderedMap`/`FixedUnorderedSet` that uses a `FixedSwissHashtable`.
+ * Lookups match the fingerprint against a whole group of control bytes at a time (with SSE2 or
+ * NEON when available), which keeps the probing within a cache line of metadata.
+ */
+struct SwissHashtablePolicy
+{
+    template <typename K,
+              typename V,
+              std::size_t MAXIMUM_VALUE_COUNT,
+              std::size_t BUCKET_COUNT,
+              class Hash,
+              class KeyEqual>
+    using Table = fixed_swiss_hashtable_detail::
+        FixedSwissHashtable<K, V, MAXIMUM_VALUE_COUNT, BUCKET_COUNT, Hash, KeyEqual>;
+};
+
+}  // namespace fixed_containers
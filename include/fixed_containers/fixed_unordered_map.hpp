@@ -17,20 +17,21 @@ template <typename K,
           class KeyEqual = std::equal_to<K>,
           std::size_t BUCKET_COUNT =
               fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SIZE),
-          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>>
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>,
+          class HashtablePolicy = RobinhoodHashtablePolicy<>>
 class FixedUnorderedMap
   : public FixedMapAdapter<
         K,
         V,
-        fixed_robinhood_hashtable_detail::
-            FixedRobinhoodHashtable<K, V, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
+        typename HashtablePolicy::
+            template Table<K, V, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
         CheckingType>
 {
     using FMA = FixedMapAdapter<
         K,
         V,
-        fixed_robinhood_hashtable_detail::
-            FixedRobinhoodHashtable<K, V, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
+        typename HashtablePolicy::
+            template Table<K, V, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
         CheckingType>;
 
 public:
@@ -155,10 +156,17 @@ template <typename K,
           std::size_t BUCKET_COUNT,
           class Hash,
           class KeyEqual,
-          fixed_containers::customize::MapChecking<K> CheckingType>
+          fixed_containers::customize::MapChecking<K> CheckingType,
+          class HashtablePolicy>
 struct tuple_size<
-    fixed_containers::
-        FixedUnorderedMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, BUCKET_COUNT, CheckingType>>
+    fixed_containers::FixedUnorderedMap<K,
+                                        V,
+                                        MAXIMUM_SIZE,
+                                        Hash,
+                                        KeyEqual,
+                                        BUCKET_COUNT,
+                                        CheckingType,
+                                        HashtablePolicy>>
   : std::integral_constant<std::size_t, 0>
 {
     // Implicit Structured Binding due to the fields being public is disabled
@@ -2,6 +2,7 @@
 
 #include "fixed_containers/fixed_doubly_linked_list_raw_view.hpp"
 #include "fixed_containers/forward_iterator.hpp"
+#include "fixed_containers/index_width.hpp"
 
 #include <cstddef>
 
@@ -48,7 +49,7 @@ public:
 class FixedUnorderedMapRawView
 {
 private:
-    using ListView = fixed_doubly_linked_list_detail::FixedDoublyLinkedListRawView<uint32_t>;
+    using ListView = fixed_doubly_linked_list_detail::FixedDoublyLinkedListRawView<std::size_t>;
     const ListView list_view_;
     const std::size_t key_size_;
     const std::size_t key_alignment_;
@@ -77,7 +78,8 @@ public:  // public for testing
 
     static constexpr const void* get_linked_list_ptr(const void* map_ptr)
     {
-        // `value_storage_` is the first member of `FixedRobinhoodHashtable`
+        // `value_storage_` is the first member of `FixedRobinhoodHashtable` (and
+        // `FixedSwissHashtable`). Only the default linked list value storage can be viewed.
         return map_ptr;
     }
 
@@ -135,7 +137,9 @@ public:
       : list_view_{get_linked_list_ptr(map_ptr),
                    compute_pair_size(key_size, key_alignment, value_size, value_alignment),
                    std::max(key_alignment, value_alignment),
-                   value_count}
+                   value_count,
+                   // the index width of the value list is the smallest that fits the capacity
+                   index_width::smallest_index_size_bytes(value_count + 1)}
       , key_size_{key_size}
       , key_alignment_{key_alignment}
       , value_size_{value_size}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "fixed_containers/fixed_multimap_adapter.hpp"
+#include "fixed_containers/fixed_robinhood_hashtable.hpp"
+#include "fixed_containers/map_checking.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+namespace fixed_containers
+{
+
+/**
+ * Fixed-capacity multimap with maximum size that is declared at compile-time via
+ * template parameter. All the values share the `MAXIMUM_SIZE` budget, however they are spread
+ * over keys. Values with equal keys are adjacent in iteration order, in insertion order.
+ * Requires a table that supports duplicate keys, i.e. a robin-hood table with linked-list value
+ * storage.
+ */
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          class Hash = wyhash::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          std::size_t BUCKET_COUNT =
+              fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SIZE),
+          customize::MapChecking<K> CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>,
+          class HashtablePolicy = RobinhoodHashtablePolicy<>>
+class FixedUnorderedMultiMap
+  : public FixedMultiMapAdapter<
+        K,
+        V,
+        typename HashtablePolicy::
+            template Table<K, V, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
+        CheckingType>
+{
+    using FMMA = FixedMultiMapAdapter<
+        K,
+        V,
+        typename HashtablePolicy::
+            template Table<K, V, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
+        CheckingType>;
+
+public:
+    constexpr FixedUnorderedMultiMap(const Hash& hash = Hash(),
+                                     const KeyEqual& equal = KeyEqual()) noexcept
+      : FMMA{hash, equal}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedUnorderedMultiMap(
+        InputIt first,
+        InputIt last,
+        const Hash& hash = Hash(),
+        const KeyEqual& equal = KeyEqual(),
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedUnorderedMultiMap{hash, equal}
+    {
+        this->insert(first, last, loc);
+    }
+
+    constexpr FixedUnorderedMultiMap(
+        std::initializer_list<typename FixedUnorderedMultiMap::value_type> list,
+        const Hash& hash = Hash(),
+        const KeyEqual& equal = KeyEqual(),
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedUnorderedMultiMap{hash, equal}
+    {
+        this->insert(list, loc);
+    }
+};
+
+/**
+ * Construct a FixedUnorderedMultiMap with its capacity being deduced from the number of key-value
+ * pairs being passed.
+ */
+template <
+    typename K,
+    typename V,
+    class Hash = wyhash::hash<K>,
+    class KeyEqual = std::equal_to<K>,
+    std::size_t MAXIMUM_SIZE,
+    std::size_t BUCKET_COUNT = fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SIZE)>
+[[nodiscard]] constexpr auto make_fixed_unordered_multimap(
+    const std::pair<K, V> (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::MapAbortChecking<K, V, MAXIMUM_SIZE>;
+    using FixedMultiMapType =
+        FixedUnorderedMultiMap<K, V, MAXIMUM_SIZE, Hash, KeyEqual, BUCKET_COUNT, CheckingType>;
+    return FixedMultiMapType{std::begin(list), std::end(list), hash, key_equal, loc};
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          typename V,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t BUCKET_COUNT,
+          class Hash,
+          class KeyEqual,
+          fixed_containers::customize::MapChecking<K> CheckingType,
+          class HashtablePolicy>
+struct tuple_size<
+    fixed_containers::FixedUnorderedMultiMap<K,
+                                             V,
+                                             MAXIMUM_SIZE,
+                                             Hash,
+                                             KeyEqual,
+                                             BUCKET_COUNT,
+                                             CheckingType,
+                                             HashtablePolicy>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/fixed_multiset_adapter.hpp"
+#include "fixed_containers/fixed_robinhood_hashtable.hpp"
+#include "fixed_containers/set_checking.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+namespace fixed_containers
+{
+
+/**
+ * Fixed-capacity multiset with maximum size that is declared at compile-time via
+ * template parameter. All the copies of all the keys share the `MAXIMUM_SIZE` budget. Equal keys
+ * are adjacent in iteration order. Requires a table that supports duplicate keys, i.e. a robin-hood
+ * table with linked-list value storage.
+ */
+template <typename K,
+          std::size_t MAXIMUM_SIZE,
+          class Hash = wyhash::hash<K>,
+          class KeyEqual = std::equal_to<K>,
+          std::size_t BUCKET_COUNT =
+              fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SIZE),
+          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>,
+          class HashtablePolicy = RobinhoodHashtablePolicy<>>
+class FixedUnorderedMultiSet
+  : public FixedMultiSetAdapter<
+        K,
+        typename HashtablePolicy::
+            template Table<K, EmptyValue, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
+        CheckingType>
+{
+    using FMSA = FixedMultiSetAdapter<
+        K,
+        typename HashtablePolicy::
+            template Table<K, EmptyValue, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
+        CheckingType>;
+
+public:
+    constexpr FixedUnorderedMultiSet(const Hash& hash = Hash(),
+                                     const KeyEqual& equal = KeyEqual()) noexcept
+      : FMSA{hash, equal}
+    {
+    }
+
+    template <InputIterator InputIt>
+    constexpr FixedUnorderedMultiSet(
+        InputIt first,
+        InputIt last,
+        const Hash& hash = Hash(),
+        const KeyEqual& equal = KeyEqual(),
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedUnorderedMultiSet{hash, equal}
+    {
+        this->insert(first, last, loc);
+    }
+
+    constexpr FixedUnorderedMultiSet(
+        std::initializer_list<typename FixedUnorderedMultiSet::value_type> list,
+        const Hash& hash = Hash(),
+        const KeyEqual& equal = KeyEqual(),
+        const std_transition::source_location& loc = std_transition::source_location::current())
+      : FixedUnorderedMultiSet{hash, equal}
+    {
+        this->insert(list, loc);
+    }
+};
+
+/**
+ * Construct a FixedUnorderedMultiSet with its capacity being deduced from the number of keys being
+ * passed.
+ */
+template <
+    typename K,
+    class Hash = wyhash::hash<K>,
+    class KeyEqual = std::equal_to<K>,
+    std::size_t MAXIMUM_SIZE,
+    std::size_t BUCKET_COUNT = fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SIZE)>
+[[nodiscard]] constexpr auto make_fixed_unordered_multiset(
+    const K (&list)[MAXIMUM_SIZE],
+    const Hash& hash = Hash{},
+    const KeyEqual& key_equal = KeyEqual{},
+    const std_transition::source_location& loc =
+        std_transition::source_location::current()) noexcept
+{
+    using CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>;
+    using FixedMultiSetType =
+        FixedUnorderedMultiSet<K, MAXIMUM_SIZE, Hash, KeyEqual, BUCKET_COUNT, CheckingType>;
+    return FixedMultiSetType{std::begin(list), std::end(list), hash, key_equal, loc};
+}
+
+}  // namespace fixed_containers
+
+// Specializations
+namespace std
+{
+template <typename K,
+          std::size_t MAXIMUM_SIZE,
+          std::size_t BUCKET_COUNT,
+          class Hash,
+          class KeyEqual,
+          fixed_containers::customize::SetChecking<K> CheckingType,
+          class HashtablePolicy>
+struct tuple_size<
+    fixed_containers::FixedUnorderedMultiSet<K,
+                                             MAXIMUM_SIZE,
+                                             Hash,
+                                             KeyEqual,
+                                             BUCKET_COUNT,
+                                             CheckingType,
+                                             HashtablePolicy>>
+  : std::integral_constant<std::size_t, 0>
+{
+    // Implicit Structured Binding due to the fields being public is disabled
+};
+}  // namespace std
@@ -17,18 +17,19 @@ template <typename K,
           class KeyEqual = std::equal_to<K>,
           std::size_t BUCKET_COUNT =
               fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SIZE),
-          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>>
+          customize::SetChecking<K> CheckingType = customize::SetAbortChecking<K, MAXIMUM_SIZE>,
+          class HashtablePolicy = RobinhoodHashtablePolicy<>>
 class FixedUnorderedSet
   : public FixedSetAdapter<
         K,
-        fixed_robinhood_hashtable_detail::
-            FixedRobinhoodHashtable<K, EmptyValue, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
+        typename HashtablePolicy::
+            template Table<K, EmptyValue, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
         CheckingType>
 {
     using FSA = FixedSetAdapter<
         K,
-        fixed_robinhood_hashtable_detail::
-            FixedRobinhoodHashtable<K, EmptyValue, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
+        typename HashtablePolicy::
+            template Table<K, EmptyValue, MAXIMUM_SIZE, BUCKET_COUNT, Hash, KeyEqual>,
         CheckingType>;
 
 public:
@@ -148,10 +149,16 @@ template <typename K,
           std::size_t BUCKET_COUNT,
           class Hash,
           class KeyEqual,
-          fixed_containers::customize::SetChecking<K> CheckingType>
+          fixed_containers::customize::SetChecking<K> CheckingType,
+          class HashtablePolicy>
 struct tuple_size<
-    fixed_containers::
-        FixedUnorderedSet<K, MAXIMUM_SIZE, Hash, KeyEqual, BUCKET_COUNT, CheckingType>>
+    fixed_containers::FixedUnorderedSet<K,
+                                        MAXIMUM_SIZE,
+                                        Hash,
+                                        KeyEqual,
+                                        BUCKET_COUNT,
+                                        CheckingType,
+                                        HashtablePolicy>>
   : std::integral_constant<std::size_t, 0>
 {
     // Implicit Structured Binding due to the fields being public is disabled
@@ -1,14 +1,17 @@
 #pragma once
 
 #include "fixed_containers/fixed_doubly_linked_list_raw_view.hpp"
+#include "fixed_containers/index_width.hpp"
+
+#include <cstddef>
 
 namespace fixed_containers
 {
 
 class FixedUnorderedSetRawView
-  : public fixed_doubly_linked_list_detail::FixedDoublyLinkedListRawView<uint32_t>
+  : public fixed_doubly_linked_list_detail::FixedDoublyLinkedListRawView<std::size_t>
 {
-    using Base = fixed_doubly_linked_list_detail::FixedDoublyLinkedListRawView<uint32_t>;
+    using Base = fixed_doubly_linked_list_detail::FixedDoublyLinkedListRawView<std::size_t>;
 
 public:
     using Base::const_iterator;
@@ -18,7 +21,8 @@ public:
 private:
     static constexpr const void* get_linked_list_ptr(const void* map_ptr)
     {
-        // `value_storage_` is the first member of `FixedRobinhoodHashtable`
+        // `value_storage_` is the first member of `FixedRobinhoodHashtable` (and
+        // `FixedSwissHashtable`). Only the default linked list value storage can be viewed.
         return map_ptr;
     }
 
@@ -27,7 +31,12 @@ public:
                              std::size_t elem_size,
                              std::size_t elem_align,
                              std::size_t elem_count)
-      : Base(get_linked_list_ptr(set_ptr), elem_size, elem_align, elem_count)
+      // the index width of the value list is the smallest that fits the capacity
+      : Base(get_linked_list_ptr(set_ptr),
+             elem_size,
+             elem_align,
+             elem_count,
+             index_width::smallest_index_size_bytes(elem_count + 1))
     {
     }
 };
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace fixed_containers::index_width
+{
+// Width in bytes of the smallest unsigned integer that can hold `value_count` distinct values plus
+// a sentinel stored as all ones, in the bits left after keeping the `reserved_bits` most
+// significant bits free for the caller (e.g. for a color). Available at runtime too, so raw views
+// can reconstruct the layout.
+constexpr std::size_t smallest_index_size_bytes(const std::size_t value_count,
+                                                const std::size_t reserved_bits = 0)
+{
+    if (value_count <= (std::size_t{(std::numeric_limits<std::uint8_t>::max)()} >> reserved_bits))
+    {
+        return sizeof(std::uint8_t);
+    }
+    if (value_count <= (std::size_t{(std::numeric_limits<std::uint16_t>::max)()} >> reserved_bits))
+    {
+        return sizeof(std::uint16_t);
+    }
+    if (value_count <= (std::size_t{(std::numeric_limits<std::uint32_t>::max)()} >> reserved_bits))
+    {
+        return sizeof(std::uint32_t);
+    }
+    return sizeof(std::uint64_t);
+}
+
+template <std::size_t VALUE_COUNT, std::size_t RESERVED_BITS = 0>
+using SmallestIndexType = std::conditional_t<
+    smallest_index_size_bytes(VALUE_COUNT, RESERVED_BITS) == sizeof(std::uint8_t),
+    std::uint8_t,
+    std::conditional_t<
+        smallest_index_size_bytes(VALUE_COUNT, RESERVED_BITS) == sizeof(std::uint16_t),
+        std::uint16_t,
+        std::conditional_t<smallest_index_size_bytes(VALUE_COUNT, RESERVED_BITS) ==
+                               sizeof(std::uint32_t),
+                           std::uint32_t,
+                           std::uint64_t>>>;
+
+}  // namespace fixed_containers::index_width
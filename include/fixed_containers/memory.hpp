@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <type_traits>
 
 namespace fixed_containers::memory
 {
@@ -34,6 +35,21 @@ constexpr void destroy_and_construct_at_address_of(T& ref, Args&&... args)
     construct_at_address_of(ref, std::forward<Args>(args)...);
 }
 
+// Hints to the CPU that `ref` is going to be read soon, so that the load can overlap with other
+// work. No-op at compile-time and on compilers without a prefetch builtin.
+template <typename T>
+constexpr void prefetch_for_read(const T& ref)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    if (!std::is_constant_evaluated())
+    {
+        __builtin_prefetch(std::addressof(ref), 0, 3);
+    }
+#else
+    (void)ref;
+#endif
+}
+
 template <typename T>
 const std::byte* addressof_as_const_byte_ptr(T& ref)
 {
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers::node_handle_detail
+{
+// Only the containers create non-empty node handles
+struct ExtractedTag
+{
+};
+inline constexpr ExtractedTag EXTRACTED{};
+}  // namespace fixed_containers::node_handle_detail
+
+namespace fixed_containers
+{
+/**
+ * An entry that was moved out of a map with `extract()`, to be moved into another map with
+ * `insert()`. Unlike `std::map`, there is no node to hand over: every fixed map has its own
+ * storage, so the key and value are moved into the handle and from there into the storage of the
+ * map the handle is inserted into.
+ *
+ * Handles of hash maps also keep the hash of the key, so that inserting them into a map with the
+ * same `Hash` does not hash the key again. Getting the key as mutable drops the kept hash.
+ */
+template <typename K, typename V, typename Hash = void>
+class MapNodeHandle
+{
+    template <typename, typename, typename>
+    friend class MapNodeHandle;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+
+private:
+    std::optional<std::pair<K, V>> entry_;
+    std::optional<std::uint64_t> key_hash_;
+
+public:
+    constexpr MapNodeHandle() noexcept = default;
+
+    constexpr MapNodeHandle(node_handle_detail::ExtractedTag /*tag*/,
+                            K&& key,
+                            V&& mapped,
+                            std::optional<std::uint64_t> key_hash = std::nullopt) noexcept
+      : entry_{std::in_place, std::move(key), std::move(mapped)}
+      , key_hash_{key_hash}
+    {
+    }
+
+    // Lets an entry move between maps of different kinds. The hash is only kept for the same `Hash`
+    template <typename Hash2>
+        requires(!std::is_same_v<Hash, Hash2>)
+    constexpr MapNodeHandle(MapNodeHandle<K, V, Hash2>&& other) noexcept
+      : entry_{std::move(other.entry_)}
+      , key_hash_{}
+    {
+        other.entry_.reset();
+        other.key_hash_.reset();
+    }
+
+    constexpr MapNodeHandle(const MapNodeHandle&) = delete;
+    constexpr MapNodeHandle& operator=(const MapNodeHandle&) = delete;
+
+    constexpr MapNodeHandle(MapNodeHandle&& other) noexcept
+      : entry_{std::move(other.entry_)}
+      , key_hash_{other.key_hash_}
+    {
+        other.entry_.reset();
+        other.key_hash_.reset();
+    }
+    constexpr MapNodeHandle& operator=(MapNodeHandle&& other) noexcept
+    {
+        if (this != &other)
+        {
+            entry_ = std::move(other.entry_);
+            key_hash_ = other.key_hash_;
+            other.entry_.reset();
+            other.key_hash_.reset();
+        }
+        return *this;
+    }
+
+    constexpr ~MapNodeHandle() noexcept = default;
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return !entry_.has_value(); }
+    constexpr explicit operator bool() const noexcept { return entry_.has_value(); }
+
+    [[nodiscard]] constexpr const K& key() const { return entry_->first; }
+    constexpr K& key()
+    {
+        key_hash_.reset();
+        return entry_->first;
+    }
+    [[nodiscard]] constexpr const V& mapped() const { return entry_->second; }
+    constexpr V& mapped() { return entry_->second; }
+
+    // The hash of the key as computed by the map it was extracted from, if that map is a hash map
+    [[nodiscard]] constexpr std::optional<std::uint64_t> key_hash() const noexcept
+    {
+        return key_hash_;
+    }
+};
+
+/**
+ * Same as `MapNodeHandle`, for sets.
+ */
+template <typename K, typename Hash = void>
+class SetNodeHandle
+{
+    template <typename, typename>
+    friend class SetNodeHandle;
+
+public:
+    using value_type = K;
+
+private:
+    std::optional<K> key_;
+    std::optional<std::uint64_t> key_hash_;
+
+public:
+    constexpr SetNodeHandle() noexcept = default;
+
+    constexpr SetNodeHandle(node_handle_detail::ExtractedTag /*tag*/,
+                            K&& key,
+                            std::optional<std::uint64_t> key_hash = std::nullopt) noexcept
+      : key_{std::move(key)}
+      , key_hash_{key_hash}
+    {
+    }
+
+    template <typename Hash2>
+        requires(!std::is_same_v<Hash, Hash2>)
+    constexpr SetNodeHandle(SetNodeHandle<K, Hash2>&& other) noexcept
+      : key_{std::move(other.key_)}
+      , key_hash_{}
+    {
+        other.key_.reset();
+        other.key_hash_.reset();
+    }
+
+    constexpr SetNodeHandle(const SetNodeHandle&) = delete;
+    constexpr SetNodeHandle& operator=(const SetNodeHandle&) = delete;
+
+    constexpr SetNodeHandle(SetNodeHandle&& other) noexcept
+      : key_{std::move(other.key_)}
+      , key_hash_{other.key_hash_}
+    {
+        other.key_.reset();
+        other.key_hash_.reset();
+    }
+    constexpr SetNodeHandle& operator=(SetNodeHandle&& other) noexcept
+    {
+        if (this != &other)
+        {
+            key_ = std::move(other.key_);
+            key_hash_ = other.key_hash_;
+            other.key_.reset();
+            other.key_hash_.reset();
+        }
+        return *this;
+    }
+
+    constexpr ~SetNodeHandle() noexcept = default;
+
+    [[nodiscard]] constexpr bool empty() const noexcept { return !key_.has_value(); }
+    constexpr explicit operator bool() const noexcept { return key_.has_value(); }
+
+    [[nodiscard]] constexpr const K& value() const { return *key_; }
+    constexpr K& value()
+    {
+        key_hash_.reset();
+        return *key_;
+    }
+
+    [[nodiscard]] constexpr std::optional<std::uint64_t> key_hash() const noexcept
+    {
+        return key_hash_;
+    }
+};
+
+/**
+ * Result of inserting a node handle. If the key was already present, `node` still has the entry.
+ */
+template <typename Iterator, typename NodeType>
+struct NodeInsertReturnType
+{
+    Iterator position;
+    bool inserted;
+    NodeType node;
+};
+
+}  // namespace fixed_containers
@@ -6,8 +6,11 @@
 #include "fixed_containers/fixed_vector.hpp"
 #include "fixed_containers/in_out.hpp"
 #include "fixed_containers/tuples.hpp"
+#include "fixed_containers/wyhash.hpp"
 
 #include <concepts>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string_view>
@@ -248,3 +251,24 @@ constexpr void for_each_field(T&& instance, Func&& func)
 }
 
 }  // namespace fixed_containers::reflection
+
+namespace fixed_containers::wyhash_detail
+{
+// Lets `wyhash::hash` hash aggregates field by field
+template <typename T>
+struct AggregateFields
+{
+    static_assert(reflection::Reflectable<T>);
+
+    static constexpr std::size_t count() { return reflection::field_count_of<T>(); }
+
+    template <typename Func>
+    static constexpr void for_each(const T& value, Func&& func)
+    {
+        reflection::for_each_field(
+            value,
+            [&func]<typename Field>(const std::string_view& /*name*/, const Field& field)
+            { func(field); });
+    }
+};
+}  // namespace fixed_containers::wyhash_detail
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <version>
+
+#if defined(__cpp_lib_flat_map)
+#include <flat_map>
+#endif
+
+namespace fixed_containers
+{
+// Tag for constructors whose input is already sorted by the comparator and has no duplicate keys.
+// Same as `std::sorted_unique_t` from C++23, which it is when available.
+#if defined(__cpp_lib_flat_map)
+using sorted_unique_t = std::sorted_unique_t;
+inline constexpr sorted_unique_t sorted_unique = std::sorted_unique;
+#else
+struct sorted_unique_t
+{
+    explicit sorted_unique_t() = default;
+};
+inline constexpr sorted_unique_t sorted_unique{};
+#endif
+}  // namespace fixed_containers
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/wyhash.hpp"
 
 #include <cstddef>
 #include <string_view>
@@ -55,3 +56,12 @@ private:
 };
 
 }  // namespace fixed_containers
+
+namespace fixed_containers::wyhash
+{
+// Hashes identically to `std::string_view`, so it can be used for heterogeneous lookups
+template <>
+struct hash<StringLiteral> : string_hash<char>
+{
+};
+}  // namespace fixed_containers::wyhash
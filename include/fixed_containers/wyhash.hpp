@@ -1,12 +1,17 @@
 #pragma once
 
 #include <array>
+#include <concepts>
 #include <cstdint>
 #include <cstring>
 #include <functional>
 #include <iterator>
 #include <memory>
 #include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 // This is a stripped-down implementation of wyhash: https://github.com/wangyi-fudan/wyhash
 // No big-endian support (because different values on different machines don't matter),
@@ -61,87 +66,152 @@ constexpr void mum(std::uint64_t* aaa, std::uint64_t* bbb)
     return aaa ^ bbb;
 }
 
-// read functions. WARNING: we don't care about endianness, so results are different on big endian!
-[[nodiscard]] inline auto r8(const std::uint8_t* ppp) -> std::uint64_t
+// Reads the bytes of an array of characters. WARNING: we don't care about endianness, so results
+// are different on big endian! At compile time the bytes are put together in little-endian order,
+// which gives the same results as `std::memcpy()` at runtime, so that a table built at compile time
+// can be queried at runtime.
+template <typename CharT>
+class CharBytes
 {
-    std::uint64_t vvv{};
-    std::memcpy(&vvv, ppp, 8U);
-    return vvv;
-}
+    const CharT* data_;
+
+public:
+    explicit constexpr CharBytes(const CharT* data)
+      : data_(data)
+    {
+    }
+
+    [[nodiscard]] constexpr auto byte_at(std::int64_t offset) const -> std::uint64_t
+    {
+        constexpr auto CHAR_SIZE = static_cast<std::int64_t>(sizeof(CharT));
+        const auto chr = static_cast<std::make_unsigned_t<CharT>>(
+            *std::next(data_, offset / CHAR_SIZE));
+        return static_cast<std::uint8_t>(chr >> (8U * static_cast<unsigned>(offset % CHAR_SIZE)));
+    }
 
-[[nodiscard]] inline auto r4(const std::uint8_t* ppp) -> std::uint64_t
+    template <std::size_t COUNT>
+    [[nodiscard]] constexpr auto read(std::int64_t offset) const -> std::uint64_t
+    {
+        std::uint64_t vvv{};
+        if (std::is_constant_evaluated())
+        {
+            for (std::size_t i = 0; i < COUNT; i++)
+            {
+                vvv |= byte_at(offset + static_cast<std::int64_t>(i)) << (8U * i);
+            }
+            return vvv;
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        std::memcpy(&vvv, std::next(reinterpret_cast<const std::uint8_t*>(data_), offset), COUNT);
+        return vvv;
+    }
+
+    [[nodiscard]] constexpr auto r8(std::int64_t offset) const -> std::uint64_t
+    {
+        return read<8U>(offset);
+    }
+
+    [[nodiscard]] constexpr auto r4(std::int64_t offset) const -> std::uint64_t
+    {
+        return read<4U>(offset);
+    }
+
+    // reads 1, 2, or 3 bytes
+    [[nodiscard]] constexpr auto r3(std::int64_t kkk) const -> std::uint64_t
+    {
+        return (byte_at(0) << 16U) | (byte_at(kkk >> 1U) << 8U) | byte_at(kkk - 1);
+    }
+};
+
+inline constexpr auto SECRET = std::array{UINT64_C(0xa0761d6478bd642f),
+                                          UINT64_C(0xe7037ed1a0b428db),
+                                          UINT64_C(0x8ebc6af09c88c6e3),
+                                          UINT64_C(0x589965cc75374cc3)};
+
+// What is left of the input after reading all of it, before the final mixing
+struct HashState
 {
-    std::uint32_t vvv{};
-    std::memcpy(&vvv, ppp, 4);
-    return vvv;
-}
+    std::uint64_t aaa;
+    std::uint64_t bbb;
+    std::uint64_t seed;
+};
 
-// reads 1, 2, or 3 bytes
-[[nodiscard]] inline auto r3(const std::uint8_t* ppp, std::int64_t kkk) -> std::uint64_t
+// Inputs of up to 16 bytes are read without any mixing
+template <typename CharT>
+[[nodiscard]] constexpr auto absorb_short_bytes(const CharBytes<CharT>& bytes, std::int64_t len)
+    -> HashState
 {
-    return (static_cast<std::uint64_t>(*ppp) << 16U) |
-           (static_cast<std::uint64_t>(*std::next(ppp, kkk >> 1U)) << 8U) |
-           *std::next(ppp, kkk - 1);
+    if (len >= 4)
+    {
+        return {(bytes.r4(0) << 32U) | bytes.r4((len >> 3U) << 2U),
+                (bytes.r4(len - 4) << 32U) | bytes.r4(len - 4 - ((len >> 3U) << 2U)),
+                SECRET[0]};
+    }
+    if (len > 0)
+    {
+        return {bytes.r3(len), 0, SECRET[0]};
+    }
+    return {0, 0, SECRET[0]};
 }
 
-[[maybe_unused]] [[nodiscard]] inline auto hash(void const* key, std::int64_t len) -> std::uint64_t
+template <typename CharT>
+[[nodiscard]] constexpr auto absorb_bytes(const CharBytes<CharT>& bytes, std::int64_t len)
+    -> HashState
 {
-    constexpr auto SECRET = std::array{UINT64_C(0xa0761d6478bd642f),
-                                       UINT64_C(0xe7037ed1a0b428db),
-                                       UINT64_C(0x8ebc6af09c88c6e3),
-                                       UINT64_C(0x589965cc75374cc3)};
+    if (len <= 16)
+    {
+        return absorb_short_bytes(bytes, len);
+    }
 
-    auto const* ppp = static_cast<std::uint8_t const*>(key);
+    std::int64_t pos = 0;
     std::uint64_t seed = SECRET[0];
-    std::uint64_t aaa{};
-    std::uint64_t bbb{};
-    if (len <= 16)
+    std::int64_t iii = len;
+    if (iii > 48)
     {
-        if (len >= 4)
+        std::uint64_t see1 = seed;
+        std::uint64_t see2 = seed;
+        do
         {
-            aaa = (r4(ppp) << 32U) | r4(std::next(ppp, (len >> 3U) << 2U));
-            bbb = (r4(std::next(ppp, len - 4)) << 32U) |
-                  r4(std::next(ppp, len - 4 - ((len >> 3U) << 2U)));
-        }
-        else if (len > 0)
-        {
-            aaa = r3(ppp, len);
-            bbb = 0;
-        }
-        else
-        {
-            aaa = 0;
-            bbb = 0;
-        }
+            seed = mix(bytes.r8(pos) ^ SECRET[1], bytes.r8(pos + 8) ^ seed);
+            see1 = mix(bytes.r8(pos + 16) ^ SECRET[2], bytes.r8(pos + 24) ^ see1);
+            see2 = mix(bytes.r8(pos + 32) ^ SECRET[3], bytes.r8(pos + 40) ^ see2);
+            pos += 48;
+            iii -= 48;
+        } while (iii > 48);
+        seed ^= see1 ^ see2;
     }
-    else
+    while (iii > 16)
     {
-        std::int64_t iii = len;
-        if (iii > 48)
-        {
-            std::uint64_t see1 = seed;
-            std::uint64_t see2 = seed;
-            do
-            {
-                seed = mix(r8(ppp) ^ SECRET[1], r8(std::next(ppp, 8)) ^ seed);
-                see1 = mix(r8(std::next(ppp, 16)) ^ SECRET[2], r8(std::next(ppp, 24)) ^ see1);
-                see2 = mix(r8(std::next(ppp, 32)) ^ SECRET[3], r8(std::next(ppp, 40)) ^ see2);
-                std::advance(ppp, 48);
-                iii -= 48;
-            } while (iii > 48);
-            seed ^= see1 ^ see2;
-        }
-        while (iii > 16)
-        {
-            seed = mix(r8(ppp) ^ SECRET[1], r8(std::next(ppp, 8)) ^ seed);
-            iii -= 16;
-            std::advance(ppp, 16);
-        }
-        aaa = r8(std::next(ppp, iii - 16));
-        bbb = r8(std::next(ppp, iii - 8));
+        seed = mix(bytes.r8(pos) ^ SECRET[1], bytes.r8(pos + 8) ^ seed);
+        iii -= 16;
+        pos += 16;
     }
+    return {bytes.r8(pos + iii - 16), bytes.r8(pos + iii - 8), seed};
+}
+
+[[nodiscard]] constexpr auto finish(std::int64_t len, const HashState& state) -> std::uint64_t
+{
+    return mix(SECRET[1] ^ static_cast<std::uint64_t>(len),
+               mix(state.aaa ^ SECRET[1], state.bbb ^ state.seed));
+}
+
+template <typename CharT>
+[[nodiscard]] constexpr auto hash_bytes(const CharBytes<CharT>& bytes, std::int64_t len)
+    -> std::uint64_t
+{
+    return finish(len, absorb_bytes(bytes, len));
+}
+
+[[maybe_unused]] [[nodiscard]] inline auto hash(void const* key, std::int64_t len) -> std::uint64_t
+{
+    return hash_bytes(CharBytes{static_cast<std::uint8_t const*>(key)}, len);
+}
 
-    return mix(SECRET[1] ^ static_cast<std::uint64_t>(len), mix(aaa ^ SECRET[1], bbb ^ seed));
+// Same as hashing the bytes of the characters, but also usable at compile time
+template <typename CharT>
+[[nodiscard]] constexpr auto hash_chars(const CharT* data, std::size_t count) -> std::uint64_t
+{
+    return hash_bytes(CharBytes{data}, static_cast<std::int64_t>(sizeof(CharT) * count));
 }
 
 [[nodiscard]] constexpr std::uint64_t hash(std::uint64_t value)
@@ -149,6 +219,44 @@ constexpr void mum(std::uint64_t* aaa, std::uint64_t* bbb)
     return mix(value, UINT64_C(0x9E3779B97F4A7C15));
 }
 
+// A single multiply followed by a xorshift. Much cheaper than the 128-bit multiply of `hash()`, and
+// folds the well-mixed upper bits of the product into the lower bits, so that all bits of the
+// result depend on the whole input. Good enough for sequential ints, but not as strong as `hash()`.
+[[nodiscard]] constexpr std::uint64_t fast_mix(std::uint64_t value)
+{
+    value *= UINT64_C(0x9E3779B97F4A7C15);
+    return value ^ (value >> 32U);
+}
+
+// Combines the hash of an element of a composite key with the hash of the elements before it.
+// Not symmetric, so `(a, b)` and `(b, a)` hash differently.
+[[nodiscard]] constexpr std::uint64_t combine(std::uint64_t seed, std::uint64_t element_hash)
+{
+    return mix(seed ^ UINT64_C(0xa0761d6478bd642f), element_hash ^ UINT64_C(0xe7037ed1a0b428db));
+}
+
+// Walks the fields of an aggregate for `wyhash::hash`. Only `reflection.hpp` defines it, as static
+// reflection is not available with every compiler. Hashing an aggregate without it fails to
+// compile, instead of silently picking another hash.
+template <typename T>
+struct AggregateFields;
+
+template <typename T>
+concept IntegerLike = std::integral<T> || std::is_enum_v<T>;
+
+template <IntegerLike T>
+[[nodiscard]] constexpr std::uint64_t as_uint64(T value)
+{
+    if constexpr (std::is_enum_v<T>)
+    {
+        return static_cast<std::uint64_t>(static_cast<std::underlying_type_t<T>>(value));
+    }
+    else
+    {
+        return static_cast<std::uint64_t>(value);
+    }
+}
+
 }  // namespace fixed_containers::wyhash_detail
 
 namespace fixed_containers::wyhash
@@ -166,24 +274,31 @@ struct hash  // NOLINT(readability-identifier-naming)
     }
 };
 
+// Hashes the characters of anything convertible to a `std::basic_string_view`. This is a
+// transparent hash, so all string types hash identically and a map keyed by one of them can be
+// queried with any other, e.g. `FixedString` keys with `std::string_view` lookups.
 template <typename CharT>
-struct hash<std::basic_string<CharT>>
+struct string_hash  // NOLINT(readability-identifier-naming)
 {
-    std::uint64_t operator()(std::basic_string<CharT> const& str) const noexcept
+    using is_transparent = void;
+
+    template <typename StringLike>
+        requires std::convertible_to<const StringLike&, std::basic_string_view<CharT>>
+    constexpr std::uint64_t operator()(const StringLike& str) const noexcept
     {
-        return wyhash_detail::hash(str.data(),
-                                   static_cast<std::int64_t>(sizeof(CharT) * str.size()));
+        const std::basic_string_view<CharT> view = str;
+        return wyhash_detail::hash_chars(view.data(), view.size());
     }
 };
 
 template <typename CharT>
-struct hash<std::basic_string_view<CharT>>
+struct hash<std::basic_string<CharT>> : string_hash<CharT>
+{
+};
+
+template <typename CharT>
+struct hash<std::basic_string_view<CharT>> : string_hash<CharT>
 {
-    std::uint64_t operator()(std::basic_string_view<CharT> const& str) const noexcept
-    {
-        return wyhash_detail::hash(str.data(),
-                                   static_cast<std::int64_t>(sizeof(CharT) * str.size()));
-    }
 };
 
 template <class T>
@@ -234,4 +349,77 @@ struct hash<T>
     }
 };
 
+// Hashes the elements of a composite key with `wyhash::hash` and combines them in order.
+template <typename... Ts>
+struct composite_hash  // NOLINT(readability-identifier-naming)
+{
+    template <typename... Args>
+    constexpr std::uint64_t operator()(const Args&... elements) const noexcept
+    {
+        std::uint64_t seed = sizeof...(Ts);
+        ((seed = wyhash_detail::combine(seed, hash<Ts>{}(elements))), ...);
+        return seed;
+    }
+};
+
+template <typename T1, typename T2>
+struct hash<std::pair<T1, T2>>
+{
+    constexpr std::uint64_t operator()(const std::pair<T1, T2>& value) const noexcept
+    {
+        return composite_hash<T1, T2>{}(value.first, value.second);
+    }
+};
+
+template <typename... Ts>
+struct hash<std::tuple<Ts...>>
+{
+    constexpr std::uint64_t operator()(const std::tuple<Ts...>& value) const noexcept
+    {
+        return std::apply(composite_hash<Ts...>{}, value);
+    }
+};
+
+// Hashes the fields of aggregates in declaration order, so that structs can be used as keys
+// without a hand-written hash. Aggregates with a `std::hash` specialization keep using it. The
+// fields are found through `reflection.hpp`, but whether this specialization applies does not
+// depend on it, so every translation unit agrees on the hash of a given type.
+template <typename T>
+    requires(std::is_class_v<T> && std::is_aggregate_v<T> &&
+             !std::is_default_constructible_v<std::hash<T>>)
+struct hash<T>
+{
+    constexpr std::uint64_t operator()(const T& value) const noexcept
+    {
+        using Fields = wyhash_detail::AggregateFields<T>;
+        std::uint64_t seed = Fields::count();
+        Fields::for_each(value,
+                         [&seed]<typename Field>(const Field& field)
+                         { seed = wyhash_detail::combine(seed, hash<Field>{}(field)); });
+        return seed;
+    }
+};
+
+// Returns integral and enum keys as they are. Only for keys that are already well distributed,
+// e.g. halves of UUIDs or ids that have been hashed upstream. Sequential keys will cluster.
+template <wyhash_detail::IntegerLike T>
+struct identity_hash  // NOLINT(readability-identifier-naming)
+{
+    constexpr std::uint64_t operator()(T value) const noexcept
+    {
+        return wyhash_detail::as_uint64(value);
+    }
+};
+
+// Runs integral and enum keys through a single multiply-xorshift, see `wyhash_detail::fast_mix()`.
+// A middle ground between `identity_hash` and the full mixing of `hash`.
+template <wyhash_detail::IntegerLike T>
+struct fast_mix_hash  // NOLINT(readability-identifier-naming)
+{
+    constexpr std::uint64_t operator()(T value) const noexcept
+    {
+        return wyhash_detail::fast_mix(wyhash_detail::as_uint64(value));
+    }
+};
+
 }  // namespace fixed_containers::wyhash
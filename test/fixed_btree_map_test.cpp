@@ -0,0 +1,654 @@
+#include "fixed_containers/fixed_btree_map.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/arrow_proxy.hpp"
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedBTreeMap<int, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::bidirectional_iterator<ES_1::iterator>);
+static_assert(std::bidirectional_iterator<ES_1::const_iterator>);
+static_assert(!std::random_access_iterator<ES_1::iterator>);
+static_assert(!std::random_access_iterator<ES_1::const_iterator>);
+
+static_assert(std::is_trivially_copyable_v<ES_1::const_iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::reverse_iterator>);
+static_assert(std::is_trivially_copyable_v<ES_1::const_reverse_iterator>);
+
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, std::pair<const int&, int&>>);
+static_assert(std::is_same_v<typename std::iterator_traits<ES_1::iterator>::pointer,
+                             ArrowProxy<std::pair<const int&, int&>>>);
+static_assert(
+    std::is_same_v<std::iter_reference_t<ES_1::const_iterator>, std::pair<const int&, const int&>>);
+
+// Small nodes, so that a few entries already need several levels of inner nodes
+template <class K, class V, std::size_t MAXIMUM_SIZE, std::size_t KEYS_PER_NODE>
+using SmallNodeMap = FixedBTreeMap<K, V, MAXIMUM_SIZE, std::less<K>, KEYS_PER_NODE>;
+
+template <class MapType>
+void expect_same_contents(const MapType& map, const std::map<int, int>& reference)
+{
+    ASSERT_EQ(reference.size(), map.size());
+    ASSERT_TRUE(std::ranges::equal(
+        map,
+        reference,
+        [](const auto& lhs, const auto& rhs)
+        { return lhs.first == rhs.first && lhs.second == rhs.second; }));
+    ASSERT_TRUE(std::ranges::equal(map.crbegin(),
+                                   map.crend(),
+                                   reference.crbegin(),
+                                   reference.crend(),
+                                   [](const auto& lhs, const auto& rhs)
+                                   { return lhs.first == rhs.first; }));
+}
+
+template <std::size_t MAXIMUM_SIZE, std::size_t KEYS_PER_NODE>
+void randomized_against_std_map_helper()
+{
+    static constexpr int KEY_RANGE = static_cast<int>(MAXIMUM_SIZE * 3 / 2);
+
+    SmallNodeMap<int, int, MAXIMUM_SIZE, KEYS_PER_NODE> map{};
+    std::map<int, int> reference{};
+    std::mt19937 rng(12345);
+
+    for (int i = 0; i < 20000; i++)
+    {
+        const int key = static_cast<int>(rng() % KEY_RANGE);
+        switch (rng() % 6)
+        {
+        case 0:
+        case 1:
+            if (reference.size() < MAXIMUM_SIZE || reference.contains(key))
+            {
+                map[key] = i;
+                reference[key] = i;
+            }
+            break;
+        case 2:
+        {
+            auto it = map.find(key);
+            if (it != map.end())
+            {
+                const auto next = map.erase(it);
+                const auto reference_next = reference.erase(reference.find(key));
+                ASSERT_EQ(reference_next == reference.end(), next == map.end());
+                if (next != map.end())
+                {
+                    ASSERT_EQ(reference_next->first, next->first);
+                }
+            }
+            break;
+        }
+        case 3:
+            ASSERT_EQ(reference.erase(key), map.erase(key));
+            break;
+        case 4:
+        {
+            const auto lower = map.lower_bound(key);
+            const auto reference_lower = reference.lower_bound(key);
+            ASSERT_EQ(reference_lower == reference.end(), lower == map.end());
+            if (lower != map.end())
+            {
+                ASSERT_EQ(reference_lower->first, lower->first);
+            }
+            const auto upper = map.upper_bound(key);
+            const auto reference_upper = reference.upper_bound(key);
+            ASSERT_EQ(reference_upper == reference.end(), upper == map.end());
+            if (upper != map.end())
+            {
+                ASSERT_EQ(reference_upper->first, upper->first);
+            }
+            break;
+        }
+        default:
+        {
+            const int last = key + static_cast<int>(rng() % 8);
+            const auto next = map.erase(map.lower_bound(key), map.lower_bound(last));
+            reference.erase(reference.lower_bound(key), reference.lower_bound(last));
+            ASSERT_EQ(map.lower_bound(last), next);
+            break;
+        }
+        }
+
+        if (i % 97 == 0)
+        {
+            expect_same_contents(map, reference);
+        }
+        if (i % 5000 == 0)
+        {
+            map.clear();
+            reference.clear();
+        }
+    }
+    expect_same_contents(map, reference);
+
+    // Fill up in descending order and drain in ascending order
+    map.clear();
+    reference.clear();
+    for (int i = static_cast<int>(MAXIMUM_SIZE) - 1; i >= 0; i--)
+    {
+        map.try_emplace(i, i);
+        reference.try_emplace(i, i);
+    }
+    ASSERT_TRUE(is_full(map));
+    expect_same_contents(map, reference);
+    while (!map.empty())
+    {
+        map.erase(map.begin());
+    }
+}
+
+}  // namespace
+
+TEST(FixedBTreeMap, DefaultConstructor)
+{
+    constexpr FixedBTreeMap<int, int, 10> VAL1{};
+    static_assert(VAL1.empty());
+}
+
+TEST(FixedBTreeMap, IteratorConstructor)
+{
+    constexpr std::array INPUT{std::pair{2, 20}, std::pair{4, 40}};
+    constexpr FixedBTreeMap<int, int, 10> VAL2{INPUT.begin(), INPUT.end()};
+    static_assert(VAL2.size() == 2);
+
+    static_assert(VAL2.at(2) == 20);
+    static_assert(VAL2.at(4) == 40);
+}
+
+TEST(FixedBTreeMap, Initializer)
+{
+    constexpr FixedBTreeMap<int, int, 10> VAL1{{2, 20}, {4, 40}};
+    static_assert(VAL1.size() == 2);
+
+    constexpr FixedBTreeMap<int, int, 10> VAL2{{3, 30}};
+    static_assert(VAL2.size() == 1);
+}
+
+TEST(FixedBTreeMap, MaxSize)
+{
+    {
+        constexpr FixedBTreeMap<int, int, 10> VAL1{{2, 20}, {4, 40}};
+        static_assert(VAL1.max_size() == 10);
+    }
+
+    {
+        using ClassUnderTest = FixedBTreeMap<int, int, 10>;
+        static_assert(ClassUnderTest::static_max_size() == 10);
+    }
+}
+
+TEST(FixedBTreeMap, EmptySizeFull)
+{
+    constexpr FixedBTreeMap<int, int, 10> VAL1{{2, 20}, {4, 40}};
+    static_assert(VAL1.size() == 2);
+    static_assert(!VAL1.empty());
+
+    constexpr FixedBTreeMap<int, int, 10> VAL2{};
+    static_assert(VAL2.size() == 0);  // NOLINT(readability-container-size-empty)
+    static_assert(VAL2.empty());
+
+    constexpr FixedBTreeMap<int, int, 2> VAL3{{2, 20}, {4, 40}};
+    static_assert(is_full(VAL3));
+
+    constexpr FixedBTreeMap<int, int, 5> VAL4{{2, 20}, {4, 40}};
+    static_assert(!is_full(VAL4));
+}
+
+TEST(FixedBTreeMap, SortedUnique)
+{
+    constexpr auto VAL1 = []()
+    {
+        SmallNodeMap<int, int, 40, 2> var{};
+        for (int i = 0; i < 60; i++)
+        {
+            var[(i * 7) % 30] = i;
+        }
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 30);
+    static_assert(
+        std::ranges::is_sorted(VAL1, std::less<>{}, [](const auto& entry) { return entry.first; }));
+    static_assert(VAL1.at(0) == 30);
+    static_assert(VAL1.at(29) == 47);
+}
+
+TEST(FixedBTreeMap, OperatorBracketConstexpr)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedBTreeMap<int, int, 10> var1{};
+        var1[2] = 20;
+        var1[4] = 40;
+        return var1;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.at(2) == 20);
+    static_assert(VAL1.at(4) == 40);
+}
+
+TEST(FixedBTreeMap, OperatorBracketExceedsCapacity)
+{
+    FixedBTreeMap<int, int, 2> var1{};
+    var1[2];
+    var1[4];
+    var1[4];
+    EXPECT_DEATH(var1[6], "");
+}
+
+TEST(FixedBTreeMap, At)
+{
+    FixedBTreeMap<int, int, 10> var1{{2, 20}, {4, 40}};
+    var1.at(2) = 25;
+    ASSERT_EQ(25, var1.at(2));
+    EXPECT_DEATH((void)var1.at(3), "");
+}
+
+TEST(FixedBTreeMap, Insert)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedBTreeMap<int, int, 10> var{};
+        var.insert({2, 20});
+        var.insert({4, 40});
+        var.insert({2, 25});
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.at(2) == 20);
+    static_assert(VAL1.at(4) == 40);
+}
+
+TEST(FixedBTreeMap, InsertExceedsCapacity)
+{
+    FixedBTreeMap<int, int, 2> var1{};
+    var1.insert({2, 20});
+    var1.insert({4, 40});
+    var1.insert({4, 41});
+    EXPECT_DEATH(var1.insert({6, 60}), "");
+}
+
+TEST(FixedBTreeMap, InsertOrAssign)
+{
+    FixedBTreeMap<int, int, 10> var{};
+    auto [it1, was_inserted1] = var.insert_or_assign(2, 20);
+    ASSERT_TRUE(was_inserted1);
+    ASSERT_EQ(2, it1->first);
+    ASSERT_EQ(20, it1->second);
+
+    auto [it2, was_inserted2] = var.insert_or_assign(2, 25);
+    ASSERT_FALSE(was_inserted2);
+    ASSERT_EQ(25, it2->second);
+    ASSERT_EQ(1, var.size());
+}
+
+TEST(FixedBTreeMap, TryEmplace)
+{
+    FixedBTreeMap<int, std::string, 10> var{};
+    auto [it1, was_inserted1] = var.try_emplace(2, 3, 'a');
+    ASSERT_TRUE(was_inserted1);
+    ASSERT_EQ("aaa", it1->second);
+
+    auto [it2, was_inserted2] = var.try_emplace(2, "b");
+    ASSERT_FALSE(was_inserted2);
+    ASSERT_EQ("aaa", it2->second);
+}
+
+TEST(FixedBTreeMap, Emplace)
+{
+    FixedBTreeMap<int, int, 10> var{};
+    var.emplace(2, 20);
+    var.emplace(std::piecewise_construct, std::forward_as_tuple(4), std::forward_as_tuple(40));
+    var.emplace(std::pair{2, 25});
+
+    ASSERT_EQ(2, var.size());
+    ASSERT_EQ(20, var.at(2));
+    ASSERT_EQ(40, var.at(4));
+}
+
+TEST(FixedBTreeMap, Clear)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedBTreeMap<int, int, 10> var{{2, 20}, {4, 40}};
+        var.clear();
+        var[3] = 30;
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 1);
+    static_assert(VAL1.at(3) == 30);
+}
+
+TEST(FixedBTreeMap, Erase)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedBTreeMap<int, int, 10> var{{2, 20}, {4, 40}};
+        const auto removed_count = var.erase(2);
+        assert_or_abort(removed_count == 1);
+        const auto removed_count2 = var.erase(3);
+        assert_or_abort(removed_count2 == 0);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 1);
+    static_assert(!VAL1.contains(2));
+    static_assert(VAL1.contains(4));
+}
+
+TEST(FixedBTreeMap, EraseTransparentComparator)
+{
+    FixedBTreeMap<MockAComparableToB, int, 5, std::less<>> var{};
+    var.try_emplace(MockAComparableToB{1}, 10);
+    var.try_emplace(MockAComparableToB{2}, 20);
+    ASSERT_EQ(1, var.erase(MockBComparableToA{2}));
+    ASSERT_EQ(0, var.erase(MockBComparableToA{2}));
+    ASSERT_EQ(1, var.size());
+}
+
+TEST(FixedBTreeMap, EraseIterator)
+{
+    constexpr auto VAL1 = []()
+    {
+        SmallNodeMap<int, int, 20, 2> var{};
+        for (int i = 0; i < 20; i++)
+        {
+            var[i] = i * 10;
+        }
+        // Erase every other entry, following the returned iterators
+        auto it = var.begin();
+        while (it != var.end())
+        {
+            it = var.erase(it);
+            if (it != var.end())
+            {
+                ++it;
+            }
+        }
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 10);
+    static_assert(!VAL1.contains(0));
+    static_assert(VAL1.at(1) == 10);
+    static_assert(VAL1.at(19) == 190);
+}
+
+TEST(FixedBTreeMap, EraseRange)
+{
+    constexpr auto VAL1 = []()
+    {
+        SmallNodeMap<int, int, 20, 3> var{};
+        for (int i = 0; i < 20; i++)
+        {
+            var[i] = i;
+        }
+        auto it = var.erase(var.find(3), var.find(15));
+        assert_or_abort(it->first == 15);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 8);
+    static_assert(VAL1.contains(2));
+    static_assert(!VAL1.contains(3));
+    static_assert(!VAL1.contains(14));
+    static_assert(VAL1.contains(15));
+}
+
+TEST(FixedBTreeMap, IteratorsAndReferencesStayValidUntilErased)
+{
+    SmallNodeMap<int, int, 100, 4> var{};
+    var.try_emplace(50, 500);
+    const int& value = var.at(50);
+    const auto it = var.find(50);
+
+    // Enough entries around it to split, rebalance and merge its leaf
+    for (int i = 0; i < 100; i++)
+    {
+        var.try_emplace(i, i * 10);
+    }
+    for (int i = 0; i < 100; i++)
+    {
+        if (i != 50)
+        {
+            var.erase(i);
+        }
+    }
+
+    ASSERT_EQ(1, var.size());
+    ASSERT_EQ(&value, &var.at(50));
+    ASSERT_EQ(it, var.find(50));
+    ASSERT_EQ(50, it->first);
+    ASSERT_EQ(500, it->second);
+    ASSERT_EQ(var.end(), std::next(it));
+}
+
+TEST(FixedBTreeMap, EraseIf)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedBTreeMap<int, int, 10> var{{2, 20}, {3, 30}, {4, 40}};
+        const std::size_t removed_count =
+            fixed_containers::erase_if(var,
+                                       [](const auto& entry)
+                                       {
+                                           const auto& [key, _] = entry;
+                                           return key == 2 or key == 4;
+                                       });
+        assert_or_abort(2 == removed_count);
+        return var;
+    }();
+
+    static_assert(consteval_compare::equal<1, VAL1.size()>);
+    static_assert(!VAL1.contains(2));
+    static_assert(VAL1.contains(3));
+    static_assert(VAL1.at(3) == 30);
+}
+
+TEST(FixedBTreeMap, IteratorBasic)
+{
+    constexpr FixedBTreeMap<int, int, 10> VAL1{{1, 10}, {2, 20}, {3, 30}, {4, 40}};
+
+    static_assert(std::distance(VAL1.cbegin(), VAL1.cend()) == 4);
+    static_assert(VAL1.begin()->first == 1);
+    static_assert(std::next(VAL1.begin(), 3)->second == 40);
+    static_assert(std::prev(VAL1.end())->first == 4);
+}
+
+TEST(FixedBTreeMap, IteratorMutableValue)
+{
+    SmallNodeMap<int, int, 10, 2> var{{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}};
+    for (auto&& [key, value] : var)
+    {
+        value *= 2;
+    }
+    ASSERT_EQ(20, var.at(1));
+    ASSERT_EQ(100, var.at(5));
+}
+
+TEST(FixedBTreeMap, ReverseIteratorBasic)
+{
+    constexpr SmallNodeMap<int, int, 10, 2> VAL1{{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}};
+
+    static_assert(std::distance(VAL1.crbegin(), VAL1.crend()) == 5);
+    static_assert(VAL1.rbegin()->first == 5);
+    static_assert(std::next(VAL1.rbegin(), 4)->first == 1);
+    static_assert(std::prev(VAL1.rend())->first == 1);
+}
+
+TEST(FixedBTreeMap, ReverseIteratorBase)
+{
+    FixedBTreeMap<int, int, 7> var{{1, 10}, {2, 20}, {3, 30}};
+    auto it = var.rbegin();  // points to 3
+    std::advance(it, 1);     // points to 2
+    auto base = it.base();   // points to 3
+    ASSERT_EQ(3, base->first);
+}
+
+TEST(FixedBTreeMap, Find)
+{
+    constexpr SmallNodeMap<int, int, 10, 2> VAL1{{2, 20}, {4, 40}, {6, 60}, {8, 80}};
+
+    static_assert(VAL1.find(1) == VAL1.cend());
+    static_assert(VAL1.find(2)->second == 20);
+    static_assert(VAL1.find(8)->second == 80);
+    static_assert(VAL1.find(9) == VAL1.cend());
+}
+
+TEST(FixedBTreeMap, FindTransparentComparator)
+{
+    constexpr FixedBTreeMap<MockAComparableToB, int, 3, std::less<>> VAL1{};
+    constexpr MockBComparableToA VAL2{5};
+    static_assert(VAL1.find(VAL2) == VAL1.cend());
+}
+
+TEST(FixedBTreeMap, ContainsAndCount)
+{
+    constexpr FixedBTreeMap<int, int, 10> VAL1{{2, 20}, {4, 40}};
+
+    static_assert(VAL1.contains(4));
+    static_assert(!VAL1.contains(5));
+    static_assert(VAL1.count(2) == 1);
+    static_assert(VAL1.count(3) == 0);
+}
+
+TEST(FixedBTreeMap, LowerAndUpperBound)
+{
+    constexpr SmallNodeMap<int, int, 10, 2> VAL1{{2, 20}, {4, 40}, {6, 60}, {8, 80}};
+
+    static_assert(VAL1.lower_bound(3)->first == 4);
+    static_assert(VAL1.lower_bound(4)->first == 4);
+    static_assert(VAL1.upper_bound(4)->first == 6);
+    static_assert(VAL1.lower_bound(9) == VAL1.cend());
+    static_assert(VAL1.upper_bound(8) == VAL1.cend());
+    static_assert(VAL1.lower_bound(0) == VAL1.cbegin());
+}
+
+TEST(FixedBTreeMap, EqualRange)
+{
+    constexpr FixedBTreeMap<int, int, 10> VAL1{{2, 20}, {4, 40}};
+
+    static_assert(std::distance(VAL1.equal_range(2).first, VAL1.equal_range(2).second) == 1);
+    static_assert(std::distance(VAL1.equal_range(3).first, VAL1.equal_range(3).second) == 0);
+}
+
+TEST(FixedBTreeMap, Equality)
+{
+    constexpr FixedBTreeMap<int, int, 10> VAL1{{1, 10}, {4, 40}};
+    constexpr SmallNodeMap<int, int, 11, 2> VAL2{{4, 40}, {1, 10}};
+    constexpr FixedBTreeMap<int, int, 10> VAL3{{1, 10}, {3, 30}};
+
+    static_assert(VAL1 == VAL2);
+    static_assert(VAL1 != VAL3);
+}
+
+TEST(FixedBTreeMap, RandomizedAgainstStdMap)
+{
+    randomized_against_std_map_helper<1, 2>();
+    randomized_against_std_map_helper<50, 2>();
+    randomized_against_std_map_helper<100, 3>();
+    randomized_against_std_map_helper<300, 4>();
+    randomized_against_std_map_helper<77, 5>();
+    randomized_against_std_map_helper<1000, 64>();
+}
+
+TEST(FixedBTreeMap, NonDefaultConstructible)
+{
+    {
+        constexpr FixedBTreeMap<int, MockNonDefaultConstructible, 10> VAL1{};
+        static_assert(VAL1.empty());
+    }
+    {
+        FixedBTreeMap<int, MockNonDefaultConstructible, 10> var2{};
+        var2.emplace(1, 3);
+    }
+}
+
+TEST(FixedBTreeMap, MoveableButNotCopyable)
+{
+    SmallNodeMap<std::string_view, MockMoveableButNotCopyable, 10, 2> var{};
+    var.emplace("a", MockMoveableButNotCopyable{});
+    var.emplace("b", MockMoveableButNotCopyable{});
+    var.emplace("c", MockMoveableButNotCopyable{});
+    var.erase("a");
+    ASSERT_EQ(2, var.size());
+}
+
+TEST(FixedBTreeMap, NonTriviallyCopyableEntries)
+{
+    using MapType = SmallNodeMap<std::string, std::string, 30, 2>;
+    static_assert(!TriviallyCopyable<MapType>);
+
+    MapType map_1{};
+    for (int i = 0; i < 30; i++)
+    {
+        map_1.try_emplace(std::to_string(i), 20, static_cast<char>('a' + (i % 26)));
+    }
+
+    MapType map_2{map_1};
+    for (int i = 0; i < 30; i += 2)
+    {
+        map_2.erase(std::to_string(i));
+    }
+    ASSERT_EQ(30, map_1.size());
+    ASSERT_EQ(15, map_2.size());
+
+    map_1 = map_2;
+    ASSERT_EQ(map_1, map_2);
+    ASSERT_EQ(std::string(20, 'b'), map_1.at("1"));
+
+    MapType map_3{std::move(map_2)};
+    ASSERT_EQ(map_1, map_3);
+
+    map_2 = std::move(map_3);
+    ASSERT_EQ(map_1, map_2);
+}
+
+namespace
+{
+template <FixedBTreeMap<int, int, 5> /*INSTANCE*/>
+struct FixedBTreeMapInstanceCanBeUsedAsATemplateParameter
+{
+};
+}  // namespace
+
+TEST(FixedBTreeMap, UsageAsTemplateParameter)
+{
+    static constexpr FixedBTreeMap<int, int, 5> INSTANCE1{{1, 10}};
+    const FixedBTreeMapInstanceCanBeUsedAsATemplateParameter<INSTANCE1> my_struct{};
+    static_cast<void>(my_struct);
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,309 @@
+#include "fixed_containers/fixed_btree_set.hpp"
+
+#include "mock_testing_types.hpp"
+
+#include "fixed_containers/assert_or_abort.hpp"
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedBTreeSet<int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::bidirectional_iterator<ES_1::iterator>);
+static_assert(std::bidirectional_iterator<ES_1::const_iterator>);
+static_assert(!std::random_access_iterator<ES_1::iterator>);
+static_assert(!std::random_access_iterator<ES_1::const_iterator>);
+
+static_assert(std::is_same_v<std::iter_value_t<ES_1::iterator>, int>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, const int&>);
+static_assert(std::is_same_v<typename std::iterator_traits<ES_1::iterator>::pointer, const int*>);
+
+// Small nodes, so that a few entries already need several levels of inner nodes
+template <class K, std::size_t MAXIMUM_SIZE, std::size_t KEYS_PER_NODE>
+using SmallNodeSet = FixedBTreeSet<K, MAXIMUM_SIZE, std::less<K>, KEYS_PER_NODE>;
+
+template <std::size_t MAXIMUM_SIZE, std::size_t KEYS_PER_NODE>
+void randomized_against_std_set_helper()
+{
+    static constexpr int KEY_RANGE = static_cast<int>(MAXIMUM_SIZE * 3 / 2);
+
+    SmallNodeSet<int, MAXIMUM_SIZE, KEYS_PER_NODE> set{};
+    std::set<int> reference{};
+    std::mt19937 rng(12345);
+
+    for (int i = 0; i < 20000; i++)
+    {
+        const int key = static_cast<int>(rng() % KEY_RANGE);
+        switch (rng() % 4)
+        {
+        case 0:
+        case 1:
+            if (reference.size() < MAXIMUM_SIZE || reference.contains(key))
+            {
+                ASSERT_EQ(reference.insert(key).second, set.insert(key).second);
+            }
+            break;
+        case 2:
+            ASSERT_EQ(reference.erase(key), set.erase(key));
+            break;
+        default:
+        {
+            const auto lower = set.lower_bound(key);
+            const auto reference_lower = reference.lower_bound(key);
+            ASSERT_EQ(reference_lower == reference.end(), lower == set.end());
+            if (lower != set.end())
+            {
+                ASSERT_EQ(*reference_lower, *lower);
+            }
+            break;
+        }
+        }
+
+        if (i % 97 == 0)
+        {
+            ASSERT_TRUE(std::ranges::equal(set, reference));
+            ASSERT_TRUE(std::ranges::equal(
+                set.crbegin(), set.crend(), reference.crbegin(), reference.crend()));
+        }
+    }
+    ASSERT_TRUE(std::ranges::equal(set, reference));
+}
+
+}  // namespace
+
+TEST(FixedBTreeSet, DefaultConstructor)
+{
+    constexpr FixedBTreeSet<int, 10> VAL1{};
+    static_assert(VAL1.empty());
+}
+
+TEST(FixedBTreeSet, IteratorConstructor)
+{
+    constexpr std::array INPUT{2, 4};
+    constexpr FixedBTreeSet<int, 10> VAL2{INPUT.begin(), INPUT.end()};
+    static_assert(VAL2.size() == 2);
+
+    static_assert(VAL2.contains(2));
+    static_assert(VAL2.contains(4));
+}
+
+TEST(FixedBTreeSet, Initializer)
+{
+    constexpr FixedBTreeSet<int, 10> VAL1{2, 4};
+    static_assert(VAL1.size() == 2);
+
+    constexpr FixedBTreeSet<int, 10> VAL2{3};
+    static_assert(VAL2.size() == 1);
+}
+
+TEST(FixedBTreeSet, SortedUnique)
+{
+    constexpr auto VAL1 = []()
+    {
+        SmallNodeSet<int, 40, 2> var{};
+        for (int i = 0; i < 60; i++)
+        {
+            var.insert((i * 7) % 30);
+        }
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 30);
+    static_assert(std::ranges::is_sorted(VAL1));
+    static_assert(*VAL1.begin() == 0);
+    static_assert(*VAL1.rbegin() == 29);
+}
+
+TEST(FixedBTreeSet, EmptySizeFull)
+{
+    constexpr FixedBTreeSet<int, 10> VAL1{2, 4};
+    static_assert(VAL1.size() == 2);
+    static_assert(!VAL1.empty());
+    static_assert(VAL1.max_size() == 10);
+
+    constexpr FixedBTreeSet<int, 2> VAL3{2, 4};
+    static_assert(is_full(VAL3));
+}
+
+TEST(FixedBTreeSet, InsertExceedsCapacity)
+{
+    FixedBTreeSet<int, 2> var1{};
+    var1.insert(2);
+    var1.insert(4);
+    var1.insert(4);
+    EXPECT_DEATH(var1.insert(6), "");
+}
+
+TEST(FixedBTreeSet, Emplace)
+{
+    FixedBTreeSet<std::pair<int, int>, 10> var{};
+    ASSERT_TRUE(var.emplace(1, 2).second);
+    ASSERT_FALSE(var.emplace(1, 2).second);
+    ASSERT_TRUE(var.emplace(1, 3).second);
+    ASSERT_EQ(2, var.size());
+}
+
+TEST(FixedBTreeSet, Erase)
+{
+    constexpr auto VAL1 = []()
+    {
+        SmallNodeSet<int, 20, 3> var{};
+        for (int i = 0; i < 20; i++)
+        {
+            var.insert(i);
+        }
+        assert_or_abort(var.erase(5) == 1);
+        assert_or_abort(var.erase(5) == 0);
+        auto it = var.erase(var.find(10), var.find(15));
+        assert_or_abort(*it == 15);
+        it = var.erase(var.begin());
+        assert_or_abort(*it == 1);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 13);
+    static_assert(!VAL1.contains(0));
+    static_assert(!VAL1.contains(5));
+    static_assert(!VAL1.contains(12));
+    static_assert(VAL1.contains(15));
+}
+
+TEST(FixedBTreeSet, IteratorsAndReferencesStayValidUntilErased)
+{
+    SmallNodeSet<int, 100, 4> var{};
+    const auto it = var.insert(50).first;
+    const int& key = *it;
+
+    // Enough keys around it to split, rebalance and merge its leaf
+    for (int i = 0; i < 100; i++)
+    {
+        var.insert(i);
+    }
+    for (int i = 0; i < 100; i++)
+    {
+        if (i != 50)
+        {
+            var.erase(i);
+        }
+    }
+
+    ASSERT_EQ(1, var.size());
+    ASSERT_EQ(&key, &*var.find(50));
+    ASSERT_EQ(it, var.find(50));
+    ASSERT_EQ(var.end(), std::next(it));
+}
+
+TEST(FixedBTreeSet, EraseIf)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedBTreeSet<int, 10> var{2, 3, 4};
+        const std::size_t removed_count =
+            fixed_containers::erase_if(var, [](const auto& key) { return key == 2 or key == 4; });
+        assert_or_abort(2 == removed_count);
+        return var;
+    }();
+
+    static_assert(consteval_compare::equal<1, VAL1.size()>);
+    static_assert(VAL1.contains(3));
+}
+
+TEST(FixedBTreeSet, LowerAndUpperBound)
+{
+    constexpr SmallNodeSet<int, 10, 2> VAL1{2, 4, 6, 8};
+
+    static_assert(*VAL1.lower_bound(3) == 4);
+    static_assert(*VAL1.lower_bound(4) == 4);
+    static_assert(*VAL1.upper_bound(4) == 6);
+    static_assert(VAL1.lower_bound(9) == VAL1.cend());
+    static_assert(VAL1.find(5) == VAL1.cend());
+    static_assert(VAL1.count(6) == 1);
+    static_assert(std::distance(VAL1.equal_range(6).first, VAL1.equal_range(6).second) == 1);
+}
+
+TEST(FixedBTreeSet, TransparentComparator)
+{
+    FixedBTreeSet<MockAComparableToB, 5, std::less<>> var{};
+    var.insert(MockAComparableToB{1});
+    var.insert(MockAComparableToB{2});
+    ASSERT_TRUE(var.contains(MockBComparableToA{2}));
+    ASSERT_EQ(1, var.erase(MockBComparableToA{2}));
+    ASSERT_FALSE(var.contains(MockBComparableToA{2}));
+}
+
+TEST(FixedBTreeSet, Equality)
+{
+    constexpr FixedBTreeSet<int, 10> VAL1{1, 4};
+    constexpr SmallNodeSet<int, 11, 2> VAL2{4, 1};
+    constexpr FixedBTreeSet<int, 10> VAL3{1, 3};
+
+    static_assert(VAL1 == VAL2);
+    static_assert(VAL1 != VAL3);
+}
+
+TEST(FixedBTreeSet, RandomizedAgainstStdSet)
+{
+    randomized_against_std_set_helper<50, 2>();
+    randomized_against_std_set_helper<100, 3>();
+    randomized_against_std_set_helper<300, 4>();
+    randomized_against_std_set_helper<1000, 64>();
+}
+
+TEST(FixedBTreeSet, NonTriviallyCopyableKeys)
+{
+    using SetType = SmallNodeSet<std::string, 30, 2>;
+    static_assert(!TriviallyCopyable<SetType>);
+
+    SetType set_1{};
+    for (int i = 0; i < 30; i++)
+    {
+        set_1.insert(std::string(20, 'a') + std::to_string(i));
+    }
+
+    SetType set_2{set_1};
+    erase_if(set_2, [](const std::string& key) { return key.back() == '0'; });
+    ASSERT_EQ(30, set_1.size());
+    ASSERT_EQ(27, set_2.size());
+
+    set_1 = set_2;
+    ASSERT_EQ(set_1, set_2);
+}
+
+namespace
+{
+template <FixedBTreeSet<int, 5> /*INSTANCE*/>
+struct FixedBTreeSetInstanceCanBeUsedAsATemplateParameter
+{
+};
+}  // namespace
+
+TEST(FixedBTreeSet, UsageAsTemplateParameter)
+{
+    static constexpr FixedBTreeSet<int, 5> INSTANCE1{1};
+    const FixedBTreeSetInstanceCanBeUsedAsATemplateParameter<INSTANCE1> my_struct{};
+    static_cast<void>(my_struct);
+}
+
+}  // namespace fixed_containers
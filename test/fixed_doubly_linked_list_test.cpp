@@ -565,5 +565,36 @@ TEST(FixedDoublyLinkedList, Clear)
     EXPECT_EQ(0, list.size());
 }
 
+TEST(FixedDoublyLinkedList, ClearByResettingIndices)
+{
+    constexpr auto LIST = []()
+    {
+        FixedDoublyLinkedList<int, 10> list{};
+        for (int i = 0; i < 10; i++)
+        {
+            list.emplace_back_and_return_index(i);
+        }
+        list.delete_at_and_return_next_index(3);
+        list.delete_at_and_return_next_index(7);
+        list.clear_by_resetting_indices();
+        return list;
+    }();
+    static_assert(0 == LIST.size());
+    static_assert(LIST.front_index() == decltype(LIST)::NULL_INDEX);
+
+    // Indices are handed out like in a new list
+    FixedDoublyLinkedList<int, 10> list = LIST;
+    EXPECT_EQ(0, list.emplace_back_and_return_index(100));
+    EXPECT_EQ(1, list.emplace_back_and_return_index(200));
+    EXPECT_EQ(0, list.front_index());
+    EXPECT_EQ(1, list.back_index());
+    EXPECT_EQ(2, list.size());
+    for (int i = 2; i < 10; i++)
+    {
+        list.emplace_back_and_return_index(i);
+    }
+    EXPECT_TRUE(list.full());
+}
+
 }  // namespace
 }  // namespace fixed_containers::fixed_doubly_linked_list_detail
@@ -0,0 +1,247 @@
+#include "fixed_containers/fixed_inline_key_hashtable.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_set>
+
+namespace fixed_containers::fixed_inline_key_hashtable_detail
+{
+namespace
+{
+
+// puts the value of an int into the fingerprint bits and also into the bits used to pick the
+// bucket, so that `value % BUCKET_COUNT` is the home bucket of the key.
+struct ConvenientIntHash
+{
+    constexpr uint64_t operator()(const int& value) const
+    {
+        const uint64_t fingerprint = static_cast<uint64_t>(value) & 0xFFU;
+        const uint64_t upper = static_cast<uint64_t>(value) << 8U;
+        return fingerprint | upper;
+    }
+};
+
+using IntTable =
+    FixedInlineKeyHashtable<int, EmptyValue, 10, 10, ConvenientIntHash, std::equal_to<>>;
+using OIT = typename IntTable::OpaqueIndexType;
+
+static_assert(IntTable::INTERNAL_TABLE_SIZE == 20);
+static_assert(IntTable::invalid_index() == 19);
+// No list of value indices, just the fingerprint next to each key
+static_assert(sizeof(IntTable::BucketType) == 2 * sizeof(int));
+
+static_assert(IsStructuralType<IntTable>);
+static_assert(TriviallyCopyable<IntTable>);
+static_assert(TriviallyCopyAssignable<IntTable>);
+static_assert(TriviallyMoveAssignable<IntTable>);
+static_assert(StandardLayout<IntTable>);
+
+template <typename Table>
+constexpr void insert_key(Table& table, int key)
+{
+    const auto idx = table.opaque_index_of(key);
+    if (!table.exists(idx))
+    {
+        table.emplace(idx, key);
+    }
+}
+
+template <typename Table>
+constexpr bool erase_key(Table& table, int key)
+{
+    const auto idx = table.opaque_index_of(key);
+    if (!table.exists(idx))
+    {
+        return false;
+    }
+    table.erase(idx);
+    return true;
+}
+
+template <typename Table>
+constexpr bool contains_key(const Table& table, int key)
+{
+    return table.exists(table.opaque_index_of(key));
+}
+
+}  // namespace
+
+TEST(InlineKeyTableOperations, Emplace)
+{
+    IntTable table{};
+
+    const OIT idx = table.opaque_index_of(4);
+    EXPECT_FALSE(table.exists(idx));
+    EXPECT_EQ(idx.bucket_index, 4);
+
+    const OIT inserted = table.emplace(idx, 4);
+    EXPECT_TRUE(table.exists(inserted));
+    EXPECT_EQ(table.key_at(table.iterated_index_from(inserted)), 4);
+    EXPECT_EQ(table.bucket_at(4).dist(), 1);
+    EXPECT_EQ(table.size(), 1);
+
+    // Same home bucket, the keys are ordered by fingerprint so 14 takes the bucket and 4 shifts up
+    insert_key(table, 14);
+    EXPECT_EQ(table.key_at(4), 14);
+    EXPECT_EQ(table.key_at(5), 4);
+    EXPECT_EQ(table.bucket_at(5).dist(), 2);
+
+    // Home bucket 5 is taken by a key that is further from home, so 5 goes after it
+    insert_key(table, 5);
+    EXPECT_EQ(table.key_at(6), 5);
+    EXPECT_TRUE(contains_key(table, 4));
+    EXPECT_TRUE(contains_key(table, 14));
+    EXPECT_TRUE(contains_key(table, 5));
+    EXPECT_FALSE(contains_key(table, 24));
+    EXPECT_EQ(table.size(), 3);
+}
+
+TEST(InlineKeyTableOperations, NoWrapAround)
+{
+    IntTable table{};
+    // Every key wants the last home bucket, so they spill into the buckets past it instead of
+    // wrapping around to the start
+    for (int i = 0; i < 10; i++)
+    {
+        insert_key(table, 9 + (i * 10));
+    }
+    EXPECT_EQ(table.size(), 10);
+    EXPECT_EQ(table.begin_index(), 9);
+    EXPECT_EQ(table.key_at(9), 99);
+    EXPECT_EQ(table.key_at(18), 9);
+    EXPECT_TRUE(table.bucket_at(IntTable::invalid_index()).empty());
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_TRUE(contains_key(table, 9 + (i * 10)));
+    }
+    EXPECT_FALSE(contains_key(table, 109));
+
+    // Erasing shifts the rest of the cluster back
+    EXPECT_TRUE(erase_key(table, 99));
+    EXPECT_EQ(table.key_at(9), 89);
+    EXPECT_EQ(table.bucket_at(9).dist(), 1);
+    EXPECT_TRUE(table.bucket_at(18).empty());
+    EXPECT_TRUE(contains_key(table, 9));
+}
+
+TEST(InlineKeyTableOperations, EraseReturnsNext)
+{
+    IntTable table{};
+    for (int key : {2, 12, 22, 5})
+    {
+        insert_key(table, key);
+    }
+
+    // 22, 12 and 2 are in buckets 2, 3 and 4. 12 moves into the bucket of 22, which is therefore
+    // the next one to visit
+    const auto next = table.erase(table.opaque_index_of(22));
+    EXPECT_EQ(next, 2);
+    EXPECT_EQ(table.key_at(next), 12);
+
+    // The last key of a cluster has nothing shifting into its bucket
+    const auto after_2 = table.erase(table.opaque_index_of(2));
+    EXPECT_EQ(table.key_at(after_2), 5);
+    EXPECT_EQ(table.erase(table.opaque_index_of(5)), table.end_index());
+    EXPECT_EQ(table.size(), 1);
+}
+
+TEST(InlineKeyTableOperations, EraseRangeAndClear)
+{
+    IntTable table{};
+    for (int i = 0; i < 10; i++)
+    {
+        insert_key(table, i * 3);
+    }
+
+    auto start = table.begin_index();
+    for (int i = 0; i < 3; i++)
+    {
+        start = table.next_of(start);
+    }
+    auto end = start;
+    for (int i = 0; i < 4; i++)
+    {
+        end = table.next_of(end);
+    }
+    const int key_at_end = table.key_at(end);
+    const auto next = table.erase_range(start, end);
+    EXPECT_EQ(table.key_at(next), key_at_end);
+    EXPECT_EQ(table.size(), 6);
+
+    table.clear();
+    EXPECT_EQ(table.size(), 0);
+    EXPECT_EQ(table.begin_index(), table.end_index());
+    EXPECT_FALSE(contains_key(table, 0));
+}
+
+TEST(InlineKeyTableOperations, AgainstStdUnorderedSet)
+{
+    using Table =
+        FixedInlineKeyHashtable<int, EmptyValue, 50, 64, std::hash<int>, std::equal_to<>>;
+    Table table{};
+    std::unordered_set<int> reference{};
+    for (int round = 0; round < 30; round++)
+    {
+        for (int i = 0; table.size() < Table::CAPACITY; i++)
+        {
+            const int key = (i * 7919 + round * 131) % 211;
+            insert_key(table, key);
+            reference.insert(key);
+        }
+        // Erase while iterating, like `erase_if()` does
+        for (auto it = table.begin_index(); it != table.end_index();)
+        {
+            const int key = table.key_at(it);
+            if (key % 3 == round % 3)
+            {
+                reference.erase(key);
+                it = table.erase(table.opaque_index_of(key));
+            }
+            else
+            {
+                it = table.next_of(it);
+            }
+        }
+
+        ASSERT_EQ(reference.size(), table.size());
+        std::size_t iterated = 0;
+        for (auto it = table.begin_index(); it != table.end_index(); it = table.next_of(it))
+        {
+            EXPECT_TRUE(reference.contains(table.key_at(it)));
+            iterated++;
+        }
+        EXPECT_EQ(reference.size(), iterated);
+        for (int key = 0; key < 211; key++)
+        {
+            EXPECT_EQ(reference.contains(key), contains_key(table, key));
+        }
+    }
+}
+
+TEST(InlineKeyTableOperations, Constexpr)
+{
+    constexpr IntTable TABLE = []()
+    {
+        IntTable table{};
+        for (int i = 0; i < 10; i++)
+        {
+            insert_key(table, i * 7);
+        }
+        for (int i = 0; i < 10; i += 2)
+        {
+            erase_key(table, i * 7);
+        }
+        return table;
+    }();
+
+    static_assert(TABLE.size() == 5);
+    static_assert(contains_key(TABLE, 7));
+    static_assert(!contains_key(TABLE, 14));
+}
+
+}  // namespace fixed_containers::fixed_inline_key_hashtable_detail
@@ -1,15 +1,21 @@
 #include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/fixed_btree_map.hpp"
 #include "fixed_containers/fixed_index_based_storage.hpp"
 #include "fixed_containers/fixed_map.hpp"
 #include "fixed_containers/fixed_red_black_tree_nodes.hpp"
 
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <iterator>
 #include <map>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -57,12 +63,18 @@ using DedicatedColorBitContiguousFixedMap =
 
 // The reference boost-based fixed_map (with an array-backed pool-allocator) was at 51000
 // at the time of writing.
-static_assert(consteval_compare::equal<50992, sizeof(FixedMap<int, V, CAP>)>);
-static_assert(consteval_compare::equal<50992, sizeof(CompactPoolFixedMap<int, V, CAP>)>);
-static_assert(consteval_compare::equal<50992, sizeof(CompactContiguousFixedMap<int, V, CAP>)>);
-static_assert(consteval_compare::equal<52032, sizeof(DedicatedColorBitPoolFixedMap<int, V, CAP>)>);
+// With 8-byte node indices, these were 50992 for the compact nodes and 52032 for the nodes with
+// a dedicated color. With CAP=130 the indices are 16-bit and the nodes are 372 bytes instead of
+// 392 and 400. The pool rounds them up to 376, as its slots also hold an 8-byte freelist index.
+// The tree also keeps the index of its maximum, which adds 8 bytes.
+static_assert(consteval_compare::equal<48920, sizeof(FixedMap<int, V, CAP>)>);
+static_assert(consteval_compare::equal<48920, sizeof(CompactPoolFixedMap<int, V, CAP>)>);
+static_assert(consteval_compare::equal<48400, sizeof(CompactContiguousFixedMap<int, V, CAP>)>);
+static_assert(consteval_compare::equal<48400, sizeof(DedicatedColorBitPoolFixedMap<int, V, CAP>)>);
 static_assert(
-    consteval_compare::equal<52032, sizeof(DedicatedColorBitContiguousFixedMap<int, V, CAP>)>);
+    consteval_compare::equal<48400, sizeof(DedicatedColorBitContiguousFixedMap<int, V, CAP>)>);
+// The B+-tree keeps the entries in a pool of the same size, plus copies of the keys in its nodes
+static_assert(consteval_compare::equal<49584, sizeof(FixedBTreeMap<int, V, CAP>)>);
 
 template <typename MapType>
 void benchmark_map_lookup(benchmark::State& state)
@@ -83,6 +95,215 @@ void benchmark_map_lookup(benchmark::State& state)
 
 BENCHMARK(benchmark_map_lookup<std::map<int, int>>);
 BENCHMARK(benchmark_map_lookup<FixedMap<int, int, 200>>);
+BENCHMARK(benchmark_map_lookup<FixedBTreeMap<int, int, 200>>);
+
+// Lookups of random keys, so that the branch predictor cannot learn the path down the tree
+constexpr std::size_t RANDOM_LOOKUP_ENTRY_COUNT = 1 << 16;
+
+template <typename MapType>
+void benchmark_map_lookup_random(benchmark::State& state)
+{
+    using KeyType = typename MapType::key_type;
+    // The maps are too large for the stack
+    static MapType instance{};
+    if (instance.empty())
+    {
+        for (std::size_t i = 0; i < RANDOM_LOOKUP_ENTRY_COUNT; i++)
+        {
+            instance.try_emplace(static_cast<KeyType>(i));
+        }
+    }
+
+    std::vector<KeyType> keys(1024);
+    std::uint64_t lcg_state = 12345;
+    for (KeyType& key : keys)
+    {
+        lcg_state = lcg_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        key = static_cast<KeyType>((lcg_state >> 33U) % RANDOM_LOOKUP_ENTRY_COUNT);
+    }
+
+    for (auto _ : state)
+    {
+        for (const KeyType& key : keys)
+        {
+            auto& entry = instance.at(key);
+            benchmark::DoNotOptimize(entry);
+        }
+    }
+}
+
+BENCHMARK(benchmark_map_lookup_random<std::map<int, int>>);
+BENCHMARK(benchmark_map_lookup_random<FixedMap<int, int, RANDOM_LOOKUP_ENTRY_COUNT>>);
+BENCHMARK(benchmark_map_lookup_random<FixedBTreeMap<int, int, RANDOM_LOOKUP_ENTRY_COUNT>>);
+
+// Many maps with large values, so that they do not fit in the cache and the lookups are bound by
+// the number of cache lines they touch
+template <typename MapType>
+void benchmark_map_lookup_cold(benchmark::State& state)
+{
+    using KeyType = typename MapType::key_type;
+    std::vector<MapType> instances(64);
+    for (MapType& instance : instances)
+    {
+        for (std::size_t i = 0; i < CAP; i++)
+        {
+            instance.try_emplace(static_cast<KeyType>((i * 37) % CAP));
+        }
+    }
+
+    std::size_t key = 0;
+    for (auto _ : state)
+    {
+        for (MapType& instance : instances)
+        {
+            key = (key * 17 + 5) % CAP;
+            auto& entry = instance.at(static_cast<KeyType>(key));
+            benchmark::DoNotOptimize(entry);
+        }
+    }
+}
+
+BENCHMARK(benchmark_map_lookup_cold<CompactPoolFixedMap<int, V, CAP>>);
+BENCHMARK(benchmark_map_lookup_cold<FixedBTreeMap<int, V, CAP>>);
+
+template <typename MapType>
+void benchmark_map_build_with_insert(benchmark::State& state)
+{
+    using KeyType = typename MapType::key_type;
+    std::array<std::pair<KeyType, typename MapType::mapped_type>, 200> entries{};
+    for (std::size_t i = 0; i < entries.size(); i++)
+    {
+        entries[i] = {static_cast<KeyType>(i), {}};
+    }
+
+    for (auto _ : state)
+    {
+        MapType instance{};
+        instance.insert(entries.begin(), entries.end());
+        benchmark::DoNotOptimize(instance);
+    }
+}
+
+template <typename MapType>
+void benchmark_map_build_from_sorted_unique(benchmark::State& state)
+{
+    using KeyType = typename MapType::key_type;
+    std::array<std::pair<KeyType, typename MapType::mapped_type>, 200> entries{};
+    for (std::size_t i = 0; i < entries.size(); i++)
+    {
+        entries[i] = {static_cast<KeyType>(i), {}};
+    }
+
+    for (auto _ : state)
+    {
+        auto instance = MapType::from_sorted_unique(entries.begin(), entries.end());
+        benchmark::DoNotOptimize(instance);
+    }
+}
+
+BENCHMARK(benchmark_map_build_with_insert<FixedMap<int, int, 200>>);
+BENCHMARK(benchmark_map_build_from_sorted_unique<FixedMap<int, int, 200>>);
+
+// Keys arriving in increasing order, one at a time, e.g. ingesting a time series
+template <typename MapType>
+void benchmark_map_sorted_insert_without_hint(benchmark::State& state)
+{
+    using KeyType = typename MapType::key_type;
+    for (auto _ : state)
+    {
+        MapType instance{};
+        for (std::size_t i = 0; i < 1000; i++)
+        {
+            instance.try_emplace(static_cast<KeyType>(i), 0);
+        }
+        benchmark::DoNotOptimize(instance);
+    }
+}
+
+template <typename MapType>
+void benchmark_map_sorted_insert_with_end_hint(benchmark::State& state)
+{
+    using KeyType = typename MapType::key_type;
+    for (auto _ : state)
+    {
+        MapType instance{};
+        for (std::size_t i = 0; i < 1000; i++)
+        {
+            instance.emplace_hint(instance.end(), static_cast<KeyType>(i), 0);
+        }
+        benchmark::DoNotOptimize(instance);
+    }
+}
+
+template <typename MapType>
+void benchmark_map_sorted_insert_with_append_max(benchmark::State& state)
+{
+    using KeyType = typename MapType::key_type;
+    for (auto _ : state)
+    {
+        MapType instance{};
+        for (std::size_t i = 0; i < 1000; i++)
+        {
+            instance.append_max(static_cast<KeyType>(i), 0);
+        }
+        benchmark::DoNotOptimize(instance);
+    }
+}
+
+BENCHMARK(benchmark_map_sorted_insert_without_hint<std::map<int, int>>);
+BENCHMARK(benchmark_map_sorted_insert_with_end_hint<std::map<int, int>>);
+BENCHMARK(benchmark_map_sorted_insert_without_hint<FixedMap<int, int, 1000>>);
+BENCHMARK(benchmark_map_sorted_insert_with_end_hint<FixedMap<int, int, 1000>>);
+BENCHMARK(benchmark_map_sorted_insert_with_append_max<FixedMap<int, int, 1000>>);
+
+// A few keys of interest against many, e.g. subscriptions against the available symbols
+template <typename MapType>
+MapType make_map_with_every_nth_key(const std::size_t count, const std::size_t stride)
+{
+    using KeyType = typename MapType::key_type;
+    MapType instance{};
+    for (std::size_t i = 0; i < count; i++)
+    {
+        instance.try_emplace(static_cast<KeyType>(i * stride), 0);
+    }
+    return instance;
+}
+
+template <typename MapType>
+void benchmark_map_intersection_with_iterators(benchmark::State& state)
+{
+    const auto all = make_map_with_every_nth_key<MapType>(1000, 1);
+    const auto few = make_map_with_every_nth_key<MapType>(20, 97);
+    for (auto _ : state)
+    {
+        MapType instance{};
+        std::set_intersection(few.begin(),
+                              few.end(),
+                              all.begin(),
+                              all.end(),
+                              std::inserter(instance, instance.end()),
+                              [](const auto& left, const auto& right)
+                              { return left.first < right.first; });
+        benchmark::DoNotOptimize(instance);
+    }
+}
+
+template <typename MapType>
+void benchmark_map_intersection_in_place(benchmark::State& state)
+{
+    const auto all = make_map_with_every_nth_key<MapType>(1000, 1);
+    const auto few = make_map_with_every_nth_key<MapType>(20, 97);
+    for (auto _ : state)
+    {
+        MapType instance = few;
+        instance.set_intersection(all);
+        benchmark::DoNotOptimize(instance);
+    }
+}
+
+BENCHMARK(benchmark_map_intersection_with_iterators<std::map<int, int>>);
+BENCHMARK(benchmark_map_intersection_with_iterators<FixedMap<int, int, 1000>>);
+BENCHMARK(benchmark_map_intersection_in_place<FixedMap<int, int, 1000>>);
 }  // namespace
 }  // namespace fixed_containers
 
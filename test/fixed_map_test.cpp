@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <map>
 #include <memory>
 #include <ranges>
@@ -27,6 +28,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace fixed_containers
 {
@@ -166,6 +168,32 @@ TEST(FixedMap, MaxSizeDeduction)
     }
 }
 
+TEST(FixedMap, SortedUnique)
+{
+    constexpr FixedMap<int, int, 10> VAL1{sorted_unique, {{2, 20}, {4, 40}, {7, 70}}};
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1.at(4) == 40);
+    static_assert(VAL1 == FixedMap<int, int, 10>{{7, 70}, {2, 20}, {4, 40}});
+
+    static constexpr std::array<std::pair<int, int>, 3> ENTRIES{{{3, 30}, {2, 20}, {1, 10}}};
+    constexpr auto VAL2 = FixedMap<int, int, 10, std::greater<>>::from_sorted_unique(
+        ENTRIES.begin(), ENTRIES.end());
+    static_assert(VAL2.size() == 3);
+    static_assert(VAL2.begin()->first == 3);
+    static_assert(VAL2.at(1) == 10);
+
+    // Moves the entries out of move iterators
+    std::array<std::pair<int, MockMoveableButNotCopyable>, 2> moveable{};
+    moveable[0].first = 1;
+    moveable[1].first = 2;
+    const auto var1 = FixedMap<int, MockMoveableButNotCopyable, 5>::from_sorted_unique(
+        std::make_move_iterator(moveable.begin()), std::make_move_iterator(moveable.end()));
+    EXPECT_EQ(2, var1.size());
+    EXPECT_TRUE(var1.contains(2));
+
+    EXPECT_DEATH((FixedMap<int, int, 2>{sorted_unique, {{1, 10}, {2, 20}, {3, 30}}}), "");
+}
+
 TEST(FixedMap, OperatorBracketNonConstexpr)
 {
     FixedMap<int, int, 10> var1{};
@@ -600,6 +628,83 @@ TEST(FixedMap, EmplaceExceedsCapacity)
     }
 }
 
+TEST(FixedMap, HintedInsertion)
+{
+    {
+        constexpr FixedMap<int, int, 10> VAL = []()
+        {
+            FixedMap<int, int, 10> var1{};
+            for (int i = 0; i < 10; i += 2)
+            {
+                var1.emplace_hint(var1.end(), i, i * 10);
+            }
+            // Right before the hint, right after it, and away from it
+            var1.try_emplace(var1.find(4), 3, 30);
+            var1.insert(var1.find(4), std::pair{5, 50});
+            var1.insert_or_assign(var1.begin(), 9, 90);
+            return var1;
+        }();
+
+        static_assert(consteval_compare::equal<8, VAL.size()>);
+        static_assert(VAL.at(3) == 30);
+        static_assert(VAL.at(5) == 50);
+        static_assert(VAL.at(9) == 90);
+        static_assert(std::ranges::equal(VAL,
+                                         std::array{0, 2, 3, 4, 5, 6, 8, 9},
+                                         {},
+                                         [](const auto& entry) { return entry.first; }));
+    }
+
+    {
+        FixedMap<int, int, 10> var1{{1, 10}, {5, 50}};
+
+        auto [it, was_inserted] = var1.emplace_hint(var1.find(5), 5, 51);
+        ASSERT_FALSE(was_inserted);
+        ASSERT_EQ(50, it->second);
+
+        it = var1.insert_or_assign(var1.end(), 1, 11);
+        ASSERT_EQ(2, var1.size());
+        ASSERT_EQ(11, it->second);
+
+        it = var1.insert(var1.end(), std::pair{3, 30});
+        ASSERT_EQ(3, var1.size());
+        ASSERT_EQ(3, it->first);
+        ASSERT_EQ(5, std::next(it)->first);
+
+        std::tie(it, was_inserted) = var1.emplace_hint(
+            var1.begin(), std::piecewise_construct, std::make_tuple(0), std::make_tuple(0));
+        ASSERT_TRUE(was_inserted);
+        ASSERT_EQ(var1.begin(), it);
+    }
+}
+
+TEST(FixedMap, AppendMaxAndPrependMin)
+{
+    constexpr FixedMap<int, int, 10> VAL1 = []()
+    {
+        FixedMap<int, int, 10> var1{};
+        var1.append_max(5, 50);
+        var1.append_max(7, 70);
+        var1.prepend_min(3, 30);
+        var1.prepend_min(1, 10);
+        return var1;
+    }();
+    static_assert(std::ranges::equal(
+        VAL1, std::array{1, 3, 5, 7}, {}, [](const auto& entry) { return entry.first; }));
+    static_assert(VAL1.at(3) == 30);
+
+    FixedMap<int, int, 3> var2{};
+    auto it = var2.append_max(2, 20);
+    ASSERT_EQ(20, it->second);
+    it = var2.prepend_min(1, 10);
+    ASSERT_EQ(1, it->first);
+    ASSERT_EQ(2, std::next(it)->first);
+    EXPECT_DEATH(var2.append_max(2, 21), "");
+    EXPECT_DEATH(var2.prepend_min(1, 11), "");
+    var2.append_max(3, 30);
+    EXPECT_DEATH(var2.append_max(4, 40), "");
+}
+
 TEST(FixedMap, Clear)
 {
     constexpr auto VAL1 = []()
@@ -631,6 +736,24 @@ TEST(FixedMap, Erase)
     static_assert(VAL1.contains(4));
 }
 
+TEST(FixedMap, EraseTransparentComparator)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<MockAComparableToB, int, 5, std::less<>> var{
+            {MockAComparableToB{1}, 10}, {MockAComparableToB{3}, 30}, {MockAComparableToB{5}, 50}};
+        auto removed_count = var.erase(MockBComparableToA{3});
+        assert_or_abort(removed_count == 1);
+        removed_count = var.erase(MockBComparableToA{4});
+        assert_or_abort(removed_count == 0);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(!VAL1.contains(MockBComparableToA{3}));
+    static_assert(VAL1.contains(MockBComparableToA{5}));
+}
+
 TEST(FixedMap, EraseIterator)
 {
     constexpr auto VAL1 = []()
@@ -761,6 +884,263 @@ TEST(FixedMap, EraseIf)
     static_assert(VAL1.at(3) == 30);
 }
 
+TEST(FixedMap, ExtractAndInsertNode)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var1{{2, 20}, {3, 30}, {4, 40}};
+        FixedMap<int, int, 3> var2{{3, 31}};
+
+        auto node = var1.extract(2);
+        assert_or_abort(!node.empty() && node.key() == 2 && node.mapped() == 20);
+        auto result = var2.insert(std::move(node));
+        assert_or_abort(result.inserted && result.position->first == 2 && result.node.empty());
+        assert_or_abort(node.empty());
+
+        // The key is already present: the handle gets the entry back
+        result = var2.insert(var1.extract(var1.find(3)));
+        assert_or_abort(!result.inserted && result.position->second == 31);
+        assert_or_abort(result.node.key() == 3 && result.node.mapped() == 30);
+
+        assert_or_abort(var1.extract(5).empty());
+        assert_or_abort(!var2.insert(var1.extract(5)).inserted);
+        return std::pair{var1, var2};
+    }();
+
+    static_assert(VAL1.first.size() == 1);
+    static_assert(VAL1.first.at(4) == 40);
+    static_assert(VAL1.second.size() == 2);
+    static_assert(VAL1.second.at(2) == 20);
+    static_assert(VAL1.second.at(3) == 31);
+
+    {
+        FixedMap<int, MockMoveableButNotCopyable, 5> var1{};
+        var1.emplace(1, MockMoveableButNotCopyable{});
+        FixedMap<int, MockMoveableButNotCopyable, 5> var2{};
+        var2.insert(var2.cend(), var1.extract(var1.begin()));
+        EXPECT_TRUE(var1.empty());
+        EXPECT_TRUE(var2.contains(1));
+    }
+    {
+        FixedMap<int, int, 1> var1{{1, 10}};
+        FixedMap<int, int, 1> var2{{2, 20}};
+        EXPECT_DEATH(var2.insert(var1.extract(1)), "");
+    }
+}
+
+TEST(FixedMap, Merge)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 5> var1{{1, 10}, {3, 30}};
+        FixedMap<int, int, 10> var2{{1, 11}, {2, 21}, {4, 41}, {5, 51}};
+        var1.merge(var2);
+        return std::pair{var1, var2};
+    }();
+
+    static_assert(VAL1.first.size() == 5);
+    static_assert(VAL1.first.at(1) == 10);
+    static_assert(VAL1.first.at(2) == 21);
+    static_assert(VAL1.first.at(5) == 51);
+    static_assert(VAL1.second.size() == 1);
+    static_assert(VAL1.second.at(1) == 11);
+
+    {
+        FixedMap<int, int, 10> var1{{1, 10}};
+        var1.merge(var1);
+        var1.merge(FixedMap<int, int, 3>{{2, 20}});
+        EXPECT_EQ((FixedMap<int, int, 10>{{1, 10}, {2, 20}}), var1);
+    }
+    {
+        FixedMap<int, int, 2> var1{{1, 10}};
+        FixedMap<int, int, 3> var2{{2, 20}, {3, 30}};
+        EXPECT_DEATH(var1.merge(var2), "");
+    }
+}
+
+TEST(FixedMap, EraseBeforeAndAfter)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var{{1, 10}, {2, 20}, {3, 30}, {4, 40}, {5, 50}, {7, 70}};
+        assert_or_abort(var.erase_before(3) == 2);
+        assert_or_abort(var.erase_before(3) == 0);
+        assert_or_abort(var.erase_after(6) == 1);
+        assert_or_abort(var.erase_after(4) == 1);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.at(3) == 30);
+    static_assert(VAL1.at(4) == 40);
+
+    {
+        FixedMap<int, int, 30> var{};
+        for (int i = 0; i < 20; i++)
+        {
+            var.try_emplace(i, i * 10);
+        }
+        EXPECT_EQ(0, var.erase_before(-1));
+        EXPECT_EQ(0, var.erase_after(25));
+        EXPECT_EQ(5, var.erase_before(5));
+        EXPECT_EQ(4, var.erase_after(15));
+        EXPECT_EQ(11, var.size());
+        EXPECT_EQ(5, var.begin()->first);
+        EXPECT_EQ(150, std::prev(var.end())->second);
+        EXPECT_EQ(11, var.erase_after(0));
+        EXPECT_TRUE(var.empty());
+    }
+    {
+        FixedMap<MockAComparableToB, int, 5, std::less<>> var{
+            {MockAComparableToB{1}, 10}, {MockAComparableToB{3}, 30}, {MockAComparableToB{5}, 50}};
+        EXPECT_EQ(1, var.erase_before(MockBComparableToA{2}));
+        EXPECT_EQ(1, var.erase_after(MockBComparableToA{4}));
+        EXPECT_EQ(1, var.size());
+        EXPECT_TRUE(var.contains(MockBComparableToA{3}));
+    }
+}
+
+namespace
+{
+template <class Container, class Other>
+concept CanJoin = requires(Container container, Other other) { container.join(other); };
+
+// Joining takes the other container in its own order, so both must use the same comparator
+static_assert(CanJoin<FixedMap<int, int, 10>, FixedMap<int, int, 100>>);
+static_assert(!CanJoin<FixedMap<int, int, 10>, FixedMap<int, int, 10, std::greater<int>>>);
+}  // namespace
+
+TEST(FixedMap, SplitAndJoin)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var1{{1, 10}, {2, 20}, {3, 30}, {5, 50}};
+        FixedMap<int, int, 10> var2 = var1.split(3);
+        return std::pair{var1, var2};
+    }();
+
+    static_assert(VAL1.first.size() == 2);
+    static_assert(VAL1.first.contains(1));
+    static_assert(VAL1.first.contains(2));
+    static_assert(VAL1.second.size() == 2);
+    static_assert(VAL1.second.at(3) == 30);
+    static_assert(VAL1.second.at(5) == 50);
+
+    constexpr auto VAL2 = []()
+    {
+        FixedMap<int, int, 10> var1{{1, 10}, {2, 20}, {3, 30}, {5, 50}};
+        auto var2 = var1.split(3);
+        var1.join(var2);
+        assert_or_abort(var2.empty());
+        FixedMap<int, int, 3> var3{{-2, -20}, {0, 0}};
+        var1.join(var3);
+        return var1;
+    }();
+
+    static_assert(consteval_compare::equal<6, VAL2.size()>);
+    static_assert(VAL2.begin()->first == -2);
+    static_assert(std::prev(VAL2.end())->first == 5);
+
+    {
+        FixedMap<int, int, 50> var1{};
+        for (int i = 0; i < 40; i++)
+        {
+            var1.try_emplace(i, i * 10);
+        }
+        auto var2 = var1.split(25);
+        EXPECT_EQ(25, var1.size());
+        EXPECT_EQ(15, var2.size());
+        EXPECT_EQ(24, std::prev(var1.end())->first);
+        EXPECT_EQ(25, var2.begin()->first);
+        EXPECT_TRUE(var1.split(100).empty());
+        EXPECT_EQ(25, var1.size());
+
+        var2.join(var1);
+        EXPECT_TRUE(var1.empty());
+        EXPECT_EQ(40, var2.size());
+        int expected_key = 0;
+        for (const auto& [key, value] : var2)
+        {
+            EXPECT_EQ(expected_key, key);
+            EXPECT_EQ(expected_key * 10, value);
+            expected_key++;
+        }
+    }
+    {
+        FixedMap<int, int, 10> var1{{1, 10}, {3, 30}};
+        FixedMap<int, int, 10> var2{{2, 20}};
+        EXPECT_DEATH(var1.join(var2), "");
+    }
+    {
+        FixedMap<int, int, 2> var1{{1, 10}};
+        EXPECT_DEATH(var1.join(FixedMap<int, int, 3>{{2, 20}, {3, 30}}), "");
+    }
+}
+
+TEST(FixedMap, SetAlgebra)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedMap<int, int, 10> var1{{1, 10}, {2, 20}, {3, 30}};
+        const FixedMap<int, int, 5> var2{{2, 21}, {4, 41}};
+        var1.set_union(var2);
+        return var1;
+    }();
+    static_assert(VAL1.size() == 4);
+    static_assert(VAL1.at(2) == 20);
+    static_assert(VAL1.at(4) == 41);
+
+    // The other map is only looked at for its keys
+    constexpr auto VAL2 = []()
+    {
+        FixedMap<int, int, 10> var1{{1, 10}, {2, 20}, {3, 30}};
+        var1.set_intersection(FixedMap<int, bool, 5>{{2, true}, {3, false}, {4, true}});
+        return var1;
+    }();
+    static_assert(VAL2.size() == 2);
+    static_assert(VAL2.at(2) == 20);
+    static_assert(VAL2.at(3) == 30);
+
+    constexpr auto VAL3 = []()
+    {
+        FixedMap<int, int, 10> var1{{1, 10}, {2, 20}, {3, 30}};
+        var1.set_difference(FixedMap<int, bool, 5>{{2, true}, {4, true}});
+        return var1;
+    }();
+    static_assert(VAL3.size() == 2);
+    static_assert(VAL3.at(1) == 10);
+    static_assert(VAL3.at(3) == 30);
+
+    static_assert(VAL1.includes(VAL2));
+    static_assert(!VAL3.includes(VAL2));
+    static_assert(VAL1.includes(FixedMap<int, bool, 5>{{4, false}}));
+
+    {
+        FixedMap<int, int, 50> var1{};
+        FixedMap<int, int, 50> var2{};
+        for (int i = 0; i < 40; i++)
+        {
+            var1.try_emplace(i, i);
+            var2.try_emplace(i + 5, i * 10);
+        }
+        var1.set_intersection(var2);
+        EXPECT_EQ(35, var1.size());
+        EXPECT_EQ(5, var1.begin()->first);
+        EXPECT_EQ(5, var1.begin()->second);
+        EXPECT_TRUE(var2.includes(var1));
+        var2.set_difference(var1);
+        EXPECT_EQ(5, var2.size());
+        EXPECT_EQ(40, var2.begin()->first);
+        var1.set_union(var2);
+        EXPECT_EQ(40, var1.size());
+        EXPECT_EQ(390, std::prev(var1.end())->second);
+    }
+    {
+        FixedMap<int, int, 3> var1{{1, 10}, {2, 20}};
+        EXPECT_DEATH(var1.set_union(FixedMap<int, int, 3>{{3, 30}, {4, 40}}), "");
+    }
+}
+
 TEST(FixedMap, IteratorStructuredBinding)
 {
     constexpr auto VAL1 = []()
@@ -1372,6 +1752,207 @@ TEST(FixedMap, EqualRangeTransparentComparator)
     static_assert(VAL.equal_range(KEY_B).second == VAL.upper_bound(KEY_B));
 }
 
+namespace
+{
+template <class K, class V, std::size_t MAXIMUM_SIZE, class Compare = std::less<K>>
+using OrderStatisticMap =
+    FixedMap<K,
+             V,
+             MAXIMUM_SIZE,
+             Compare,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedPoolStorage,
+             customize::MapAbortChecking<K, V, MAXIMUM_SIZE>,
+             OrderStatisticTreeAugmentation>;
+}  // namespace
+
+TEST(FixedMap, OrderStatistics)
+{
+    constexpr auto VAL1 = []()
+    {
+        OrderStatisticMap<int, int, 10> var{};
+        for (int i = 0; i < 10; i++)
+        {
+            var[i * 10] = i;
+        }
+        var.erase(30);
+        return var;
+    }();
+    static_assert(VAL1.nth(0)->first == 0);
+    static_assert(VAL1.nth(3)->first == 40);
+    static_assert(VAL1.nth(9) == VAL1.end());
+    static_assert(VAL1.rank(40) == 3);
+    static_assert(VAL1.rank(45) == 4);
+    static_assert(VAL1.rank(-1) == 0);
+    static_assert(VAL1.rank(1000) == 9);
+    static_assert(VAL1.count_in_range(10, 60) == 4);
+    static_assert(VAL1.count_in_range(60, 10) == 0);
+    static_assert(VAL1.count_in_range(20, 20) == 0);
+    static_assert(IsStructuralType<decltype(VAL1)>);
+
+    // Same as walking from begin()
+    OrderStatisticMap<int, int, 50> var2{};
+    for (int i = 0; i < 50; i++)
+    {
+        var2[(i * 17) % 50] = i;
+    }
+    erase_if(var2, [](const auto& entry) { return entry.first % 3 == 0; });
+    for (std::size_t i = 0; i < var2.size(); i++)
+    {
+        const auto it = std::next(var2.begin(), static_cast<std::ptrdiff_t>(i));
+        EXPECT_EQ(it, var2.nth(i));
+        EXPECT_EQ(i, var2.rank(it->first));
+    }
+    EXPECT_EQ(var2.end(), var2.nth(var2.size()));
+    EXPECT_EQ(std::distance(var2.lower_bound(10), var2.lower_bound(40)),
+              var2.count_in_range(10, 40));
+
+    var2.nth(2)->second = 100;
+    EXPECT_EQ(100, var2.at(4));
+}
+
+TEST(FixedMap, OrderStatisticsTransparentComparator)
+{
+    constexpr OrderStatisticMap<MockAComparableToB, int, 5, std::less<>> VAL{
+        {MockAComparableToB{1}, 10}, {MockAComparableToB{3}, 30}, {MockAComparableToB{5}, 50}};
+    static_assert(VAL.rank(MockBComparableToA{3}) == 1);
+    static_assert(VAL.count_in_range(MockBComparableToA{2}, MockBComparableToA{6}) == 2);
+}
+
+namespace
+{
+struct SumOfValues
+{
+    using value_type = int;
+    static constexpr value_type identity() { return 0; }
+    static constexpr value_type lift(const int& /*key*/, const int& value) { return value; }
+    static constexpr value_type combine(const value_type& left, const value_type& right)
+    {
+        return left + right;
+    }
+};
+
+// For intervals [start, end) keyed by their start
+struct LargestEnd
+{
+    using value_type = int;
+    static constexpr value_type identity() { return std::numeric_limits<int>::min(); }
+    static constexpr value_type lift(const int& /*start*/, const int& end) { return end; }
+    static constexpr value_type combine(const value_type& left, const value_type& right)
+    {
+        return std::max(left, right);
+    }
+};
+
+template <class Policy>
+using AggregateMap =
+    FixedMap<int,
+             int,
+             50,
+             std::less<int>,
+             fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+             FixedIndexBasedPoolStorage,
+             customize::MapAbortChecking<int, int, 50>,
+             Policy>;
+}  // namespace
+
+TEST(FixedMap, Aggregates)
+{
+    constexpr auto VAL1 = []()
+    {
+        AggregateMap<SumOfValues> var{};
+        for (int i = 0; i < 10; i++)
+        {
+            var.try_emplace(i, i * 10);
+        }
+        var.erase(5);
+        return var;
+    }();
+    static_assert(VAL1.aggregate() == 400);
+    static_assert(VAL1.aggregate_in_range(2, 7) == 150);
+    static_assert(VAL1.aggregate_in_range(7, 2) == 0);
+    static_assert(VAL1.aggregate_in_range(5, 6) == 0);
+    static_assert(VAL1.aggregate_before(3) == 30);
+    static_assert(VAL1.aggregate_before(100) == 400);
+
+    constexpr auto VAL2 = []()
+    {
+        AggregateMap<SumOfValues> var{{1, 10}, {2, 20}};
+        var.modify(var.find(2), [](int& value) { value = 5; });
+        return var;
+    }();
+    static_assert(VAL2.aggregate() == 15);
+    static_assert(VAL2.at(2) == 5);
+
+    AggregateMap<SumOfValues> var2{};
+    for (int i = 0; i < 50; i++)
+    {
+        var2.insert({i, i});
+    }
+    EXPECT_EQ(1225, var2.aggregate());
+    var2.insert_or_assign(10, 1000);
+    EXPECT_EQ(2215, var2.aggregate());
+
+    // The aggregate depends on the values, so they only change through `modify()`
+    static_assert(std::is_same_v<const int&, decltype(var2[20])>);
+    static_assert(std::is_same_v<const int&, decltype(var2.at(20))>);
+    static_assert(std::is_same_v<const int&, decltype(var2.begin()->second)>);
+    static_assert(std::is_same_v<int&, decltype(FixedMap<int, int, 5>{}[0])>);
+    var2.modify(var2.find(20), [](int& value) { value = 0; });
+    EXPECT_EQ(2195, var2.aggregate());
+    var2.modify(var2.find(21), [](int& value) { value = 1; });
+    EXPECT_EQ(2175, var2.aggregate());
+    var2.modify(var2.find(30), [](int& value) { value += 5; });
+    EXPECT_EQ(2180, var2.aggregate());
+    EXPECT_EQ(35, var2.at(30));
+    var2.update_aggregate(var2.find(30));
+    EXPECT_EQ(2180, var2.aggregate());
+    EXPECT_DEATH(var2.modify(var2.end(), [](int& value) { value = 0; }), "");
+    EXPECT_DEATH(var2.update_aggregate(var2.end()), "");
+
+    int expected = 0;
+    for (auto it = var2.lower_bound(15); it != var2.lower_bound(35); ++it)
+    {
+        expected += it->second;
+    }
+    EXPECT_EQ(expected, var2.aggregate_in_range(15, 35));
+}
+
+TEST(FixedMap, IntervalOverlapQueries)
+{
+    AggregateMap<LargestEnd> intervals{};
+    intervals.try_emplace(0, 10);
+    intervals.try_emplace(1, 3);
+    intervals.try_emplace(4, 6);
+    intervals.try_emplace(12, 15);
+    intervals.try_emplace(20, 40);
+    intervals.try_emplace(25, 26);
+
+    // Starts of the intervals that overlap [from, to)
+    const auto overlapping = [&intervals](const int from, const int to)
+    {
+        const auto ends_after_from = [from](const int end) { return end > from; };
+        std::vector<int> out{};
+        for (auto it = intervals.find_first_by_aggregate(intervals.begin(), ends_after_from);
+             it != intervals.end() && it->first < to;
+             it = intervals.find_first_by_aggregate(std::next(it), ends_after_from))
+        {
+            out.push_back(it->first);
+        }
+        return out;
+    };
+    EXPECT_EQ((std::vector<int>{0, 4}), overlapping(5, 8));
+    EXPECT_EQ((std::vector<int>{0, 1}), overlapping(2, 3));
+    EXPECT_EQ((std::vector<int>{12}), overlapping(11, 13));
+    EXPECT_EQ((std::vector<int>{20}), overlapping(30, 50));
+    EXPECT_EQ((std::vector<int>{}), overlapping(16, 19));
+    EXPECT_EQ((std::vector<int>{0, 1, 4, 12, 20, 25}), overlapping(-5, 100));
+
+    intervals.erase(20);
+    EXPECT_EQ((std::vector<int>{}), overlapping(30, 50));
+    EXPECT_EQ(26, intervals.aggregate());
+}
+
 TEST(FixedMap, Equality)
 {
     {
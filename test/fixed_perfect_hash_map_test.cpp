@@ -0,0 +1,224 @@
+#include "fixed_containers/fixed_perfect_hash_map.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedPerfectHashMap<int, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+
+static_assert(std::forward_iterator<ES_1::iterator>);
+static_assert(std::forward_iterator<ES_1::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, std::pair<const int&, int&>>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::const_iterator>,
+                             std::pair<const int&, const int&>>);
+
+// Two keys per pilot
+static_assert(sizeof(ES_1::PilotType) == 2);
+static_assert(std::tuple_size_v<decltype(ES_1{}.IMPLEMENTATION_DETAIL_DO_NOT_USE_pilots_)> == 5);
+
+template <std::size_t KEY_COUNT>
+constexpr auto make_spread_out_pairs()
+{
+    std::array<std::pair<std::uint64_t, std::size_t>, KEY_COUNT> pairs{};
+    for (std::size_t i = 0; i < KEY_COUNT; i++)
+    {
+        pairs[i] = {(i * 0x9E3779B97F4A7C15ULL) >> 16U, i};
+    }
+    return pairs;
+}
+}  // namespace
+
+TEST(FixedPerfectHashMap, DefaultConstructor)
+{
+    constexpr ES_1 VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(!VAL1.contains(0));
+    static_assert(VAL1.find(0) == VAL1.cend());
+    static_assert(VAL1.begin() == VAL1.end());
+}
+
+TEST(FixedPerfectHashMap, Initializer)
+{
+    constexpr FixedPerfectHashMap<int, int, 10> VAL1{{2, 20}, {4, 40}};
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.max_size() == 10);
+
+    constexpr auto VAL2 = make_fixed_perfect_hash_map<int, int>({{1, 10}, {3, 30}, {5, 50}});
+    static_assert(VAL2.size() == 3);
+    static_assert(VAL2.max_size() == 3);
+    static_assert(VAL2.at(3) == 30);
+}
+
+TEST(FixedPerfectHashMap, Lookup)
+{
+    constexpr auto VAL1 =
+        make_fixed_perfect_hash_map<int, int>({{1, 10}, {3, 30}, {5, 50}, {7, 70}, {9, 90}});
+
+    static_assert(VAL1.at(1) == 10);
+    static_assert(VAL1.at(9) == 90);
+    static_assert(VAL1.contains(5));
+    static_assert(!VAL1.contains(4));
+    static_assert(VAL1.count(7) == 1);
+    static_assert(VAL1.count(8) == 0);
+    static_assert(VAL1.find(3)->first == 3);
+    static_assert(VAL1.find(3)->second == 30);
+    static_assert(VAL1.find(4) == VAL1.cend());
+    static_assert(std::distance(VAL1.equal_range(5).first, VAL1.equal_range(5).second) == 1);
+    static_assert(VAL1.equal_range(6).first == VAL1.cend());
+    static_assert(VAL1.equal_range(6).second == VAL1.cend());
+
+    for (int i = 0; i < 20; i++)
+    {
+        EXPECT_EQ(i % 2 == 1 && i < 10, VAL1.contains(i));
+    }
+}
+
+TEST(FixedPerfectHashMap, ModifyValues)
+{
+    constexpr auto VAL1 = []()
+    {
+        auto var = make_fixed_perfect_hash_map<int, int>({{1, 10}, {3, 30}, {5, 50}});
+        var.at(1) = 11;
+        var.find(3)->second = 33;
+        for (auto&& [key, value] : var)
+        {
+            value++;
+        }
+        return var;
+    }();
+    static_assert(VAL1.at(1) == 12);
+    static_assert(VAL1.at(3) == 34);
+    static_assert(VAL1.at(5) == 51);
+}
+
+TEST(FixedPerfectHashMap, DuplicateKeys)
+{
+    // The first occurrence wins, like `insert()`
+    constexpr FixedPerfectHashMap<int, int, 10> VAL1{{1, 10}, {2, 20}, {1, 11}, {3, 30}, {2, 22}};
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1.at(1) == 10);
+    static_assert(VAL1.at(2) == 20);
+    static_assert(VAL1.at(3) == 30);
+}
+
+TEST(FixedPerfectHashMap, Iteration)
+{
+    constexpr auto VAL1 =
+        make_fixed_perfect_hash_map<int, int>({{1, 10}, {3, 30}, {5, 50}, {7, 70}});
+    static_assert(std::distance(VAL1.cbegin(), VAL1.cend()) == 4);
+
+    int key_sum = 0;
+    for (const auto& [key, value] : VAL1)
+    {
+        EXPECT_EQ(key * 10, value);
+        // Every entry sits in the slot its key hashes to
+        EXPECT_EQ(VAL1.find(key)->first, key);
+        key_sum += key;
+    }
+    EXPECT_EQ(16, key_sum);
+}
+
+TEST(FixedPerfectHashMap, ManyKeysAtCompileTime)
+{
+    static constexpr std::size_t KEY_COUNT = 300;
+    static constexpr auto PAIRS = make_spread_out_pairs<KEY_COUNT>();
+    static constexpr FixedPerfectHashMap<std::uint64_t, std::size_t, KEY_COUNT> VAL1{PAIRS.begin(),
+                                                                                  PAIRS.end()};
+    static_assert(consteval_compare::equal<KEY_COUNT, VAL1.size()>);
+    static_assert(VAL1.at(PAIRS[0].first) == 0);
+    static_assert(VAL1.at(PAIRS[KEY_COUNT - 1].first) == KEY_COUNT - 1);
+    static_assert(!VAL1.contains(PAIRS[7].first + 1));
+
+    for (const auto& [key, value] : PAIRS)
+    {
+        ASSERT_TRUE(VAL1.contains(key));
+        EXPECT_EQ(value, VAL1.at(key));
+        EXPECT_FALSE(VAL1.contains(key + 1));
+    }
+}
+
+TEST(FixedPerfectHashMap, ManyKeysAtRunTime)
+{
+    static constexpr std::size_t KEY_COUNT = 5000;
+    static const auto PAIRS = make_spread_out_pairs<KEY_COUNT>();
+    static const FixedPerfectHashMap<std::uint64_t, std::size_t, KEY_COUNT> VAL1{PAIRS.begin(),
+                                                                              PAIRS.end()};
+    EXPECT_EQ(KEY_COUNT, VAL1.size());
+    for (const auto& [key, value] : PAIRS)
+    {
+        ASSERT_TRUE(VAL1.contains(key));
+        EXPECT_EQ(value, VAL1.at(key));
+    }
+    EXPECT_EQ(KEY_COUNT, static_cast<std::size_t>(std::ranges::distance(VAL1)));
+}
+
+TEST(FixedPerfectHashMap, TransparentLookup)
+{
+    using MapType = FixedPerfectHashMap<std::string_view,
+                                        int,
+                                        4,
+                                        wyhash::hash<std::string_view>,
+                                        std::equal_to<>>;
+    constexpr MapType VAL1{{"alpha", 1}, {"beta", 2}, {"gamma", 3}};
+    static_assert(2 == VAL1.at("beta"));
+
+    static constexpr std::array<char, 5> CHARS{'g', 'a', 'm', 'm', 'a'};
+    const std::string_view key{CHARS.data(), CHARS.size()};
+    EXPECT_EQ(3, VAL1.find(key)->second);
+    static_assert(VAL1.contains("alpha"));
+    static_assert(!VAL1.contains("delta"));
+}
+
+TEST(FixedPerfectHashMap, Equality)
+{
+    constexpr auto VAL1 = make_fixed_perfect_hash_map<int, int>({{1, 10}, {3, 30}});
+    constexpr FixedPerfectHashMap<int, int, 10> VAL2{{3, 30}, {1, 10}};
+    constexpr FixedPerfectHashMap<int, int, 10> VAL3{{3, 30}, {1, 11}};
+    static_assert(VAL1 == VAL2);
+    static_assert(VAL2 != VAL3);
+    static_assert(VAL1 != FixedPerfectHashMap<int, int, 10>{});
+}
+
+namespace
+{
+template <FixedPerfectHashMap<int, int, 5> /*INSTANCE*/>
+struct FixedPerfectHashMapInstanceCanBeUsedAsATemplateParameter
+{
+};
+
+template <FixedPerfectHashMap<int, int, 5> INSTANCE>
+constexpr int value_from_template_parameter(int key)
+{
+    return INSTANCE.at(key);
+}
+}  // namespace
+
+TEST(FixedPerfectHashMap, UsageAsTemplateParameter)
+{
+    static constexpr FixedPerfectHashMap<int, int, 5> INSTANCE1{{1, 10}, {2, 20}};
+    static_assert(value_from_template_parameter<INSTANCE1>(2) == 20);
+    const FixedPerfectHashMapInstanceCanBeUsedAsATemplateParameter<INSTANCE1> my_struct{};
+    static_cast<void>(my_struct);
+}
+
+}  // namespace fixed_containers
@@ -14,12 +14,19 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
+#include <iterator>
+#include <numeric>
 #include <queue>
 #include <random>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace fixed_containers::fixed_red_black_tree_detail
 {
@@ -28,7 +35,16 @@ namespace
 static_assert(IsStructuralType<FixedIndexBasedPoolStorage<int, 5>>);
 static_assert(IsStructuralType<FixedIndexBasedContiguousStorage<int, 5>>);
 
-static_assert(IsStructuralType<NodeIndexWithColorEmbeddedInTheMostSignificantBit>);
+static_assert(IsStructuralType<NodeIndexWithColorEmbeddedInTheMostSignificantBit<>>);
+static_assert(IsStructuralType<NodeIndexWithColorEmbeddedInTheMostSignificantBit<std::uint8_t>>);
+
+static_assert(std::is_same_v<NodeIndexStorage<1>, std::uint8_t>);
+static_assert(std::is_same_v<NodeIndexStorage<127>, std::uint8_t>);
+static_assert(std::is_same_v<NodeIndexStorage<128>, std::uint16_t>);
+static_assert(std::is_same_v<NodeIndexStorage<32767>, std::uint16_t>);
+static_assert(std::is_same_v<NodeIndexStorage<32768>, std::uint32_t>);
+static_assert(sizeof(CompactRedBlackTreeNode<int, int, NodeIndexStorage<100>>) == 12);
+static_assert(sizeof(DefaultRedBlackTreeNode<int, int, NodeIndexStorage<100>>) == 12);
 
 static_assert(IsRedBlackTreeNode<DefaultRedBlackTreeNode<int, EmptyValue>>);
 static_assert(IsRedBlackTreeNodeWithValue<DefaultRedBlackTreeNode<int, double>>);
@@ -306,6 +322,39 @@ TEST(NodeIndexWithColorEmbeddedInTheMostSignificantBit, Basic)
     }
 }
 
+TEST(NodeIndexWithColorEmbeddedInTheMostSignificantBit, NarrowIndex)
+{
+    using IndexWithColor = NodeIndexWithColorEmbeddedInTheMostSignificantBit<std::uint8_t>;
+    static_assert(sizeof(IndexWithColor) == 1);
+
+    static constexpr IndexWithColor DEFAULT_VALUE{};
+    static_assert(consteval_compare::equal<NULL_INDEX, DEFAULT_VALUE.get_index()>);
+    static_assert(consteval_compare::equal<COLOR_BLACK, DEFAULT_VALUE.get_color()>);
+
+    constexpr auto SET_VALUE_WITH_RED = []()
+    {
+        IndexWithColor ret{};
+        ret.set_index(126);
+        ret.set_color(COLOR_RED);
+        return ret;
+    }();
+    static_assert(consteval_compare::equal<126, SET_VALUE_WITH_RED.get_index()>);
+    static_assert(consteval_compare::equal<COLOR_RED, SET_VALUE_WITH_RED.get_color()>);
+
+    constexpr auto SET_NULL_WITH_RED = []()
+    {
+        IndexWithColor ret{};
+        ret.set_color(COLOR_RED);
+        ret.set_index(NULL_INDEX);
+        return ret;
+    }();
+    static_assert(consteval_compare::equal<NULL_INDEX, SET_NULL_WITH_RED.get_index()>);
+    static_assert(consteval_compare::equal<COLOR_RED, SET_NULL_WITH_RED.get_color()>);
+
+    IndexWithColor ret{};
+    EXPECT_DEATH(ret.set_index(128), "");
+}
+
 TEST(DefaultRedBlackTreeNode, Construction)
 {
     // Without Value
@@ -1591,6 +1640,47 @@ TEST(FixedRedBlackTree, IndexOfMax)
     ASSERT_EQ(3, bst.node_at(bst.index_of_max_at()).key());
 }
 
+namespace
+{
+template <template <typename, std::size_t> typename StorageTemplate>
+void tracked_max_test_helper()
+{
+    using TreeType = FixedRedBlackTree<int,
+                                       int,
+                                       32,
+                                       std::less<int>,
+                                       RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                       StorageTemplate>;
+    TreeType tree{};
+    std::mt19937 rng(12345);
+    for (int i = 0; i < 2000; i++)
+    {
+        // Mostly appends, with deletions of the maximum and elsewhere
+        const int key = static_cast<int>(rng() % 48);
+        if (tree.contains_node(key))
+        {
+            tree.delete_node(key);
+        }
+        else if (!tree.full())
+        {
+            tree[key] = key;
+        }
+        ASSERT_EQ(tree.index_of_max_at(tree.root_index()), tree.index_of_max_at());
+    }
+
+    const TreeType copy{tree};
+    ASSERT_EQ(tree.index_of_max_at(), copy.index_of_max_at());
+    tree.clear();
+    ASSERT_EQ(NULL_INDEX, tree.index_of_max_at());
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, TrackedMax)
+{
+    tracked_max_test_helper<FixedIndexBasedPoolStorage>();
+    tracked_max_test_helper<FixedIndexBasedContiguousStorage>();
+}
+
 TEST(FixedRedBlackTree, IndexOfSuccessor)
 {
     FixedRedBlackTree<int, int, 20> bst{};
@@ -1832,6 +1922,939 @@ TEST(FixedRedBlackTree, RandomizedConsistencyTest)
     }
 }
 
+namespace
+{
+struct CountingLess
+{
+    static inline int call_count = 0;
+
+    bool operator()(const int& left, const int& right) const
+    {
+        call_count++;
+        return left < right;
+    }
+};
+
+template <typename TreeType>
+void expect_same_structure(const TreeType& expected, const TreeType& actual)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    ASSERT_EQ(expected.root_index(), actual.root_index());
+    for (NodeIndex i = expected.index_of_min_at(); i != NULL_INDEX;
+         i = expected.index_of_successor_at(i))
+    {
+        const auto expected_node = expected.node_at(i);
+        const auto actual_node = actual.node_at(i);
+        ASSERT_EQ(expected_node.key(), actual_node.key());
+        ASSERT_EQ(expected_node.value(), actual_node.value());
+        ASSERT_EQ(expected_node.parent_index(), actual_node.parent_index());
+        ASSERT_EQ(expected_node.left_index(), actual_node.left_index());
+        ASSERT_EQ(expected_node.right_index(), actual_node.right_index());
+        ASSERT_EQ(expected_node.color(), actual_node.color());
+    }
+}
+
+template <template <typename, std::size_t> typename StorageTemplate>
+void clone_test_helper()
+{
+    using TreeType = FixedRedBlackTree<int,
+                                       MockNonTrivialInt,
+                                       64,
+                                       CountingLess,
+                                       RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                       StorageTemplate>;
+    static_assert(!TriviallyCopyConstructible<TreeType>);
+
+    TreeType tree{};
+    for (int i = 0; i < 64; i++)
+    {
+        tree[(i * 37) % 64] = MockNonTrivialInt{i};
+    }
+    // Leave holes in the storage
+    for (int i = 0; i < 64; i += 3)
+    {
+        tree.delete_node(i);
+    }
+
+    CountingLess::call_count = 0;
+    const TreeType copy{tree};
+    EXPECT_EQ(0, CountingLess::call_count);
+    expect_same_structure(tree, copy);
+
+    TreeType assigned{};
+    assigned[1000] = MockNonTrivialInt{1000};
+    CountingLess::call_count = 0;
+    assigned = copy;
+    EXPECT_EQ(0, CountingLess::call_count);
+    expect_same_structure(tree, assigned);
+
+    TreeType moved{std::move(assigned)};
+    EXPECT_EQ(0, CountingLess::call_count);
+    expect_same_structure(tree, moved);
+    EXPECT_TRUE(assigned.empty());  // NOLINT(bugprone-use-after-move)
+
+    TreeType move_assigned{};
+    move_assigned = std::move(moved);
+    EXPECT_EQ(0, CountingLess::call_count);
+    expect_same_structure(tree, move_assigned);
+
+    // The copy is a fully working tree
+    move_assigned[2000] = MockNonTrivialInt{2000};
+    move_assigned.delete_node(1);
+    EXPECT_EQ(tree.size(), move_assigned.size());
+    EXPECT_TRUE(move_assigned.contains_node(2000));
+    EXPECT_FALSE(move_assigned.contains_node(1));
+    EXPECT_LE(find_height(move_assigned), max_height_of_red_black_tree(move_assigned.size()));
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, CopyAndMovePreserveTheStructure)
+{
+    clone_test_helper<FixedIndexBasedPoolStorage>();
+    clone_test_helper<FixedIndexBasedContiguousStorage>();
+
+    constexpr auto VAL1 = []()
+    {
+        FixedRedBlackTree<int, MockNonTrivialInt, 10> tree{};
+        for (int i = 0; i < 10; i++)
+        {
+            tree[i].value = i * 10;
+        }
+        tree.delete_node(4);
+        tree.delete_node(7);
+        FixedRedBlackTree<int, MockNonTrivialInt, 10> copy{tree};
+        return copy;
+    }();
+    static_assert(VAL1.size() == 8);
+    static_assert(!VAL1.contains_node(4));
+    static_assert(VAL1.node_at(VAL1.index_of_node_or_null(9)).value().value == 90);
+}
+
+namespace
+{
+// Red nodes have black children and every path from the root down to a missing child has the
+// same number of black nodes
+template <class TreeType>
+bool satisfies_red_black_invariants(const TreeType& tree)
+{
+    std::size_t expected_black_count = 0;
+    for (NodeIndex i = tree.index_of_min_at(); i != NULL_INDEX; i = tree.index_of_successor_at(i))
+    {
+        const auto node = tree.node_at(i);
+        for (const NodeIndex child : {node.left_index(), node.right_index()})
+        {
+            if (child != NULL_INDEX)
+            {
+                if (node.color() == COLOR_RED && tree.node_at(child).color() == COLOR_RED)
+                {
+                    return false;
+                }
+                continue;
+            }
+            std::size_t black_count = 0;
+            for (NodeIndex j = i; j != NULL_INDEX; j = tree.node_at(j).parent_index())
+            {
+                black_count += tree.node_at(j).color() == COLOR_BLACK ? 1 : 0;
+            }
+            if (expected_black_count == 0)
+            {
+                expected_black_count = black_count;
+            }
+            if (black_count != expected_black_count)
+            {
+                return false;
+            }
+        }
+    }
+    return tree.root_index() == NULL_INDEX ||
+           tree.node_at(tree.root_index()).color() == COLOR_BLACK;
+}
+
+template <template <typename, std::size_t> typename StorageTemplate>
+void build_from_sorted_unique_test_helper()
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 70;
+    std::array<std::pair<int, int>, MAXIMUM_SIZE> entries{};
+    for (std::size_t i = 0; i < MAXIMUM_SIZE; i++)
+    {
+        entries[i] = {static_cast<int>(i) * 2, static_cast<int>(i)};
+    }
+
+    for (std::size_t count = 0; count <= MAXIMUM_SIZE; count++)
+    {
+        // One more slot for the insertion afterwards
+        using TreeType = FixedRedBlackTree<int,
+                                           int,
+                                           MAXIMUM_SIZE + 1,
+                                           CountingLess,
+                                           RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                           StorageTemplate>;
+        TreeType tree{};
+        // Leave the storage out of order
+        tree[5] = 5;
+        tree[1] = 1;
+        tree.delete_node(1);
+        tree.delete_node(5);
+
+        CountingLess::call_count = 0;
+        tree.build_from_sorted_unique(entries.begin(), entries.begin() + count, []() {});
+        EXPECT_EQ(0, CountingLess::call_count);
+        ASSERT_EQ(count, tree.size());
+        ASSERT_TRUE(satisfies_red_black_invariants(tree));
+        if (count > 0)
+        {
+            // Perfectly balanced
+            ASSERT_EQ(std::bit_width(count) - 1, find_height(tree));
+        }
+        std::size_t rank = 0;
+        for (NodeIndex i = tree.index_of_min_at(); i != NULL_INDEX;
+             i = tree.index_of_successor_at(i), rank++)
+        {
+            ASSERT_EQ(entries[rank].first, tree.node_at(i).key());
+            ASSERT_EQ(entries[rank].second, tree.node_at(i).value());
+        }
+        ASSERT_EQ(count, rank);
+
+        // Still a regular tree afterwards
+        tree[1] = 1;
+        ASSERT_TRUE(satisfies_red_black_invariants(tree));
+        ASSERT_EQ(count + 1, tree.size());
+        tree.delete_node(0);
+        tree.delete_node(1);
+        ASSERT_TRUE(satisfies_red_black_invariants(tree));
+        ASSERT_EQ(count == 0 ? 0 : count - 1, tree.size());
+    }
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, BuildFromSortedUnique)
+{
+    build_from_sorted_unique_test_helper<FixedIndexBasedPoolStorage>();
+    build_from_sorted_unique_test_helper<FixedIndexBasedContiguousStorage>();
+
+    constexpr auto VAL1 = []()
+    {
+        constexpr std::array<int, 5> KEYS{1, 3, 5, 7, 9};
+        FixedRedBlackTree<int, EmptyValue, 10> tree{};
+        tree.build_from_sorted_unique(KEYS.begin(), KEYS.end(), []() {});
+        return tree;
+    }();
+    static_assert(VAL1.size() == 5);
+    static_assert(VAL1.contains_node(7));
+    static_assert(VAL1.node_at(VAL1.root_index()).key() == 5);
+}
+
+namespace
+{
+// Checks the kept subtree sizes through the queries that use them, against an in-order walk
+template <class TreeType>
+bool has_consistent_order_statistics(const TreeType& tree)
+{
+    if (tree.root_index() != NULL_INDEX &&
+        tree.IMPLEMENTATION_DETAIL_DO_NOT_USE_subtree_data_[tree.root_index()] != tree.size())
+    {
+        return false;
+    }
+    std::size_t rank = 0;
+    for (NodeIndex i = tree.index_of_min_at(); i != NULL_INDEX;
+         i = tree.index_of_successor_at(i), rank++)
+    {
+        if (tree.index_of_nth(rank) != i || tree.rank_of(tree.node_at(i).key()) != rank)
+        {
+            return false;
+        }
+    }
+    return tree.index_of_nth(rank) == NULL_INDEX;
+}
+
+template <template <typename, std::size_t> typename StorageTemplate>
+void order_statistics_test_helper()
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 64;
+    using TreeType = FixedRedBlackTree<int,
+                                       MockNonTrivialInt,
+                                       MAXIMUM_SIZE,
+                                       std::less<int>,
+                                       RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                       StorageTemplate,
+                                       OrderStatisticTreeAugmentation>;
+
+    std::array<int, MAXIMUM_SIZE * 2> keys{};
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        keys[i] = static_cast<int>(i);
+    }
+    std::random_device rand_device;
+    std::mt19937 rng(rand_device());
+    TreeType tree{};
+    for (std::size_t iteration = 0; iteration < 10; iteration++)
+    {
+        std::shuffle(keys.begin(), keys.end(), rng);
+        for (std::size_t i = 0; i < keys.size(); i++)
+        {
+            // Insert until full, then alternate between deleting and inserting
+            if (tree.full() || (iteration % 2 == 1 && tree.contains_node(keys[i])))
+            {
+                tree.delete_node(keys[i]);
+            }
+            else
+            {
+                tree[keys[i]] = MockNonTrivialInt{keys[i]};
+            }
+            ASSERT_TRUE(has_consistent_order_statistics(tree));
+        }
+    }
+
+    // Keys that are not present
+    ASSERT_EQ(0, tree.rank_of(-1));
+    ASSERT_EQ(tree.size(), tree.rank_of(1000));
+
+    const TreeType copy{tree};
+    ASSERT_TRUE(has_consistent_order_statistics(copy));
+
+    tree.clear();
+    ASSERT_TRUE(has_consistent_order_statistics(tree));
+    std::array<std::pair<int, MockNonTrivialInt>, MAXIMUM_SIZE> entries{};
+    for (std::size_t i = 0; i < entries.size(); i++)
+    {
+        entries[i] = {static_cast<int>(i) * 2, MockNonTrivialInt{static_cast<int>(i)}};
+    }
+    tree.build_from_sorted_unique(entries.begin(), entries.end() - 5, []() {});
+    ASSERT_TRUE(has_consistent_order_statistics(tree));
+    ASSERT_EQ(20, tree.node_at(tree.index_of_nth(10)).key());
+    ASSERT_EQ(11, tree.rank_of(21));
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, OrderStatistics)
+{
+    // No cost without augmentation
+    static_assert(sizeof(FixedRedBlackTree<int, int, 10>) ==
+                  sizeof(FixedRedBlackTree<int,
+                                           int,
+                                           10,
+                                           std::less<int>,
+                                           RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                           FixedIndexBasedPoolStorage,
+                                           NoTreeAugmentation>));
+    using TreeType = FixedRedBlackTree<int,
+                                       int,
+                                       10,
+                                       std::less<int>,
+                                       RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                       FixedIndexBasedPoolStorage,
+                                       OrderStatisticTreeAugmentation>;
+    static_assert(TriviallyCopyable<TreeType>);
+    static_assert(IsStructuralType<TreeType>);
+    static_assert(sizeof(TreeType) >=
+                  sizeof(FixedRedBlackTree<int, int, 10>) + (10 * sizeof(std::uint8_t)));
+
+    order_statistics_test_helper<FixedIndexBasedPoolStorage>();
+    order_statistics_test_helper<FixedIndexBasedContiguousStorage>();
+
+    constexpr auto VAL1 = []()
+    {
+        TreeType tree{};
+        for (int i = 0; i < 10; i++)
+        {
+            tree[i * 10] = i;
+        }
+        tree.delete_node(30);
+        return tree;
+    }();
+    static_assert(VAL1.node_at(VAL1.index_of_nth(3)).key() == 40);
+    static_assert(VAL1.index_of_nth(9) == NULL_INDEX);
+    static_assert(VAL1.rank_of(45) == 4);
+}
+
+namespace
+{
+// Not commutative, so it also checks that the data is combined in key order
+struct KeySequenceHash
+{
+    struct value_type
+    {
+        std::uint64_t hash;
+        std::uint64_t power;
+    };
+
+    static constexpr value_type identity() { return {0, 1}; }
+    static constexpr value_type lift(const int& key, const int& value)
+    {
+        return {(static_cast<std::uint64_t>(key) * 1000) + static_cast<std::uint64_t>(value), 31};
+    }
+    static constexpr value_type combine(const value_type& left, const value_type& right)
+    {
+        return {(left.hash * right.power) + right.hash, left.power * right.power};
+    }
+};
+
+template <class TreeType>
+KeySequenceHash::value_type hash_of_range_by_walking(const TreeType& tree, int from, int to)
+{
+    KeySequenceHash::value_type result = KeySequenceHash::identity();
+    for (NodeIndex i = tree.index_of_min_at(); i != NULL_INDEX; i = tree.index_of_successor_at(i))
+    {
+        const auto node = tree.node_at(i);
+        if (node.key() >= from && node.key() < to)
+        {
+            result =
+                KeySequenceHash::combine(result, KeySequenceHash::lift(node.key(), node.value()));
+        }
+    }
+    return result;
+}
+
+template <class TreeType>
+bool has_consistent_aggregates(const TreeType& tree, int from, int to)
+{
+    const auto expected_all = hash_of_range_by_walking(tree, -1, 1000);
+    const auto expected_range = hash_of_range_by_walking(tree, from, to);
+    const auto expected_prefix = hash_of_range_by_walking(tree, -1, to);
+    const auto all = tree.aggregate_of_all();
+    const auto range = tree.aggregate_of_range(from, to);
+    const auto prefix = tree.aggregate_of_keys_less_than(to);
+    return all.hash == expected_all.hash && all.power == expected_all.power &&
+           range.hash == expected_range.hash && range.power == expected_range.power &&
+           prefix.hash == expected_prefix.hash && prefix.power == expected_prefix.power;
+}
+
+template <template <typename, std::size_t> typename StorageTemplate>
+void aggregate_test_helper()
+{
+    static constexpr std::size_t MAXIMUM_SIZE = 40;
+    using TreeType = FixedRedBlackTree<int,
+                                       int,
+                                       MAXIMUM_SIZE,
+                                       std::less<int>,
+                                       RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                       StorageTemplate,
+                                       KeySequenceHash>;
+
+    std::array<int, MAXIMUM_SIZE * 2> keys{};
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        keys[i] = static_cast<int>(i);
+    }
+    std::random_device rand_device;
+    std::mt19937 rng(rand_device());
+    std::uniform_int_distribution<int> bound_distribution(-1, static_cast<int>(keys.size()));
+    TreeType tree{};
+    for (std::size_t iteration = 0; iteration < 6; iteration++)
+    {
+        std::shuffle(keys.begin(), keys.end(), rng);
+        for (const int key : keys)
+        {
+            if (tree.full() || (iteration % 2 == 1 && tree.contains_node(key)))
+            {
+                tree.delete_node(key);
+            }
+            else
+            {
+                NodeIndexAndParentIndex np_idxs = tree.index_of_node_with_parent(key);
+                tree.insert_if_not_present_at(np_idxs, key, key % 7);
+            }
+            const int from = bound_distribution(rng);
+            const int to = bound_distribution(rng);
+            ASSERT_TRUE(has_consistent_aggregates(tree, from, to));
+        }
+    }
+
+    // Values changed in place
+    const NodeIndex index = tree.index_of_min_at();
+    tree.node_at(index).value() = 100;
+    tree.update_subtree_data_after_value_change_at(index);
+    ASSERT_TRUE(has_consistent_aggregates(tree, 0, 50));
+
+    const TreeType copy{tree};
+    ASSERT_TRUE(has_consistent_aggregates(copy, 10, 30));
+}
+
+struct MaxValue
+{
+    using value_type = int;
+    static constexpr value_type identity() { return -1; }
+    static constexpr value_type lift(const int& /*key*/, const int& value) { return value; }
+    static constexpr value_type combine(const value_type& left, const value_type& right)
+    {
+        return std::max(left, right);
+    }
+};
+}  // namespace
+
+TEST(FixedRedBlackTree, Aggregates)
+{
+    static_assert(TreeAggregatePolicy<KeySequenceHash, int, int>);
+    static_assert(!TreeAggregatePolicy<OrderStatisticTreeAugmentation, int, int>);
+
+    aggregate_test_helper<FixedIndexBasedPoolStorage>();
+    aggregate_test_helper<FixedIndexBasedContiguousStorage>();
+
+    using TreeType = FixedRedBlackTree<int,
+                                       int,
+                                       100,
+                                       std::less<int>,
+                                       RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                       FixedIndexBasedPoolStorage,
+                                       MaxValue>;
+    TreeType tree{};
+    for (int i = 0; i < 100; i++)
+    {
+        NodeIndexAndParentIndex np_idxs = tree.index_of_node_with_parent(i);
+        tree.insert_new_at(np_idxs, i, (i * 37) % 100);
+    }
+    // Same as walking the entries from each starting point
+    for (int threshold = -1; threshold < 100; threshold += 9)
+    {
+        const auto above_threshold = [threshold](int value) { return value > threshold; };
+        for (NodeIndex start = tree.index_of_min_at(); start != NULL_INDEX;
+             start = tree.index_of_successor_at(start))
+        {
+            NodeIndex expected = start;
+            while (expected != NULL_INDEX && tree.node_at(expected).value() <= threshold)
+            {
+                expected = tree.index_of_successor_at(expected);
+            }
+            ASSERT_EQ(expected, tree.index_of_first_matching_at_or_after(start, above_threshold));
+        }
+    }
+}
+
+namespace
+{
+template <template <typename, std::size_t> typename StorageTemplate>
+void insertion_near_hint_test_helper()
+{
+    using TreeType = FixedRedBlackTree<int,
+                                       int,
+                                       200,
+                                       CountingLess,
+                                       RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                       StorageTemplate,
+                                       OrderStatisticTreeAugmentation>;
+    TreeType tree{};
+
+    // Increasing keys before the end take a single call to `Compare` each
+    for (int i = 0; i < 100; i++)
+    {
+        CountingLess::call_count = 0;
+        NodeIndexAndParentIndex np_idxs = tree.index_of_node_with_parent_near(NULL_INDEX, i * 2);
+        ASSERT_EQ(i == 0 ? 0 : 1, CountingLess::call_count);
+        ASSERT_FALSE(tree.contains_at(np_idxs.i));
+        tree.insert_new_at(np_idxs, i * 2, i);
+    }
+    ASSERT_TRUE(satisfies_red_black_invariants(tree));
+
+    // Odd keys right before the hint take two calls to `Compare`, right after it three
+    for (int i = 1; i < 100; i += 2)
+    {
+        const bool before_hint = i % 4 == 1;
+        const NodeIndex hint_index = tree.index_of_node_or_null(before_hint ? i + 1 : i - 1);
+        CountingLess::call_count = 0;
+        NodeIndexAndParentIndex np_idxs = tree.index_of_node_with_parent_near(hint_index, i);
+        ASSERT_EQ(before_hint ? 2 : 3, CountingLess::call_count);
+        tree.insert_new_at(np_idxs, i, i);
+    }
+    ASSERT_TRUE(satisfies_red_black_invariants(tree));
+    ASSERT_TRUE(has_consistent_order_statistics(tree));
+
+    // Wrong hints still find the right position
+    const NodeIndex min_index = tree.index_of_min_at();
+    for (const int key : {-10, 150, 199, 99, 0, 198})
+    {
+        for (const NodeIndex hint_index : {min_index, tree.index_of_node_or_null(100), NULL_INDEX})
+        {
+            NodeIndexAndParentIndex np_idxs = tree.index_of_node_with_parent_near(hint_index, key);
+            const NodeIndexAndParentIndex expected = tree.index_of_node_with_parent(key);
+            ASSERT_EQ(expected.i, np_idxs.i);
+            if (!tree.contains_at(np_idxs.i))
+            {
+                ASSERT_EQ(expected.parent, np_idxs.parent);
+                ASSERT_EQ(expected.is_left_child, np_idxs.is_left_child);
+            }
+        }
+    }
+
+    NodeIndexAndParentIndex np_idxs = tree.index_of_node_with_parent_before_min(-1);
+    tree.insert_new_at(np_idxs, -1, -1);
+    np_idxs = tree.index_of_node_with_parent_past_max(200);
+    tree.insert_new_at(np_idxs, 200, 200);
+    ASSERT_TRUE(satisfies_red_black_invariants(tree));
+    ASSERT_TRUE(has_consistent_order_statistics(tree));
+    ASSERT_EQ(152, tree.size());
+    ASSERT_EQ(-1, tree.node_at(tree.index_of_nth(0)).key());
+    ASSERT_EQ(200, tree.node_at(tree.index_of_nth(151)).key());
+    for (NodeIndex i = tree.index_of_min_at(); tree.index_of_successor_at(i) != NULL_INDEX;
+         i = tree.index_of_successor_at(i))
+    {
+        ASSERT_LT(tree.node_at(i).key(), tree.node_at(tree.index_of_successor_at(i)).key());
+    }
+
+    EXPECT_DEATH((void)tree.index_of_node_with_parent_past_max(150), "");
+    EXPECT_DEATH((void)tree.index_of_node_with_parent_before_min(-1), "");
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, InsertionNearHint)
+{
+    insertion_near_hint_test_helper<FixedIndexBasedPoolStorage>();
+    insertion_near_hint_test_helper<FixedIndexBasedContiguousStorage>();
+
+    constexpr auto VAL1 = []()
+    {
+        FixedRedBlackTree<int, EmptyValue, 10> tree{};
+        for (int i = 0; i < 10; i++)
+        {
+            NodeIndexAndParentIndex np_idxs = tree.index_of_node_with_parent_past_max(i);
+            tree.insert_new_at(np_idxs, i);
+        }
+        return tree;
+    }();
+    static_assert(VAL1.size() == 10);
+    static_assert(VAL1.node_at(VAL1.index_of_max_at()).key() == 9);
+}
+
+namespace
+{
+template <class TreeType>
+bool has_consistent_links(const TreeType& tree)
+{
+    if (tree.root_index() != NULL_INDEX &&
+        tree.node_at(tree.root_index()).parent_index() != NULL_INDEX)
+    {
+        return false;
+    }
+    // The maximum is tracked instead of being found down the right spine
+    if (tree.index_of_max_at() != tree.index_of_max_at(tree.root_index()))
+    {
+        return false;
+    }
+    std::size_t count = 0;
+    for (NodeIndex i = tree.index_of_min_at(); i != NULL_INDEX; i = tree.index_of_successor_at(i))
+    {
+        const auto node = tree.node_at(i);
+        for (const NodeIndex child : {node.left_index(), node.right_index()})
+        {
+            if (child != NULL_INDEX && tree.node_at(child).parent_index() != i)
+            {
+                return false;
+            }
+        }
+        count++;
+    }
+    return count == tree.size();
+}
+
+template <class TreeType>
+bool has_keys_in_range(const TreeType& tree, int from, int to)
+{
+    int expected = from;
+    for (NodeIndex i = tree.index_of_min_at(); i != NULL_INDEX; i = tree.index_of_successor_at(i))
+    {
+        if (tree.node_at(i).key() != expected || tree.node_at(i).value().value != expected)
+        {
+            return false;
+        }
+        expected++;
+    }
+    return expected == to;
+}
+
+template <class TreeType>
+bool is_valid_tree(const TreeType& tree)
+{
+    return has_consistent_links(tree) && satisfies_red_black_invariants(tree) &&
+           has_consistent_order_statistics(tree);
+}
+
+template <class TreeType>
+bool has_keys(const TreeType& tree, const std::vector<int>& keys)
+{
+    auto key_it = keys.begin();
+    for (NodeIndex i = tree.index_of_min_at(); i != NULL_INDEX; i = tree.index_of_successor_at(i))
+    {
+        if (key_it == keys.end() || tree.node_at(i).key() != *key_it ||
+            tree.node_at(i).value().value != *key_it)
+        {
+            return false;
+        }
+        ++key_it;
+    }
+    return key_it == keys.end();
+}
+
+template <class TreeType>
+void fill_with_keys(TreeType& tree, std::vector<int> keys, std::mt19937& rng)
+{
+    std::shuffle(keys.begin(), keys.end(), rng);
+    // Leave holes in the storage, so that the contiguous storage repositions nodes
+    for (const int key : keys)
+    {
+        tree[key + 1000] = MockNonTrivialInt{0};
+        tree[key] = MockNonTrivialInt{key};
+    }
+    for (const int key : keys)
+    {
+        tree.delete_node(key + 1000);
+    }
+}
+
+template <class TreeType>
+void fill_with_keys_in_range(TreeType& tree, int from, int to, std::mt19937& rng)
+{
+    std::vector<int> keys{};
+    for (int key = from; key < to; key++)
+    {
+        keys.push_back(key);
+    }
+    fill_with_keys(tree, keys, rng);
+}
+
+template <template <typename, std::size_t> typename StorageTemplate>
+void split_and_join_test_helper()
+{
+    using TreeType = FixedRedBlackTree<int,
+                                       MockNonTrivialInt,
+                                       256,
+                                       CountingLess,
+                                       RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                       StorageTemplate,
+                                       OrderStatisticTreeAugmentation>;
+    std::random_device rand_device;
+    std::mt19937 rng(rand_device());
+
+    for (const int size : {0, 1, 2, 3, 7, 20, 64})
+    {
+        for (int key = -1; key <= size; key++)
+        {
+            TreeType tree{};
+            fill_with_keys_in_range(tree, 0, size, rng);
+            tree.delete_nodes_less_than(key);
+            ASSERT_TRUE(is_valid_tree(tree));
+            ASSERT_TRUE(has_keys_in_range(tree, std::clamp(key, 0, size), size));
+
+            tree.clear();
+            fill_with_keys_in_range(tree, 0, size, rng);
+            tree.delete_nodes_greater_than(key);
+            ASSERT_TRUE(is_valid_tree(tree));
+            ASSERT_TRUE(has_keys_in_range(tree, 0, std::clamp(key + 1, 0, size)));
+
+            tree.clear();
+            fill_with_keys_in_range(tree, 0, size, rng);
+            TreeType greater{};
+            tree.move_nodes_not_less_than_into(key, greater);
+            ASSERT_TRUE(is_valid_tree(tree));
+            ASSERT_TRUE(has_keys_in_range(tree, 0, std::clamp(key, 0, size)));
+            ASSERT_TRUE(is_valid_tree(greater));
+            ASSERT_TRUE(has_keys_in_range(greater, std::clamp(key, 0, size), size));
+
+            // And back, from either side
+            tree.join_with(greater, []() {});
+            ASSERT_TRUE(greater.empty());
+            ASSERT_TRUE(is_valid_tree(tree));
+            ASSERT_TRUE(has_keys_in_range(tree, 0, size));
+            tree.move_nodes_not_less_than_into(key, greater);
+            greater.join_with(tree, []() {});
+            ASSERT_TRUE(tree.empty());
+            ASSERT_TRUE(is_valid_tree(greater));
+            ASSERT_TRUE(has_keys_in_range(greater, 0, size));
+        }
+    }
+
+    // Splitting only compares keys while searching for the key
+    TreeType tree{};
+    fill_with_keys_in_range(tree, 0, 128, rng);
+    CountingLess::call_count = 0;
+    tree.delete_nodes_less_than(100);
+    EXPECT_LE(CountingLess::call_count, 2 * 2 * 8);
+    ASSERT_TRUE(has_keys_in_range(tree, 100, 128));
+
+    TreeType other{};
+    fill_with_keys_in_range(other, 0, 100, rng);
+    CountingLess::call_count = 0;
+    tree.join_with(other, []() {});
+    EXPECT_EQ(3, CountingLess::call_count);
+    ASSERT_TRUE(is_valid_tree(tree));
+    ASSERT_TRUE(has_keys_in_range(tree, 0, 128));
+
+    fill_with_keys_in_range(other, 50, 60, rng);
+    EXPECT_DEATH(tree.join_with(other, []() {}), "");
+
+    tree.clear();
+    ASSERT_TRUE(is_valid_tree(tree));
+    ASSERT_TRUE(tree.empty());
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, SplitAndJoin)
+{
+    split_and_join_test_helper<FixedIndexBasedPoolStorage>();
+    split_and_join_test_helper<FixedIndexBasedContiguousStorage>();
+
+    constexpr auto VAL1 = []()
+    {
+        FixedRedBlackTree<int, EmptyValue, 20> tree{};
+        for (int i = 0; i < 20; i++)
+        {
+            tree.insert_node(i);
+        }
+        tree.delete_nodes_less_than(5);
+        tree.delete_nodes_greater_than(14);
+        return tree;
+    }();
+    static_assert(VAL1.size() == 10);
+    static_assert(VAL1.node_at(VAL1.index_of_min_at()).key() == 5);
+    static_assert(VAL1.node_at(VAL1.index_of_max_at()).key() == 14);
+}
+
+namespace
+{
+std::vector<int> random_sorted_keys(const int count, std::mt19937& rng)
+{
+    std::vector<int> keys(160);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), rng);
+    keys.resize(static_cast<std::size_t>(count));
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+template <template <typename, std::size_t> typename StorageTemplate>
+void set_algebra_test_helper()
+{
+    using TreeType = FixedRedBlackTree<int,
+                                       MockNonTrivialInt,
+                                       256,
+                                       CountingLess,
+                                       RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                                       StorageTemplate,
+                                       OrderStatisticTreeAugmentation>;
+    std::random_device rand_device;
+    std::mt19937 rng(rand_device());
+
+    for (const int size_a : {0, 1, 5, 60, 120})
+    {
+        for (const int size_b : {0, 1, 5, 60, 120})
+        {
+            const std::vector<int> keys_a = random_sorted_keys(size_a, rng);
+            const std::vector<int> keys_b = random_sorted_keys(size_b, rng);
+            TreeType tree_a{};
+            fill_with_keys(tree_a, keys_a, rng);
+            TreeType tree_b{};
+            fill_with_keys(tree_b, keys_b, rng);
+
+            ASSERT_EQ(std::includes(keys_a.begin(), keys_a.end(), keys_b.begin(), keys_b.end()),
+                      tree_a.contains_all_nodes_of(tree_b));
+            ASSERT_TRUE(tree_a.contains_all_nodes_of(tree_a));
+
+            std::vector<int> expected{};
+            TreeType tree = tree_a;
+            tree.insert_nodes_not_present_from(tree_b, []() {});
+            std::set_union(keys_a.begin(),
+                           keys_a.end(),
+                           keys_b.begin(),
+                           keys_b.end(),
+                           std::back_inserter(expected));
+            ASSERT_TRUE(is_valid_tree(tree));
+            ASSERT_TRUE(has_keys(tree, expected));
+            ASSERT_TRUE(tree.contains_all_nodes_of(tree_b));
+
+            expected.clear();
+            tree = tree_a;
+            tree.delete_nodes_not_in(tree_b);
+            std::set_intersection(keys_a.begin(),
+                                  keys_a.end(),
+                                  keys_b.begin(),
+                                  keys_b.end(),
+                                  std::back_inserter(expected));
+            ASSERT_TRUE(is_valid_tree(tree));
+            ASSERT_TRUE(has_keys(tree, expected));
+
+            expected.clear();
+            tree = tree_a;
+            tree.delete_nodes_in(tree_b);
+            std::set_difference(keys_a.begin(),
+                                keys_a.end(),
+                                keys_b.begin(),
+                                keys_b.end(),
+                                std::back_inserter(expected));
+            ASSERT_TRUE(is_valid_tree(tree));
+            ASSERT_TRUE(has_keys(tree, expected));
+        }
+    }
+
+    // With the same tree on both sides
+    TreeType tree{};
+    fill_with_keys_in_range(tree, 0, 20, rng);
+    tree.insert_nodes_not_present_from(tree, []() {});
+    tree.delete_nodes_not_in(tree);
+    ASSERT_TRUE(has_keys_in_range(tree, 0, 20));
+    tree.delete_nodes_in(tree);
+    ASSERT_TRUE(tree.empty());
+
+    // A few keys against many: the runs in between are skipped, not walked
+    fill_with_keys_in_range(tree, 0, 128, rng);
+    TreeType few{};
+    fill_with_keys(few, {31, 32, 97}, rng);
+    CountingLess::call_count = 0;
+    EXPECT_TRUE(tree.contains_all_nodes_of(few));
+    EXPECT_LT(CountingLess::call_count, 64);
+    CountingLess::call_count = 0;
+    tree.delete_nodes_in(few);
+    EXPECT_LT(CountingLess::call_count, 64);
+    ASSERT_EQ(125, tree.size());
+    few.insert_nodes_not_present_from(tree, []() {});
+    ASSERT_TRUE(is_valid_tree(few));
+    ASSERT_TRUE(has_keys_in_range(few, 0, 128));
+}
+}  // namespace
+
+TEST(FixedRedBlackTree, SetAlgebra)
+{
+    set_algebra_test_helper<FixedIndexBasedPoolStorage>();
+    set_algebra_test_helper<FixedIndexBasedContiguousStorage>();
+
+    constexpr auto VAL1 = []()
+    {
+        FixedRedBlackTree<int, EmptyValue, 20> tree{};
+        FixedRedBlackTree<int, EmptyValue, 10> other{};
+        for (int i = 0; i < 10; i++)
+        {
+            tree.insert_node(i);
+            other.insert_node(i * 2);
+        }
+        tree.delete_nodes_in(other);
+        tree.insert_nodes_not_present_from(other, []() {});
+        tree.delete_nodes_not_in(other);
+        return tree;
+    }();
+    static_assert(VAL1.size() == 10);
+    static_assert(VAL1.node_at(VAL1.index_of_max_at()).key() == 18);
+}
+
+TEST(FixedRedBlackTree, WiderNodeIndices)
+{
+    // Past the range of 8-bit indices
+    using TreeType = FixedRedBlackTree<int, int, 300>;
+    static_assert(std::is_same_v<std::uint16_t, NodeIndexStorage<300>>);
+
+    TreeType tree{};
+    for (int i = 0; i < 300; i++)
+    {
+        tree[(i * 7) % 300] = i;
+    }
+    ASSERT_TRUE(tree.full());
+    for (int i = 0; i < 300; i += 2)
+    {
+        tree.delete_node(i);
+    }
+    ASSERT_EQ(150, tree.size());
+    ASSERT_TRUE(satisfies_red_black_invariants(tree));
+    ASSERT_TRUE(tree.contains_node(299));
+    ASSERT_FALSE(tree.contains_node(298));
+    EXPECT_LE(find_height(tree), max_height_of_red_black_tree(tree.size()));
+}
+
 TEST(FixedRedBlackTree, TreeMaxHeight)
 {
     static constexpr std::size_t MAXIMUM_SIZE = 512;
@@ -34,6 +34,7 @@ TEST(FixedRedBlackTreeView, ViewOfPoolStorage)
     auto view = FixedRedBlackTreeRawView(
         ptr,
         sizeof(FixedSetType::value_type),
+        alignof(FixedSetType::value_type),
         var1.max_size(),
         COMPACTNESS,
         fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_POOL);
@@ -79,6 +80,7 @@ TEST(FixedRedBlackTreeView, ViewWithStructValue)
     auto view = FixedRedBlackTreeRawView(
         ptr,
         sizeof(FixedSetType::value_type),
+        alignof(FixedSetType::value_type),
         var1.max_size(),
         COMPACTNESS,
         fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_POOL);
@@ -108,6 +110,7 @@ TEST(FixedRedBlackTreeView, ViewOfContiguousStorage)
     auto view = FixedRedBlackTreeRawView(
         ptr,
         sizeof(FixedSetType::value_type),
+        alignof(FixedSetType::value_type),
         var1.max_size(),
         COMPACTNESS,
         fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_CONTIGUOUS);
@@ -124,6 +127,39 @@ TEST(FixedRedBlackTreeView, ViewOfContiguousStorage)
     EXPECT_EQ(var1, var2);
 }
 
+TEST(FixedRedBlackTreeView, ViewWithWiderIndices)
+{
+    constexpr auto COMPACTNESS =
+        fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR;
+    using FixedSetType =
+        FixedSet<double, 200, std::less<>, COMPACTNESS, FixedIndexBasedPoolStorage>;
+
+    FixedSetType var1{};
+    for (int i = 0; i < 150; i++)
+    {
+        var1.insert(static_cast<double>((i * 7) % 150));
+    }
+
+    const auto* const ptr = reinterpret_cast<const void*>(&var1);
+    auto view = FixedRedBlackTreeRawView(
+        ptr,
+        sizeof(FixedSetType::value_type),
+        alignof(FixedSetType::value_type),
+        var1.max_size(),
+        COMPACTNESS,
+        fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_POOL);
+
+    EXPECT_EQ(var1.size(), view.size());
+
+    FixedSetType var2;
+    for (const std::byte* elm_ptr : view)
+    {
+        var2.insert(*reinterpret_cast<const double*>(elm_ptr));
+    }
+
+    EXPECT_EQ(var1, var2);
+}
+
 TEST(FixedRedBlackTreeView, PreservedOrdering)
 {
     constexpr auto COMPACTNESS =
@@ -137,6 +173,7 @@ TEST(FixedRedBlackTreeView, PreservedOrdering)
     auto view = FixedRedBlackTreeRawView(
         ptr,
         sizeof(FixedSetType::value_type),
+        alignof(FixedSetType::value_type),
         var1.max_size(),
         COMPACTNESS,
         fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_POOL);
@@ -166,6 +203,7 @@ TEST(FixedRedBlackTreeView, SizeCalculation)
     auto view1 = FixedRedBlackTreeRawView(
         &var1,
         sizeof(FixedSetType::value_type),
+        alignof(FixedSetType::value_type),
         var1.max_size(),
         COMPACTNESS,
         fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_POOL);
@@ -176,6 +214,7 @@ TEST(FixedRedBlackTreeView, SizeCalculation)
     auto view2 = FixedRedBlackTreeRawView(
         &var2,
         sizeof(FixedSetType::value_type),
+        alignof(FixedSetType::value_type),
         var2.max_size(),
         COMPACTNESS,
         fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_POOL);
@@ -186,6 +225,7 @@ TEST(FixedRedBlackTreeView, SizeCalculation)
     auto view3 = FixedRedBlackTreeRawView(
         &var3,
         sizeof(FixedSetType::value_type),
+        alignof(FixedSetType::value_type),
         var3.max_size(),
         COMPACTNESS,
         fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_POOL);
@@ -197,6 +237,7 @@ TEST(FixedRedBlackTreeView, SizeCalculation)
     auto view4 = FixedRedBlackTreeRawView(
         buf,
         sizeof(FixedSetType::value_type),
+        alignof(FixedSetType::value_type),
         MAXIMUM_ENTRIES,
         COMPACTNESS,
         fixed_red_black_tree_detail::RedBlackTreeStorageType::FIXED_INDEX_POOL);
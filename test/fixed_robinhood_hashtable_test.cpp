@@ -4,9 +4,13 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <initializer_list>
 #include <iostream>
+#include <type_traits>
+#include <vector>
 
 namespace fixed_containers::fixed_robinhood_hashtable_detail
 {
@@ -47,9 +51,9 @@ template <typename T>
 [[maybe_unused]] void print_map_state(const T& map)
 {
     std::cout << "--- map with " << map.size() << " elems ---" << std::endl;
-    for (typename T::SizeType i = 0; i < T::INTERNAL_TABLE_SIZE; i++)
+    for (typename T::BucketIndexType i = 0; i < T::INTERNAL_TABLE_SIZE; i++)
     {
-        const Bucket& bucket = map.bucket_at(i);
+        const auto& bucket = map.bucket_at(i);
 
         // don't print anything for empty slots
         if (bucket.dist_and_fingerprint_ == 0)
@@ -105,6 +109,81 @@ TEST(BucketOperations, BucketArray)
     static_assert(IntIntMap10::next_bucket_index(9) == 0);
 }
 
+TEST(BucketOperations, BucketIndexing)
+{
+    using PowerOfTwoMap =
+        FixedRobinhoodHashtable<int,
+                                int,
+                                10,
+                                10,
+                                ConvenientIntHash,
+                                std::equal_to<>,
+                                RobinhoodHashtableOptions{BucketIndexing::POWER_OF_TWO_MASK}>;
+    static_assert(PowerOfTwoMap::INTERNAL_TABLE_SIZE == 16);
+    static_assert(PowerOfTwoMap::bucket_index_from_hash(3 << Bucket::FINGERPRINT_BITS) == 3);
+    static_assert(PowerOfTwoMap::bucket_index_from_hash(11 << Bucket::FINGERPRINT_BITS) == 11);
+    static_assert(PowerOfTwoMap::bucket_index_from_hash(17 << Bucket::FINGERPRINT_BITS) == 1);
+    static_assert(PowerOfTwoMap::next_bucket_index(15) == 0);
+
+    using FastrangeMap =
+        FixedRobinhoodHashtable<int,
+                                int,
+                                10,
+                                10,
+                                ConvenientIntHash,
+                                std::equal_to<>,
+                                RobinhoodHashtableOptions{BucketIndexing::FASTRANGE}>;
+    static_assert(FastrangeMap::INTERNAL_TABLE_SIZE == 10);
+    // the upper 32 bits of the hash are scaled to the table size
+    static_assert(FastrangeMap::bucket_index_from_hash(0x0000'0000'FFFF'FFFFULL) == 0);
+    static_assert(FastrangeMap::bucket_index_from_hash(0x8000'0000'0000'0000ULL) == 5);
+    static_assert(FastrangeMap::bucket_index_from_hash(0xFFFF'FFFF'0000'0000ULL) == 9);
+
+    static_assert(internal_table_size(0, BucketIndexing::MODULO) == 1);
+    static_assert(internal_table_size(0, BucketIndexing::POWER_OF_TWO_MASK) == 1);
+    static_assert(internal_table_size(100, BucketIndexing::FASTRANGE) == 100);
+    static_assert(internal_table_size(100, BucketIndexing::POWER_OF_TWO_MASK) == 128);
+}
+
+TEST(BucketOperations, DefaultBucketCount)
+{
+    static_assert(default_bucket_count(100) == 130);
+    static_assert(default_bucket_count(100, 200) == 200);
+    static_assert(default_bucket_count(10, 100) == 10);
+    static_assert(power_of_two_bucket_count(100) == 256);
+    static_assert(power_of_two_bucket_count(100, 120) == 128);
+}
+
+TEST(BucketOperations, CompactWidths)
+{
+    // small tables use 16-bit distance+fingerprint and 8-bit value indices
+    static_assert(std::is_same_v<IntIntMap10::SizeType, std::uint8_t>);
+    static_assert(
+        std::is_same_v<IntIntMap10::BucketType, BasicBucket<std::uint16_t, std::uint8_t>>);
+    static_assert(sizeof(IntIntMap10::BucketType) == 4);
+
+    using MediumMap =
+        FixedRobinhoodHashtable<int, int, 1000, 1300, ConvenientIntHash, std::equal_to<>>;
+    static_assert(std::is_same_v<MediumMap::SizeType, std::uint16_t>);
+    static_assert(
+        std::is_same_v<MediumMap::BucketType, BasicBucket<std::uint32_t, std::uint16_t>>);
+    static_assert(sizeof(MediumMap::BucketType) == 8);
+
+    static_assert(std::is_same_v<DistAndFingerprintTypeFor<255>, std::uint16_t>);
+    static_assert(std::is_same_v<DistAndFingerprintTypeFor<256>, std::uint32_t>);
+    static_assert(std::is_same_v<DistAndFingerprintTypeFor<(1ULL << 24U) - 1>, std::uint32_t>);
+    static_assert(std::is_same_v<DistAndFingerprintTypeFor<(1ULL << 24U)>, std::uint64_t>);
+
+    // the narrow bucket keeps the same ordering of distances as the wide one
+    using SmallBucket = BasicBucket<std::uint16_t, std::uint8_t>;
+    constexpr std::uint16_t DIST_AND_FINGERPRINT =
+        SmallBucket::dist_and_fingerprint_from_hash(0x1234UL);
+    static_assert((DIST_AND_FINGERPRINT & SmallBucket::FINGERPRINT_MASK) == 0x34);
+    static_assert((DIST_AND_FINGERPRINT >> SmallBucket::FINGERPRINT_BITS) == 1);
+    static_assert(SmallBucket::increment_dist(DIST_AND_FINGERPRINT) > DIST_AND_FINGERPRINT);
+    static_assert(SmallBucket::MAX_NUM_BUCKETS == 255);
+}
+
 TEST(MapOperations, Emplace)
 {
     IntIntMap10 map{};
@@ -742,6 +821,296 @@ TEST(MapOperations, EraseRange)
     idx = map.opaque_index_of(0);
 }
 
+TEST(MapOperations, Clear)
+{
+    IntIntMap10 map{};
+    for (int key : {13, 33, 9, 43, 6})
+    {
+        map.emplace(map.opaque_index_of(key), key, key * 10);
+    }
+    map.erase(map.opaque_index_of(33));
+
+    // every bucket is reset at once, and the values are handed out from the start again
+    map.clear();
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.begin_index(), map.end_index());
+    for (std::size_t i = 0; i < IntIntMap10::INTERNAL_TABLE_SIZE; i++)
+    {
+        EXPECT_EQ(map.bucket_at(i).dist_and_fingerprint_, 0);
+    }
+    EXPECT_FALSE(map.exists(map.opaque_index_of(13)));
+
+    map.emplace(map.opaque_index_of(23), 23, 230);
+    EXPECT_EQ(map.begin_index(), 0);
+    EXPECT_EQ(map.value(map.opaque_index_of(23)), 230);
+    EXPECT_FALSE(map.exists(map.opaque_index_of(13)));
+}
+
+namespace
+{
+// Erases the values with odd keys both at once and one at a time, and checks that both end up with
+// the same buckets
+template <typename MapType>
+void check_erase_if_at_matches_erase(const std::initializer_list<int>& keys)
+{
+    MapType map{};
+    for (int key : keys)
+    {
+        map.emplace(map.opaque_index_of(key), key, key * 10);
+    }
+    MapType expected = map;
+    for (int key : keys)
+    {
+        if (key % 2 != 0)
+        {
+            expected.erase(expected.opaque_index_of(key));
+        }
+    }
+
+    std::vector<int> visited{};
+    const std::size_t erased = map.erase_if_at(
+        [&map, &visited](const typename MapType::OpaqueIteratedType& value_index)
+        {
+            visited.push_back(map.key_at(value_index));
+            return map.key_at(value_index) % 2 != 0;
+        });
+
+    EXPECT_EQ(erased, keys.size() - expected.size());
+    EXPECT_EQ(visited.size(), keys.size());
+    EXPECT_EQ(map.size(), expected.size());
+    for (std::size_t i = 0; i < MapType::INTERNAL_TABLE_SIZE; i++)
+    {
+        EXPECT_EQ(map.bucket_at(i).dist_and_fingerprint_,
+                  expected.bucket_at(i).dist_and_fingerprint_);
+    }
+    for (int key : keys)
+    {
+        const auto idx = map.opaque_index_of(key);
+        EXPECT_EQ(map.exists(idx), key % 2 == 0);
+        if (key % 2 == 0)
+        {
+            EXPECT_EQ(map.value(idx), key * 10);
+        }
+    }
+}
+}  // namespace
+
+TEST(MapOperations, EraseIfAt)
+{
+    using DenseMap10 =
+        FixedRobinhoodHashtable<int,
+                                int,
+                                10,
+                                10,
+                                ConvenientIntHash,
+                                std::equal_to<>,
+                                RobinhoodHashtableOptions{.value_storage = ValueStorage::DENSE}>;
+
+    // a run of collisions in the middle of the table
+    check_erase_if_at_matches_erase<IntIntMap10>({13, 1293, 23, 4, 9, 19});
+    check_erase_if_at_matches_erase<DenseMap10>({13, 1293, 23, 4, 9, 19});
+    // runs that wrap around the end of the bucket array
+    check_erase_if_at_matches_erase<IntIntMap10>({9, 19, 29, 39, 0, 1, 2, 5});
+    check_erase_if_at_matches_erase<DenseMap10>({9, 19, 29, 39, 0, 1, 2, 5});
+    // full tables, without any empty bucket
+    check_erase_if_at_matches_erase<IntIntMap10>({9, 0, 1, 2, 3, 4, 5, 6, 7, 8});
+    check_erase_if_at_matches_erase<DenseMap10>({9, 19, 29, 39, 49, 59, 69, 79, 89, 99});
+    // nothing to erase, and everything to erase
+    check_erase_if_at_matches_erase<IntIntMap10>({2, 4, 6});
+    check_erase_if_at_matches_erase<DenseMap10>({1, 3, 5});
+
+    IntIntMap10 map{};
+    for (int key : {13, 23, 33})
+    {
+        map.emplace(map.opaque_index_of(key), key, key * 10);
+    }
+    EXPECT_EQ(map.erase_if_at([](const IT&) { return true; }), 3);
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.begin_index(), map.end_index());
+}
+
+TEST(MapOperations, EmplaceEqual)
+{
+    IntIntMap10 map{};
+    map.emplace(map.opaque_index_of(23), 23, 0);
+    map.emplace(map.opaque_index_of(13), 13, 1);
+    EXPECT_EQ(map.bucket_at(3).value_index_, 0);
+    EXPECT_EQ(map.bucket_at(4).value_index_, 1);
+
+    // the duplicate goes right after the last 23 in both the buckets and the iteration order
+    OIT idx = map.emplace_equal(map.opaque_index_of(23), 23, 2);
+    EXPECT_EQ(idx.bucket_index, 4);
+    EXPECT_EQ(map.bucket_at(4).dist(), 2);
+    EXPECT_EQ(map.bucket_at(4).fingerprint(), 23);
+    EXPECT_EQ(map.bucket_at(4).value_index_, 2);
+    EXPECT_EQ(map.bucket_at(5).dist(), 3);
+    EXPECT_EQ(map.bucket_at(5).value_index_, 1);
+    EXPECT_EQ(map.next_of(0), 2);
+    EXPECT_EQ(map.next_of(2), 1);
+
+    idx = map.emplace_equal(map.opaque_index_of(23), 23, 3);
+    EXPECT_EQ(idx.bucket_index, 5);
+    EXPECT_EQ(map.next_of(2), 3);
+    EXPECT_EQ(map.next_of(3), 1);
+
+    // lookups find the first of them, which leads to all the others
+    idx = map.opaque_index_of(23);
+    EXPECT_EQ(idx.bucket_index, 3);
+    EXPECT_EQ(map.equal_count(idx), 3);
+    EXPECT_EQ(map.end_of_equal_range(idx), 1);
+    EXPECT_EQ(map.equal_count(map.opaque_index_of(13)), 1);
+    EXPECT_EQ(map.value(map.opaque_index_of(13)), 1);
+
+    // erasing a specific duplicate goes through its value index, not its key
+    map.erase(map.opaque_index_from_iterated(2));
+    EXPECT_EQ(map.equal_count(map.opaque_index_of(23)), 2);
+    EXPECT_EQ(map.next_of(0), 3);
+    EXPECT_EQ(map.bucket_at(4).value_index_, 3);
+    EXPECT_EQ(map.bucket_at(5).value_index_, 1);
+}
+
+TEST(MapOperations, Statistics)
+{
+    constexpr IntIntMap10 EMPTY{};
+    static_assert(EMPTY.statistics().size == 0);
+    static_assert(EMPTY.statistics().max_displacement == 0);
+    static_assert(EMPTY.statistics().mean_probe_length() == 0.0);
+
+    constexpr IntIntMap10 MAP = []()
+    {
+        IntIntMap10 map{};
+        for (int key : {13, 1293, 23, 4, 9, 19})
+        {
+            map.emplace(map.opaque_index_of(key), key, 0);
+        }
+        return map;
+    }();
+
+    // 3: 23, 4: 13, 5: 1293, 6: 4, ..., 9: 19, 0: 9
+    constexpr RobinhoodHashtableStatistics STATS = MAP.statistics();
+    static_assert(STATS.size == 6);
+    static_assert(STATS.bucket_count == 10);
+    static_assert(STATS.load_factor() == 0.6);
+    static_assert(STATS.max_displacement == 2);
+    static_assert(STATS.total_displacement == 6);
+    static_assert(STATS.mean_displacement() == 1.0);
+    static_assert(STATS.mean_probe_length() == 2.0);
+    static_assert(STATS.displacement_histogram[0] == 2);
+    static_assert(STATS.displacement_histogram[1] == 2);
+    static_assert(STATS.displacement_histogram[2] == 2);
+    static_assert(STATS.displacement_histogram[3] == 0);
+    // looking up 1293 first runs into 13, which has the same home bucket and fingerprint
+    static_assert(STATS.fingerprint_false_positives == 1);
+
+    // long displacements all end up in the last slot of the histogram
+    using IntIntMap40 =
+        FixedRobinhoodHashtable<int, int, 40, 40, ConvenientIntHash, std::equal_to<>>;
+    IntIntMap40 map{};
+    for (int i = 0; i < 20; i++)
+    {
+        const int key = i * 40;
+        map.emplace(map.opaque_index_of(key), key, i);
+    }
+    const RobinhoodHashtableStatistics stats = map.statistics();
+    EXPECT_EQ(stats.max_displacement, 19);
+    EXPECT_EQ(stats.total_displacement, 19 * 20 / 2);
+    EXPECT_EQ(stats.displacement_histogram[0], 1);
+    EXPECT_EQ(stats.displacement_histogram[RobinhoodHashtableStatistics::HISTOGRAM_SIZE - 1], 5);
+    // all the keys have different fingerprints
+    EXPECT_EQ(stats.fingerprint_false_positives, 0);
+}
+
+TEST(MapOperations, DenseStorage)
+{
+    using DenseMap10 =
+        FixedRobinhoodHashtable<int,
+                                int,
+                                10,
+                                10,
+                                ConvenientIntHash,
+                                std::equal_to<>,
+                                RobinhoodHashtableOptions{.value_storage = ValueStorage::DENSE}>;
+    DenseMap10 map{};
+
+    for (int key : {3, 13, 5, 24})
+    {
+        map.emplace(map.opaque_index_of(key), key, key * 10);
+    }
+    EXPECT_EQ(map.size(), 4);
+    EXPECT_EQ(map.key_at(0), 3);
+    EXPECT_EQ(map.key_at(3), 24);
+
+    // iteration goes from the back of the storage to the front
+    EXPECT_EQ(map.begin_index(), 3);
+    EXPECT_EQ(map.next_of(3), 2);
+    EXPECT_EQ(map.next_of(0), map.end_index());
+    EXPECT_EQ(map.prev_of(map.end_index()), 0);
+
+    // erasing the first value moves the last one into its place and updates its bucket
+    const IT next = map.erase(map.opaque_index_of(3));
+    EXPECT_EQ(next, map.end_index());
+    EXPECT_EQ(map.size(), 3);
+    EXPECT_EQ(map.key_at(0), 24);
+    EXPECT_EQ(map.bucket_at(4).value_index_, 0);
+    EXPECT_EQ(map.value(map.opaque_index_of(24)), 240);
+    EXPECT_EQ(map.value(map.opaque_index_of(13)), 130);
+    EXPECT_FALSE(map.exists(map.opaque_index_of(3)));
+
+    // erasing the last value doesn't move anything
+    EXPECT_EQ(map.erase(map.opaque_index_of(5)), 1);
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map.entries().size(), 2);
+    EXPECT_EQ(map.entries()[0].key(), 24);
+    EXPECT_EQ(map.entries()[1].key(), 13);
+
+    map.clear();
+    EXPECT_EQ(map.size(), 0);
+    EXPECT_EQ(map.begin_index(), map.end_index());
+}
+
+TEST(MapOperations, StoredHashes)
+{
+    using DenseMap10 =
+        FixedRobinhoodHashtable<int,
+                                int,
+                                10,
+                                10,
+                                ConvenientIntHash,
+                                std::equal_to<>,
+                                RobinhoodHashtableOptions{.value_storage = ValueStorage::DENSE}>;
+    using StoringMap10 = FixedRobinhoodHashtable<
+        int,
+        int,
+        10,
+        10,
+        ConvenientIntHash,
+        std::equal_to<>,
+        RobinhoodHashtableOptions{.value_storage = ValueStorage::DENSE, .store_hashes = true}>;
+    static_assert(sizeof(StoringMap10) == sizeof(DenseMap10) + 10 * sizeof(std::uint64_t));
+    static_assert(IsStructuralType<StoringMap10>);
+
+    StoringMap10 map{};
+    map.emplace(map.opaque_index_of(3), 3, 30);
+    map.emplace(map.opaque_index_of(13), 13, 130);
+    // the given hash is stored as is, it only has to agree with the hash function for lookups
+    const std::uint64_t hash_of_24 = ConvenientIntHash{}(24);
+    map.emplace_with_hash(map.opaque_index_of_hash(24, hash_of_24), hash_of_24, 24, 240);
+    EXPECT_EQ(map.hash_at(0), ConvenientIntHash{}(3));
+    EXPECT_EQ(map.hash_at(2), hash_of_24);
+
+    // the stored hash follows its value when swap-and-pop moves it
+    map.erase(map.opaque_index_of(3));
+    EXPECT_EQ(map.key_at(0), 24);
+    EXPECT_EQ(map.hash_at(0), hash_of_24);
+    EXPECT_EQ(map.value(map.opaque_index_of(24)), 240);
+    EXPECT_EQ(map.value(map.opaque_index_of(13)), 130);
+
+    // without stored hashes, the key is hashed again
+    IntIntMap10 plain_map{};
+    plain_map.emplace(plain_map.opaque_index_of(7), 7, 70);
+    EXPECT_EQ(plain_map.hash_at(plain_map.begin_index()), ConvenientIntHash{}(7));
+}
+
 // in very rare cases, we could have a key that collides both in index AND in fingerprint
 TEST(MapCornerCases, PerfectCollisions)
 {
@@ -18,6 +18,7 @@
 #include <ranges>
 #include <string>
 #include <type_traits>
+#include <utility>
 
 namespace fixed_containers
 {
@@ -78,6 +79,23 @@ TEST(FixedSet, Initializer)
     static_assert(VAL2.size() == 1);
 }
 
+TEST(FixedSet, SortedUnique)
+{
+    constexpr FixedSet<int, 10> VAL1{sorted_unique, {2, 4, 7}};
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1.contains(4));
+    static_assert(VAL1 == FixedSet<int, 10>{7, 2, 4});
+
+    static constexpr std::array<int, 3> KEYS{3, 2, 1};
+    constexpr auto VAL2 =
+        FixedSet<int, 10, std::greater<>>::from_sorted_unique(KEYS.begin(), KEYS.end());
+    static_assert(VAL2.size() == 3);
+    static_assert(*VAL2.begin() == 3);
+    static_assert(VAL2.contains(1));
+
+    EXPECT_DEATH((FixedSet<int, 2>{sorted_unique, {1, 2, 3}}), "");
+}
+
 TEST(FixedSet, FindTransparentComparator)
 {
     constexpr FixedSet<MockAComparableToB, 3, std::less<>> VAL{};
@@ -182,6 +200,91 @@ TEST(FixedSet, EqualRangeTransparentComparator)
     static_assert(VAL.equal_range(KEY_B).second == VAL.upper_bound(KEY_B));
 }
 
+TEST(FixedSet, OrderStatistics)
+{
+    using SetType =
+        FixedSet<int,
+                 30,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                 FixedIndexBasedPoolStorage,
+                 customize::SetAbortChecking<int, 30>,
+                 OrderStatisticTreeAugmentation>;
+
+    constexpr SetType VAL1{8, 2, 6, 4};
+    static_assert(*VAL1.nth(0) == 2);
+    static_assert(*VAL1.nth(3) == 8);
+    static_assert(VAL1.nth(4) == VAL1.end());
+    static_assert(VAL1.rank(6) == 2);
+    static_assert(VAL1.rank(7) == 3);
+    static_assert(VAL1.count_in_range(3, 8) == 2);
+
+    SetType var2{};
+    for (int i = 0; i < 30; i++)
+    {
+        var2.insert((i * 7) % 30);
+    }
+    for (int i = 0; i < 30; i += 4)
+    {
+        var2.erase(i);
+    }
+    for (std::size_t i = 0; i < var2.size(); i++)
+    {
+        const auto it = std::next(var2.begin(), static_cast<std::ptrdiff_t>(i));
+        EXPECT_EQ(it, var2.nth(i));
+        EXPECT_EQ(i, var2.rank(*it));
+    }
+    EXPECT_EQ(std::distance(var2.lower_bound(5), var2.lower_bound(25)),
+              var2.count_in_range(5, 25));
+}
+
+namespace
+{
+struct SumOfKeys
+{
+    using value_type = int;
+    static constexpr value_type identity() { return 0; }
+    static constexpr value_type lift(const int& key) { return key; }
+    static constexpr value_type combine(const value_type& left, const value_type& right)
+    {
+        return left + right;
+    }
+};
+}  // namespace
+
+TEST(FixedSet, Aggregates)
+{
+    using SetType =
+        FixedSet<int,
+                 30,
+                 std::less<int>,
+                 fixed_red_black_tree_detail::RedBlackTreeNodeColorCompactness::EMBEDDED_COLOR,
+                 FixedIndexBasedPoolStorage,
+                 customize::SetAbortChecking<int, 30>,
+                 SumOfKeys>;
+
+    constexpr SetType VAL1{8, 2, 6, 4};
+    static_assert(VAL1.aggregate() == 20);
+    static_assert(VAL1.aggregate_in_range(3, 8) == 10);
+    static_assert(VAL1.aggregate_before(5) == 6);
+
+    SetType var2{};
+    for (int i = 0; i < 30; i++)
+    {
+        var2.insert((i * 7) % 30);
+    }
+    for (int i = 0; i < 30; i += 4)
+    {
+        var2.erase(i);
+    }
+    int expected = 0;
+    for (auto it = var2.lower_bound(5); it != var2.lower_bound(25); ++it)
+    {
+        expected += *it;
+    }
+    EXPECT_EQ(expected, var2.aggregate_in_range(5, 25));
+}
+
 TEST(FixedSet, MaxSize)
 {
     constexpr FixedSet<int, 10> VAL1{2, 4};
@@ -410,6 +513,67 @@ TEST(FixedSet, EmplaceExceedsCapacity)
     }
 }
 
+TEST(FixedSet, InsertWithHint)
+{
+    {
+        constexpr FixedSet<int, 10> VAL = []()
+        {
+            FixedSet<int, 10> var1{};
+            for (int i = 0; i < 10; i += 2)
+            {
+                var1.insert(var1.end(), i);
+            }
+            // Right before the hint, right after it, and away from it
+            var1.insert(var1.find(4), 3);
+            var1.emplace_hint(var1.find(4), 5);
+            var1.insert(var1.begin(), 9);
+            return var1;
+        }();
+
+        static_assert(consteval_compare::equal<8, VAL.size()>);
+        static_assert(std::ranges::equal(VAL, std::array{0, 2, 3, 4, 5, 6, 8, 9}));
+    }
+
+    {
+        FixedSet<int, 10> var1{1, 5};
+        auto it = var1.insert(var1.find(5), 5);
+        ASSERT_EQ(2, var1.size());
+        ASSERT_EQ(5, *it);
+        it = var1.insert(var1.end(), 1);
+        ASSERT_EQ(2, var1.size());
+        ASSERT_EQ(1, *it);
+        it = var1.insert(var1.end(), 3);
+        ASSERT_EQ(3, var1.size());
+        ASSERT_EQ(3, *it);
+        ASSERT_EQ(5, *std::next(it));
+    }
+}
+
+TEST(FixedSet, AppendMaxAndPrependMin)
+{
+    constexpr FixedSet<int, 10> VAL1 = []()
+    {
+        FixedSet<int, 10> var1{};
+        var1.append_max(5);
+        var1.append_max(7);
+        var1.prepend_min(3);
+        var1.prepend_min(1);
+        return var1;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array{1, 3, 5, 7}));
+
+    FixedSet<int, 3> var2{};
+    auto it = var2.append_max(2);
+    ASSERT_EQ(2, *it);
+    it = var2.prepend_min(1);
+    ASSERT_EQ(1, *it);
+    ASSERT_EQ(2, *std::next(it));
+    EXPECT_DEATH(var2.append_max(2), "");
+    EXPECT_DEATH(var2.prepend_min(1), "");
+    var2.append_max(3);
+    EXPECT_DEATH(var2.append_max(4), "");
+}
+
 TEST(FixedSet, Clear)
 {
     constexpr auto VAL1 = []()
@@ -441,6 +605,24 @@ TEST(FixedSet, Erase)
     static_assert(VAL1.contains(4));
 }
 
+TEST(FixedSet, EraseTransparentComparator)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<MockAComparableToB, 5, std::less<>> var{
+            MockAComparableToB{1}, MockAComparableToB{3}, MockAComparableToB{5}};
+        auto removed_count = var.erase(MockBComparableToA{3});
+        assert_or_abort(removed_count == 1);
+        removed_count = var.erase(MockBComparableToA{4});
+        assert_or_abort(removed_count == 0);
+        return var;
+    }();
+
+    static_assert(VAL1.size() == 2);
+    static_assert(!VAL1.contains(MockBComparableToA{3}));
+    static_assert(VAL1.contains(MockBComparableToA{5}));
+}
+
 TEST(FixedSet, EraseIterator)
 {
     constexpr auto VAL1 = []()
@@ -560,6 +742,176 @@ TEST(FixedSet, EraseIf)
     static_assert(!VAL1.contains(4));
 }
 
+TEST(FixedSet, ExtractAndInsertNode)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 10> var1{2, 3, 4};
+        FixedSet<int, 3> var2{3};
+
+        auto node = var1.extract(2);
+        assert_or_abort(!node.empty() && node.value() == 2);
+        auto result = var2.insert(std::move(node));
+        assert_or_abort(result.inserted && *result.position == 2 && result.node.empty());
+
+        result = var2.insert(var1.extract(var1.find(3)));
+        assert_or_abort(!result.inserted && result.node.value() == 3);
+
+        assert_or_abort(var1.extract(5).empty());
+        return std::pair{var1, var2};
+    }();
+
+    static_assert(VAL1.first.size() == 1);
+    static_assert(VAL1.first.contains(4));
+    static_assert(VAL1.second.size() == 2);
+    static_assert(VAL1.second.contains(2));
+    static_assert(VAL1.second.contains(3));
+
+    {
+        FixedSet<int, 1> var1{1};
+        FixedSet<int, 1> var2{2};
+        EXPECT_DEATH(var2.insert(var2.cend(), var1.extract(1)), "");
+    }
+}
+
+TEST(FixedSet, Merge)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 5> var1{1, 3};
+        FixedSet<int, 10> var2{1, 2, 4, 5};
+        var1.merge(var2);
+        return std::pair{var1, var2};
+    }();
+
+    static_assert(std::ranges::equal(VAL1.first, std::array{1, 2, 3, 4, 5}));
+    static_assert(std::ranges::equal(VAL1.second, std::array{1}));
+
+    {
+        FixedSet<int, 2> var1{1};
+        FixedSet<int, 3> var2{2, 3};
+        EXPECT_DEATH(var1.merge(var2), "");
+    }
+}
+
+TEST(FixedSet, EraseBeforeAndAfter)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 10> var{1, 2, 3, 4, 5, 7};
+        assert_or_abort(var.erase_before(3) == 2);
+        assert_or_abort(var.erase_before(3) == 0);
+        assert_or_abort(var.erase_after(6) == 1);
+        assert_or_abort(var.erase_after(4) == 1);
+        return var;
+    }();
+
+    static_assert(std::ranges::equal(VAL1, std::array{3, 4}));
+
+    {
+        FixedSet<int, 30> var{};
+        for (int i = 0; i < 20; i++)
+        {
+            var.insert(i);
+        }
+        EXPECT_EQ(5, var.erase_before(5));
+        EXPECT_EQ(4, var.erase_after(15));
+        EXPECT_EQ(11, var.size());
+        EXPECT_EQ(5, *var.begin());
+        EXPECT_EQ(15, *std::prev(var.end()));
+    }
+}
+
+namespace
+{
+template <class Container, class Other>
+concept CanJoin = requires(Container container, Other other) { container.join(other); };
+
+// Joining takes the other container in its own order, so both must use the same comparator
+static_assert(CanJoin<FixedSet<int, 10>, FixedSet<int, 100>>);
+static_assert(!CanJoin<FixedSet<int, 10>, FixedSet<int, 10, std::greater<int>>>);
+}  // namespace
+
+TEST(FixedSet, SplitAndJoin)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 10> var1{1, 2, 3, 5};
+        FixedSet<int, 10> var2 = var1.split(3);
+        return std::pair{var1, var2};
+    }();
+
+    static_assert(std::ranges::equal(VAL1.first, std::array{1, 2}));
+    static_assert(std::ranges::equal(VAL1.second, std::array{3, 5}));
+
+    constexpr auto VAL2 = []()
+    {
+        FixedSet<int, 10> var1{1, 2, 3, 5};
+        auto var2 = var1.split(3);
+        var2.join(var1);
+        assert_or_abort(var1.empty());
+        var2.join(FixedSet<int, 3>{7, 8});
+        return var2;
+    }();
+
+    static_assert(std::ranges::equal(VAL2, std::array{1, 2, 3, 5, 7, 8}));
+
+    {
+        FixedSet<int, 10> var1{1, 3};
+        FixedSet<int, 10> var2{2};
+        EXPECT_DEATH(var1.join(var2), "");
+    }
+    {
+        FixedSet<int, 2> var1{1};
+        EXPECT_DEATH(var1.join(FixedSet<int, 3>{2, 3}), "");
+    }
+}
+
+TEST(FixedSet, SetAlgebra)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedSet<int, 10> var1{1, 2, 3, 5};
+        const FixedSet<int, 5> var2{2, 4, 5, 6};
+        var1.set_union(var2);
+        return var1;
+    }();
+    static_assert(std::ranges::equal(VAL1, std::array{1, 2, 3, 4, 5, 6}));
+
+    constexpr auto VAL2 = []()
+    {
+        FixedSet<int, 10> var1{1, 2, 3, 5};
+        var1.set_intersection(FixedSet<int, 5>{2, 4, 5, 6});
+        return var1;
+    }();
+    static_assert(std::ranges::equal(VAL2, std::array{2, 5}));
+
+    constexpr auto VAL3 = []()
+    {
+        FixedSet<int, 10> var1{1, 2, 3, 5};
+        var1.set_difference(FixedSet<int, 5>{2, 4, 5, 6});
+        return var1;
+    }();
+    static_assert(std::ranges::equal(VAL3, std::array{1, 3}));
+
+    static_assert((FixedSet<int, 10>{1, 2, 3, 5}.includes(FixedSet<int, 5>{2, 5})));
+    static_assert(!(FixedSet<int, 10>{1, 2, 3, 5}.includes(FixedSet<int, 5>{2, 4})));
+    static_assert((FixedSet<int, 10>{1, 2}.includes(FixedSet<int, 5>{})));
+
+    {
+        FixedSet<int, 10> var1{1, 2, 3};
+        var1.set_union(var1);
+        var1.set_intersection(var1);
+        EXPECT_EQ((FixedSet<int, 10>{1, 2, 3}), var1);
+        var1.set_difference(var1);
+        EXPECT_TRUE(var1.empty());
+    }
+    {
+        FixedSet<int, 3> var1{1, 2};
+        EXPECT_DEATH(var1.set_union(FixedSet<int, 3>{3, 4}), "");
+    }
+}
+
 TEST(FixedSet, IteratorBasic)
 {
     constexpr FixedSet<int, 10> VAL1{1, 2, 3, 4};
@@ -0,0 +1,271 @@
+#include "fixed_containers/fixed_swiss_hashtable.hpp"
+
+#include "fixed_containers/concepts.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+
+namespace fixed_containers::fixed_swiss_hashtable_detail
+{
+namespace
+{
+
+// puts the value of an int into the fingerprint bits and also into the bits used to pick the
+// group, so that `value % GROUP_COUNT` is the group the key will land in.
+struct ConvenientIntHash
+{
+    constexpr uint64_t operator()(const int& value) const
+    {
+        const uint64_t fingerprint = static_cast<uint64_t>(value) & ControlByte::FINGERPRINT_MASK;
+        const uint64_t upper = static_cast<uint64_t>(value) << ControlByte::FINGERPRINT_BITS;
+        return fingerprint | upper;
+    }
+};
+
+// everything collides into group 0 with the same fingerprint
+struct CollidingIntHash
+{
+    constexpr uint64_t operator()(const int& /*value*/) const { return 0; }
+};
+
+using IntIntTable = FixedSwissHashtable<int, int, 40, 48, ConvenientIntHash, std::equal_to<>>;
+using CollidingTable = FixedSwissHashtable<int, int, 32, 32, CollidingIntHash, std::equal_to<>>;
+using OIT = typename IntIntTable::OpaqueIndexType;
+
+static_assert(IntIntTable::GROUP_COUNT == 3);
+static_assert(IntIntTable::INTERNAL_TABLE_SIZE == 48);
+static_assert(FixedSwissHashtable<int, int, 5, 6, ConvenientIntHash, std::equal_to<>>::
+                  INTERNAL_TABLE_SIZE == 16);
+static_assert(FixedSwissHashtable<int, int, 0, 0, ConvenientIntHash, std::equal_to<>>::
+                  INTERNAL_TABLE_SIZE == 16);
+
+static_assert(IsStructuralType<IntIntTable>);
+#if defined(__clang__) && __clang_major__ >= 16
+static_assert(TriviallyCopyable<IntIntTable>);
+#endif
+static_assert(TriviallyCopyAssignable<IntIntTable>);
+static_assert(TriviallyMoveAssignable<IntIntTable>);
+static_assert(StandardLayout<IntIntTable>);
+
+template <typename Table>
+constexpr void insert_key(Table& table, int key, int value)
+{
+    const auto idx = table.opaque_index_of(key);
+    if (!table.exists(idx))
+    {
+        table.emplace(idx, key, value);
+    }
+}
+
+template <typename Table>
+constexpr bool erase_key(Table& table, int key)
+{
+    const auto idx = table.opaque_index_of(key);
+    if (!table.exists(idx))
+    {
+        return false;
+    }
+    table.erase(idx);
+    return true;
+}
+
+template <typename Table>
+constexpr bool contains_key(const Table& table, int key)
+{
+    return table.exists(table.opaque_index_of(key));
+}
+
+}  // namespace
+
+TEST(SwissGroup, Match)
+{
+    std::array<ControlByte::Type, Group::WIDTH> group{};
+    group[0] = ControlByte::full_from_hash(3);
+    group[5] = ControlByte::full_from_hash(3);
+    group[6] = ControlByte::DELETED;
+    group[15] = ControlByte::full_from_hash(7);
+
+    const GroupMask expected_match = 0b0000'0000'0010'0001;
+    const GroupMask expected_full = 0b1000'0000'0010'0001;
+    const GroupMask expected_empty = 0b0111'1111'1001'1110;
+
+    EXPECT_EQ(expected_match, Group::match_scalar(group.data(), ControlByte::full_from_hash(3)));
+    EXPECT_EQ(expected_match, Group::match(group.data(), ControlByte::full_from_hash(3)));
+    EXPECT_EQ(expected_full, Group::match_full_scalar(group.data()));
+    EXPECT_EQ(expected_full, Group::match_full(group.data()));
+    EXPECT_EQ(expected_empty, Group::match_empty(group.data()));
+    EXPECT_EQ(static_cast<GroupMask>(~expected_full & 0xFFFFU),
+              Group::match_empty_or_deleted(group.data()));
+}
+
+TEST(SwissGroup, MatchConstexpr)
+{
+    constexpr GroupMask MASK = []()
+    {
+        std::array<ControlByte::Type, Group::WIDTH> group{};
+        group[2] = ControlByte::full_from_hash(1);
+        group[9] = ControlByte::full_from_hash(1);
+        return Group::match(group.data(), ControlByte::full_from_hash(1));
+    }();
+    static_assert(MASK == 0b0000'0010'0000'0100);
+}
+
+TEST(SwissTableOperations, Emplace)
+{
+    IntIntTable table{};
+
+    const OIT idx = table.opaque_index_of(4);
+    EXPECT_FALSE(table.exists(idx));
+    // key 4 lands in group 4 % 3 == 1, in the first slot of that group
+    EXPECT_EQ(idx.slot_index, 16);
+
+    const OIT inserted = table.emplace(idx, 4, 40);
+    EXPECT_TRUE(table.exists(inserted));
+    EXPECT_EQ(inserted.slot_index, 16);
+    EXPECT_EQ(table.control_at(16), ControlByte::full_from_hash(4));
+    EXPECT_EQ(table.value(inserted), 40);
+    EXPECT_EQ(table.size(), 1);
+
+    // same group, next slot
+    const OIT second = table.emplace(table.opaque_index_of(7), 7, 70);
+    EXPECT_EQ(second.slot_index, 17);
+    EXPECT_EQ(table.value(table.opaque_index_of(7)), 70);
+    EXPECT_EQ(table.value(table.opaque_index_of(4)), 40);
+    EXPECT_FALSE(contains_key(table, 10));
+}
+
+TEST(SwissTableOperations, OverflowIntoNextGroup)
+{
+    CollidingTable table{};
+    for (int i = 0; i < 20; i++)
+    {
+        insert_key(table, i, i * 10);
+    }
+    EXPECT_EQ(table.size(), 20);
+    for (int i = 0; i < 20; i++)
+    {
+        ASSERT_TRUE(contains_key(table, i));
+        EXPECT_EQ(table.value(table.opaque_index_of(i)), i * 10);
+    }
+    EXPECT_FALSE(contains_key(table, 20));
+    EXPECT_EQ(Group::match_full(table.group_at(0)), 0xFFFFU);
+    EXPECT_EQ(Group::match_full(table.group_at(1)), 0x000FU);
+
+    // The first group has no empty slot, so erasing from it must leave a tombstone for the keys
+    // that overflowed into the second group to stay reachable.
+    EXPECT_TRUE(erase_key(table, 3));
+    EXPECT_EQ(table.control_at(3), ControlByte::DELETED);
+    EXPECT_EQ(table.IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_, 1);
+    EXPECT_FALSE(contains_key(table, 3));
+    EXPECT_TRUE(contains_key(table, 19));
+
+    // The second group has an empty slot, so there is no need for a tombstone
+    EXPECT_TRUE(erase_key(table, 18));
+    EXPECT_EQ(table.control_at(18), ControlByte::EMPTY);
+    EXPECT_TRUE(contains_key(table, 19));
+
+    // Tombstones get reused
+    insert_key(table, 100, 1000);
+    EXPECT_EQ(table.control_at(3), ControlByte::full_from_hash(0));
+    EXPECT_EQ(table.IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_, 0);
+    EXPECT_EQ(table.value(table.opaque_index_of(100)), 1000);
+}
+
+TEST(SwissTableOperations, TombstonesAreRebuilt)
+{
+    CollidingTable table{};
+    for (int i = 0; i < 32; i++)
+    {
+        insert_key(table, i, i);
+    }
+    EXPECT_EQ(table.size(), 32);
+    // Neither group has an empty slot, every erase leaves a tombstone until they get rebuilt
+    for (int i = 0; i < 9; i++)
+    {
+        EXPECT_TRUE(erase_key(table, i));
+    }
+    EXPECT_EQ(table.IMPLEMENTATION_DETAIL_DO_NOT_USE_deleted_count_, 0);
+    EXPECT_EQ(table.size(), 23);
+    EXPECT_EQ(Group::match_full(table.group_at(0)), 0xFFFFU);
+    EXPECT_EQ(Group::match_full(table.group_at(1)), 0x007FU);
+    for (int i = 0; i < 32; i++)
+    {
+        EXPECT_EQ(contains_key(table, i), i >= 9);
+    }
+}
+
+TEST(SwissTableOperations, FullTable)
+{
+    CollidingTable table{};
+    for (int i = 0; i < 32; i++)
+    {
+        insert_key(table, i, i);
+    }
+    // Probing a full table terminates and finds nothing
+    const auto idx = table.opaque_index_of(99);
+    EXPECT_FALSE(table.exists(idx));
+    EXPECT_EQ(idx.slot_index, CollidingTable::INTERNAL_TABLE_SIZE);
+    EXPECT_TRUE(contains_key(table, 31));
+}
+
+TEST(SwissTableOperations, EraseRangeAndClear)
+{
+    IntIntTable table{};
+    for (int i = 0; i < 40; i++)
+    {
+        insert_key(table, i, i);
+    }
+    EXPECT_EQ(table.size(), 40);
+
+    auto start = table.begin_index();
+    for (int i = 0; i < 10; i++)
+    {
+        start = table.next_of(start);
+    }
+    auto end = start;
+    for (int i = 0; i < 10; i++)
+    {
+        end = table.next_of(end);
+    }
+    EXPECT_EQ(table.erase_range(start, end), end);
+    EXPECT_EQ(table.size(), 30);
+    for (int i = 0; i < 40; i++)
+    {
+        EXPECT_EQ(contains_key(table, i), i < 10 || i >= 20);
+    }
+
+    table.clear();
+    EXPECT_EQ(table.size(), 0);
+    EXPECT_EQ(table.begin_index(), table.end_index());
+    for (IntIntTable::SlotIndexType slot = 0; slot < IntIntTable::INTERNAL_TABLE_SIZE; slot++)
+    {
+        EXPECT_EQ(table.control_at(slot), ControlByte::EMPTY);
+    }
+}
+
+TEST(SwissTableOperations, Constexpr)
+{
+    constexpr IntIntTable TABLE = []()
+    {
+        IntIntTable table{};
+        for (int i = 0; i < 40; i++)
+        {
+            insert_key(table, i, i * 2);
+        }
+        for (int i = 0; i < 40; i += 2)
+        {
+            erase_key(table, i);
+        }
+        return table;
+    }();
+
+    static_assert(TABLE.size() == 20);
+    static_assert(!contains_key(TABLE, 0));
+    static_assert(contains_key(TABLE, 1));
+    static_assert(TABLE.value(TABLE.opaque_index_of(39)) == 78);
+}
+
+}  // namespace fixed_containers::fixed_swiss_hashtable_detail
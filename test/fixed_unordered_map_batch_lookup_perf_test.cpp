@@ -0,0 +1,147 @@
+#include "fixed_containers/fixed_robinhood_hashtable.hpp"
+#include "fixed_containers/fixed_swiss_hashtable.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+// Large enough that the buckets and values don't fit in the cache, like a big order book
+constexpr std::size_t CAP = 1 << 20;
+constexpr std::size_t ENTRY_COUNT = 700'000;
+// Lookups per tick
+constexpr std::size_t BATCH_SIZE = 64;
+constexpr std::size_t BATCH_COUNT = 1024;
+
+using K = std::uint64_t;
+using V = std::uint64_t;
+
+template <class HashtablePolicy>
+using FixedUnorderedMapWithPolicy =
+    FixedUnorderedMap<K,
+                      V,
+                      CAP,
+                      wyhash::hash<K>,
+                      std::equal_to<K>,
+                      fixed_robinhood_hashtable_detail::default_bucket_count(CAP),
+                      customize::MapAbortChecking<K, V, CAP>,
+                      HashtablePolicy>;
+
+using RobinhoodMap = FixedUnorderedMapWithPolicy<RobinhoodHashtablePolicy<>>;
+using SwissMap = FixedUnorderedMapWithPolicy<SwissHashtablePolicy>;
+
+K key_at(std::size_t i) { return (i * 0x9E3779B97F4A7C15ULL) >> 16U; }
+
+// Each batch looks up random keys, a quarter of which are missing
+std::vector<K> make_lookup_keys()
+{
+    std::vector<K> keys(BATCH_SIZE * BATCH_COUNT);
+    std::uint64_t state = 12345;
+    for (K& key : keys)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        const std::size_t index = (state >> 33U) % ENTRY_COUNT;
+        key = (state & 3U) == 0 ? key_at(index) + 1 : key_at(index);
+    }
+    return keys;
+}
+
+template <typename MapType>
+MapType& filled_instance()
+{
+    // The maps are too large for the stack
+    static MapType instance{};
+    if (instance.empty())
+    {
+        for (std::size_t i = 0; i < ENTRY_COUNT; i++)
+        {
+            instance.try_emplace(key_at(i), i);
+        }
+    }
+    return instance;
+}
+
+template <typename MapType>
+void benchmark_find_loop(benchmark::State& state)
+{
+    const MapType& instance = filled_instance<MapType>();
+    const std::vector<K> keys = make_lookup_keys();
+    std::array<typename MapType::const_iterator, BATCH_SIZE> out{};
+
+    for (auto _ : state)
+    {
+        for (std::size_t batch = 0; batch < BATCH_COUNT; batch++)
+        {
+            const std::span<const K> batch_keys{&keys[batch * BATCH_SIZE], BATCH_SIZE};
+            for (std::size_t i = 0; i < BATCH_SIZE; i++)
+            {
+                out[i] = instance.find(batch_keys[i]);
+            }
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * BATCH_SIZE * BATCH_COUNT));
+}
+
+template <typename MapType>
+void benchmark_find_batch(benchmark::State& state)
+{
+    const MapType& instance = filled_instance<MapType>();
+    const std::vector<K> keys = make_lookup_keys();
+    std::array<typename MapType::const_iterator, BATCH_SIZE> out{};
+
+    for (auto _ : state)
+    {
+        for (std::size_t batch = 0; batch < BATCH_COUNT; batch++)
+        {
+            const std::span<const K> batch_keys{&keys[batch * BATCH_SIZE], BATCH_SIZE};
+            instance.find_batch(batch_keys, out);
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * BATCH_SIZE * BATCH_COUNT));
+}
+
+template <typename MapType>
+void benchmark_contains_batch(benchmark::State& state)
+{
+    const MapType& instance = filled_instance<MapType>();
+    const std::vector<K> keys = make_lookup_keys();
+    std::array<bool, BATCH_SIZE> out{};
+
+    for (auto _ : state)
+    {
+        for (std::size_t batch = 0; batch < BATCH_COUNT; batch++)
+        {
+            const std::span<const K> batch_keys{&keys[batch * BATCH_SIZE], BATCH_SIZE};
+            instance.contains_batch(batch_keys, out);
+            benchmark::DoNotOptimize(out);
+        }
+    }
+    state.SetItemsProcessed(
+        static_cast<std::int64_t>(state.iterations() * BATCH_SIZE * BATCH_COUNT));
+}
+
+BENCHMARK(benchmark_find_loop<RobinhoodMap>);
+BENCHMARK(benchmark_find_batch<RobinhoodMap>);
+BENCHMARK(benchmark_contains_batch<RobinhoodMap>);
+
+BENCHMARK(benchmark_find_loop<SwissMap>);
+BENCHMARK(benchmark_find_batch<SwissMap>);
+BENCHMARK(benchmark_contains_batch<SwissMap>);
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
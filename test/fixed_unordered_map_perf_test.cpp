@@ -0,0 +1,169 @@
+#include "fixed_containers/fixed_robinhood_hashtable.hpp"
+#include "fixed_containers/fixed_swiss_hashtable.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/wyhash.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+
+namespace fixed_containers
+{
+namespace
+{
+constexpr std::size_t CAP = 4096;
+constexpr std::size_t ENTRY_COUNT = 3000;
+
+using K = std::uint64_t;
+using V = std::uint64_t;
+
+template <class HashtablePolicy>
+using FixedUnorderedMapWithPolicy =
+    FixedUnorderedMap<K,
+                      V,
+                      CAP,
+                      wyhash::hash<K>,
+                      std::equal_to<K>,
+                      fixed_robinhood_hashtable_detail::default_bucket_count(CAP),
+                      customize::MapAbortChecking<K, V, CAP>,
+                      HashtablePolicy>;
+
+template <fixed_robinhood_hashtable_detail::BucketIndexing BUCKET_INDEXING>
+using RobinhoodMap = FixedUnorderedMapWithPolicy<RobinhoodHashtablePolicy<
+    fixed_robinhood_hashtable_detail::RobinhoodHashtableOptions{BUCKET_INDEXING}>>;
+
+using ModuloMap = RobinhoodMap<fixed_robinhood_hashtable_detail::BucketIndexing::MODULO>;
+using PowerOfTwoMap =
+    RobinhoodMap<fixed_robinhood_hashtable_detail::BucketIndexing::POWER_OF_TWO_MASK>;
+using FastrangeMap = RobinhoodMap<fixed_robinhood_hashtable_detail::BucketIndexing::FASTRANGE>;
+using SwissMap = FixedUnorderedMapWithPolicy<SwissHashtablePolicy>;
+using DenseMap = FixedUnorderedMapWithPolicy<
+    RobinhoodHashtablePolicy<fixed_robinhood_hashtable_detail::RobinhoodHashtableOptions{
+        .value_storage = fixed_robinhood_hashtable_detail::ValueStorage::DENSE}>>;
+
+// Spread out keys, as order ids or similar would be
+std::array<K, ENTRY_COUNT> make_keys()
+{
+    std::array<K, ENTRY_COUNT> keys{};
+    for (std::size_t i = 0; i < ENTRY_COUNT; i++)
+    {
+        keys[i] = (i * 0x9E3779B97F4A7C15ULL) >> 16U;
+    }
+    return keys;
+}
+
+const std::array<K, ENTRY_COUNT> KEYS = make_keys();
+
+template <typename MapType>
+void benchmark_map_lookup(benchmark::State& state)
+{
+    // The fixed maps are too large for the stack
+    static MapType instance{};
+    instance.clear();
+    for (const K& key : KEYS)
+    {
+        instance.try_emplace(key, key);
+    }
+
+    for (auto _ : state)
+    {
+        for (const K& key : KEYS)
+        {
+            auto it = instance.find(key);
+            benchmark::DoNotOptimize(it);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * ENTRY_COUNT));
+}
+
+template <typename MapType>
+void benchmark_map_lookup_miss(benchmark::State& state)
+{
+    static MapType instance{};
+    instance.clear();
+    for (const K& key : KEYS)
+    {
+        instance.try_emplace(key, key);
+    }
+
+    for (auto _ : state)
+    {
+        for (const K& key : KEYS)
+        {
+            bool found = instance.contains(key + 1);
+            benchmark::DoNotOptimize(found);
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * ENTRY_COUNT));
+}
+
+template <typename MapType>
+void benchmark_map_insert(benchmark::State& state)
+{
+    static MapType instance{};
+
+    for (auto _ : state)
+    {
+        instance.clear();
+        for (const K& key : KEYS)
+        {
+            instance.try_emplace(key, key);
+        }
+        benchmark::DoNotOptimize(instance);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * ENTRY_COUNT));
+}
+
+template <typename MapType>
+void benchmark_map_iterate(benchmark::State& state)
+{
+    static MapType instance{};
+    instance.clear();
+    for (const K& key : KEYS)
+    {
+        instance.try_emplace(key, key);
+    }
+
+    for (auto _ : state)
+    {
+        V sum = 0;
+        for (const auto& [key, value] : instance)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * ENTRY_COUNT));
+}
+
+BENCHMARK(benchmark_map_lookup<std::unordered_map<K, V>>);
+BENCHMARK(benchmark_map_lookup<ModuloMap>);
+BENCHMARK(benchmark_map_lookup<PowerOfTwoMap>);
+BENCHMARK(benchmark_map_lookup<FastrangeMap>);
+BENCHMARK(benchmark_map_lookup<SwissMap>);
+BENCHMARK(benchmark_map_lookup<DenseMap>);
+
+BENCHMARK(benchmark_map_lookup_miss<std::unordered_map<K, V>>);
+BENCHMARK(benchmark_map_lookup_miss<ModuloMap>);
+BENCHMARK(benchmark_map_lookup_miss<PowerOfTwoMap>);
+BENCHMARK(benchmark_map_lookup_miss<FastrangeMap>);
+BENCHMARK(benchmark_map_lookup_miss<SwissMap>);
+
+BENCHMARK(benchmark_map_insert<std::unordered_map<K, V>>);
+BENCHMARK(benchmark_map_insert<ModuloMap>);
+BENCHMARK(benchmark_map_insert<PowerOfTwoMap>);
+BENCHMARK(benchmark_map_insert<FastrangeMap>);
+BENCHMARK(benchmark_map_insert<SwissMap>);
+BENCHMARK(benchmark_map_insert<DenseMap>);
+
+BENCHMARK(benchmark_map_iterate<std::unordered_map<K, V>>);
+BENCHMARK(benchmark_map_iterate<ModuloMap>);
+BENCHMARK(benchmark_map_iterate<DenseMap>);
+}  // namespace
+}  // namespace fixed_containers
+
+BENCHMARK_MAIN();
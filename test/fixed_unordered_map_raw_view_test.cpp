@@ -189,4 +189,26 @@ TEST(FixedUnorderedMapRawView, CharCharMap)
     EXPECT_EQ(view_it, view.end());
 }
 
+TEST(FixedUnorderedMapRawView, SixteenBitIndices)
+{
+    // capacities above 255 store their linked list indices as `uint16_t`
+    static FixedUnorderedMap<int, int, 300> map{};
+    for (int i = 0; i < 280; i++)
+    {
+        map[i * 7] = i;
+    }
+
+    const FixedUnorderedMapRawView view = get_view_of_map(map);
+
+    EXPECT_EQ(map.size(), view.size());
+    auto map_it = map.begin();
+    auto view_it = view.begin();
+    for (std::size_t i = 0; i < map.size(); i++)
+    {
+        test_and_increment<int, int>(map_it, view_it);
+    }
+    EXPECT_EQ(map_it, map.end());
+    EXPECT_EQ(view_it, view.end());
+}
+
 }  // namespace fixed_containers
@@ -9,6 +9,8 @@
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/consteval_compare.hpp"
 #include "fixed_containers/fixed_map_adapter.hpp"
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_swiss_hashtable.hpp"
 #include "fixed_containers/max_size.hpp"
 #include "fixed_containers/memory.hpp"
 
@@ -18,6 +20,8 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
 #include <memory>
 #include <ranges>
@@ -68,6 +72,25 @@ static_assert(std::is_same_v<typename std::iterator_traits<ES_1::const_iterator>
 
 static_assert(std::is_same_v<ES_1::reference, ES_1::iterator::reference>);
 
+template <typename K, typename V, std::size_t MAXIMUM_SIZE>
+using FixedUnorderedSwissMap =
+    FixedUnorderedMap<K,
+                      V,
+                      MAXIMUM_SIZE,
+                      wyhash::hash<K>,
+                      std::equal_to<K>,
+                      fixed_robinhood_hashtable_detail::default_bucket_count(MAXIMUM_SIZE),
+                      customize::MapAbortChecking<K, V, MAXIMUM_SIZE>,
+                      SwissHashtablePolicy>;
+
+using ES_2 = FixedUnorderedSwissMap<int, int, 10>;
+static_assert(TriviallyCopyable<ES_2>);
+static_assert(NotTrivial<ES_2>);
+static_assert(StandardLayout<ES_2>);
+static_assert(TriviallyCopyAssignable<ES_2>);
+static_assert(TriviallyMoveAssignable<ES_2>);
+static_assert(IsStructuralType<ES_2>);
+
 using STD_UNORDERED_MAP_INT_INT = std::unordered_map<int, int>;
 static_assert(std::forward_iterator<STD_UNORDERED_MAP_INT_INT::iterator>);
 static_assert(std::forward_iterator<STD_UNORDERED_MAP_INT_INT::const_iterator>);
@@ -1587,6 +1610,591 @@ TEST(FixedUnorderedMap, ConstRef)
     static_assert(NotTriviallyCopyable<FixedUnorderedMap<int, const int&, 5>>);
 }
 
+namespace
+{
+template <fixed_robinhood_hashtable_detail::BucketIndexing BUCKET_INDEXING>
+using FixedUnorderedMapWithBucketIndexing = FixedUnorderedMap<
+    int,
+    int,
+    50,
+    wyhash::hash<int>,
+    std::equal_to<int>,
+    fixed_robinhood_hashtable_detail::default_bucket_count(50),
+    customize::MapAbortChecking<int, int, 50>,
+    RobinhoodHashtablePolicy<fixed_robinhood_hashtable_detail::RobinhoodHashtableOptions{
+        BUCKET_INDEXING}>>;
+
+template <typename MapType>
+constexpr MapType fill_and_erase_every_third()
+{
+    MapType var{};
+    for (int i = 0; i < 50; i++)
+    {
+        var[i * 11] = i;
+    }
+    for (int i = 0; i < 50; i += 3)
+    {
+        var.erase(i * 11);
+    }
+    return var;
+}
+}  // namespace
+
+TEST(FixedUnorderedMap, BucketIndexingPolicies)
+{
+    using fixed_robinhood_hashtable_detail::BucketIndexing;
+
+    constexpr auto VAL1 = fill_and_erase_every_third<
+        FixedUnorderedMapWithBucketIndexing<BucketIndexing::POWER_OF_TWO_MASK>>();
+    static_assert(consteval_compare::equal<33, VAL1.size()>);
+    static_assert(!VAL1.contains(0));
+    static_assert(VAL1.at(11) == 1);
+
+    using FastrangeMap = FixedUnorderedMapWithBucketIndexing<BucketIndexing::FASTRANGE>;
+    constexpr auto VAL2 = fill_and_erase_every_third<FastrangeMap>();
+    static_assert(consteval_compare::equal<33, VAL2.size()>);
+    static_assert(!VAL2.contains(33));
+    static_assert(VAL2.at(49 * 11) == 49);
+
+    const auto var3 = fill_and_erase_every_third<FixedUnorderedMap<int, int, 50>>();
+    EXPECT_EQ(var3, VAL1);
+    EXPECT_EQ(var3, VAL2);
+}
+
+namespace
+{
+template <typename MapType>
+concept HasStatistics = requires(const MapType& map) { map.statistics(); };
+}  // namespace
+
+TEST(FixedUnorderedMap, Statistics)
+{
+    constexpr auto VAL1 = fill_and_erase_every_third<FixedUnorderedMap<int, int, 50>>();
+    constexpr auto STATS = VAL1.statistics();
+    static_assert(STATS.size == 33);
+    static_assert(STATS.bucket_count == 65);
+    static_assert(STATS.max_displacement < 33);
+    static_assert(STATS.mean_probe_length() >= 1.0);
+
+    std::size_t histogram_total = 0;
+    std::size_t displacement_total = 0;
+    for (std::size_t i = 0; i < STATS.displacement_histogram.size(); i++)
+    {
+        histogram_total += STATS.displacement_histogram[i];
+        displacement_total += i * STATS.displacement_histogram[i];
+    }
+    EXPECT_EQ(33, histogram_total);
+    EXPECT_EQ(STATS.total_displacement, displacement_total);
+
+    // Only the robin-hood table keeps track of displacements
+    static_assert(HasStatistics<FixedUnorderedMap<int, int, 10>>);
+    static_assert(!HasStatistics<FixedUnorderedSwissMap<int, int, 10>>);
+}
+
+TEST(FixedUnorderedMap, SwissHashtablePolicy)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedUnorderedSwissMap<int, int, 40> var{};
+        for (int i = 0; i < 40; i++)
+        {
+            var[i] = i * 3;
+        }
+        for (int i = 0; i < 40; i += 3)
+        {
+            var.erase(i);
+        }
+        return var;
+    }();
+
+    static_assert(consteval_compare::equal<26, VAL1.size()>);
+    static_assert(!VAL1.contains(0));
+    static_assert(VAL1.at(1) == 3);
+    static_assert(VAL1.at(38) == 114);
+
+    // Interleave inserts and erases so that the table has to deal with tombstones
+    FixedUnorderedSwissMap<int, int, 100> var1{};
+    std::unordered_map<int, int> reference{};
+    for (int round = 0; round < 20; round++)
+    {
+        for (int i = 0; i < 100; i++)
+        {
+            const int key = (i * 7919 + round * 31) % 1000;
+            if (var1.size() < var1.max_size())
+            {
+                var1.try_emplace(key, round);
+                reference.try_emplace(key, round);
+            }
+        }
+        for (int i = 0; i < 1000; i += 2 + round % 3)
+        {
+            EXPECT_EQ(reference.erase(i), var1.erase(i));
+        }
+        EXPECT_EQ(reference.size(), var1.size());
+        for (const auto& [key, value] : reference)
+        {
+            ASSERT_TRUE(var1.contains(key));
+            EXPECT_EQ(value, var1.at(key));
+        }
+        EXPECT_EQ(reference.size(), static_cast<std::size_t>(std::ranges::distance(var1)));
+    }
+}
+
+namespace
+{
+// hashes both mock types to the same value, so they can be used for heterogeneous lookups
+struct TransparentMockHash
+{
+    using is_transparent = void;
+
+    constexpr std::uint64_t operator()(const MockAComparableToB& key) const
+    {
+        return wyhash::hash<int>{}(key.value);
+    }
+    constexpr std::uint64_t operator()(const MockBComparableToA& key) const
+    {
+        return wyhash::hash<int>{}(key.value);
+    }
+};
+
+template <typename MapType, typename Key>
+concept CanLookUp = requires(const MapType& map, const Key& key) { map.contains(key); };
+}  // namespace
+
+TEST(FixedUnorderedMap, TransparentLookup)
+{
+    using MapType =
+        FixedUnorderedMap<MockAComparableToB, int, 5, TransparentMockHash, std::equal_to<>>;
+
+    constexpr MapType VAL1{
+        {MockAComparableToB{1}, 10}, {MockAComparableToB{3}, 30}, {MockAComparableToB{5}, 50}};
+    constexpr MockBComparableToA KEY_B{3};
+    static_assert(VAL1.contains(KEY_B));
+    static_assert(!VAL1.contains(MockBComparableToA{4}));
+    static_assert(VAL1.count(KEY_B) == 1);
+    static_assert(VAL1.find(KEY_B)->second == 30);
+    static_assert(VAL1.find(MockBComparableToA{4}) == VAL1.cend());
+    static_assert(std::distance(VAL1.equal_range(KEY_B).first, VAL1.equal_range(KEY_B).second) ==
+                  1);
+    static_assert(VAL1.equal_range(MockBComparableToA{4}).first == VAL1.cend());
+
+    constexpr auto VAL2 = []()
+    {
+        MapType var{
+            {MockAComparableToB{1}, 10}, {MockAComparableToB{3}, 30}, {MockAComparableToB{5}, 50}};
+        auto removed_count = var.erase(MockBComparableToA{3});
+        assert_or_abort(removed_count == 1);
+        removed_count = var.erase(MockBComparableToA{4});
+        assert_or_abort(removed_count == 0);
+        var.find(MockBComparableToA{5})->second = 55;
+        return var;
+    }();
+    static_assert(VAL2.size() == 2);
+    static_assert(!VAL2.contains(KEY_B));
+    static_assert(VAL2.at(MockAComparableToB{5}) == 55);
+
+    // Without a transparent hash and key equality, only `K` is accepted
+    using NonTransparentMapType =
+        FixedUnorderedMap<MockAComparableToB, int, 5, TransparentMockHash>;
+    static_assert(!CanLookUp<NonTransparentMapType, MockBComparableToA>);
+    static_assert(CanLookUp<NonTransparentMapType, MockAComparableToB>);
+    static_assert(CanLookUp<MapType, MockBComparableToA>);
+}
+
+TEST(FixedUnorderedMap, TransparentStringLookup)
+{
+    using KeyType = FixedString<16>;
+    FixedUnorderedMap<KeyType, int, 10, wyhash::hash<KeyType>, std::equal_to<>> var1{};
+    var1["one"] = 1;
+    var1["two"] = 2;
+
+    // all string types hash identically
+    const std::string_view view = "two";
+    EXPECT_EQ(wyhash::hash<KeyType>{}(KeyType{"two"}), wyhash::hash<std::string_view>{}(view));
+    EXPECT_EQ(wyhash::hash<std::string>{}(std::string{"two"}), wyhash::hash<KeyType>{}(view));
+
+    EXPECT_TRUE(var1.contains(view));
+    EXPECT_EQ(2, var1.find(view)->second);
+    EXPECT_EQ(1, var1.count(std::string_view{"one"}));
+    EXPECT_EQ(var1.end(), var1.find(std::string_view{"three"}));
+    EXPECT_EQ(1, var1.erase(std::string_view{"one"}));
+    EXPECT_FALSE(var1.contains(std::string_view{"one"}));
+    EXPECT_EQ(1, var1.size());
+
+    FixedUnorderedMap<std::string, int, 10, wyhash::hash<std::string>, std::equal_to<>> var2{};
+    var2["abc"] = 3;
+    EXPECT_TRUE(var2.contains(std::string_view{"abc"}));
+    EXPECT_TRUE(var2.contains(KeyType{"abc"}));
+}
+
+TEST(FixedUnorderedMap, FindBatch)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> var{{1, 10}, {2, 20}, {4, 40}};
+        const std::array<int, 4> keys{4, 3, 2, 1};
+        std::array<bool, 4> found{};
+        var.contains_batch(keys, found);
+        std::array<decltype(var)::iterator, 4> its{};
+        var.find_batch(keys, its);
+        its[0]->second = 44;
+        return std::pair{var, found};
+    }();
+    static_assert(VAL1.first.at(4) == 44);
+    static_assert(VAL1.second == std::array<bool, 4>{true, false, true, true});
+
+    // More keys than fit in a single batch, half of them missing
+    FixedUnorderedMap<int, int, 100> var2{};
+    for (int i = 0; i < 100; i++)
+    {
+        var2[i * 2] = i;
+    }
+    std::array<int, 150> keys{};
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        keys[i] = static_cast<int>(i);
+    }
+
+    std::array<FixedUnorderedMap<int, int, 100>::const_iterator, 150> its{};
+    std::as_const(var2).find_batch(keys, its);
+    std::array<bool, 150> found{};
+    var2.contains_batch(keys, found);
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        EXPECT_EQ(var2.find(keys[i]), its[i]);
+        EXPECT_EQ(var2.contains(keys[i]), found[i]);
+    }
+
+    std::array<int, 20> swiss_keys{};
+    for (std::size_t i = 0; i < swiss_keys.size(); i++)
+    {
+        swiss_keys[i] = static_cast<int>(i);
+    }
+    FixedUnorderedSwissMap<int, int, 10> var3{{3, 30}, {7, 70}, {11, 110}};
+    std::array<FixedUnorderedSwissMap<int, int, 10>::iterator, 20> swiss_its{};
+    var3.find_batch(swiss_keys, swiss_its);
+    for (std::size_t i = 0; i < swiss_keys.size(); i++)
+    {
+        EXPECT_EQ(var3.find(swiss_keys[i]), swiss_its[i]);
+    }
+}
+
+namespace
+{
+struct CountingHash
+{
+    static inline int call_count = 0;
+
+    std::uint64_t operator()(const int& key) const
+    {
+        call_count++;
+        return wyhash::hash<int>{}(key);
+    }
+};
+
+template <std::size_t BUCKET_COUNT, fixed_robinhood_hashtable_detail::ValueStorage VALUE_STORAGE>
+using HashStoringMap = FixedUnorderedMap<
+    int,
+    int,
+    30,
+    CountingHash,
+    std::equal_to<int>,
+    BUCKET_COUNT,
+    customize::MapAbortChecking<int, int, 30>,
+    RobinhoodHashtablePolicy<fixed_robinhood_hashtable_detail::RobinhoodHashtableOptions{
+        .value_storage = VALUE_STORAGE, .store_hashes = true}>>;
+}  // namespace
+
+TEST(FixedUnorderedMap, PrecomputedHash)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> var{};
+        const std::uint64_t hash_of_2 = var.hash_function()(2);
+        var.try_emplace_with_hash(hash_of_2, 2, 20);
+        var.try_emplace_with_hash(var.hash_function()(4), 4, 40);
+        // already present
+        var.try_emplace_with_hash(hash_of_2, 2, 99);
+        var.find(4, var.hash_function()(4))->second = 44;
+        return var;
+    }();
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.at(2) == 20);
+    static_assert(VAL1.at(4) == 44);
+    static_assert(VAL1.contains(2, VAL1.hash_function()(2)));
+    static_assert(!VAL1.contains(3, VAL1.hash_function()(3)));
+    static_assert(VAL1.count(4, VAL1.hash_function()(4)) == 1);
+    static_assert(VAL1.find(2, VAL1.hash_function()(2))->second == 20);
+    static_assert(VAL1.find(3, VAL1.hash_function()(3)) == VAL1.cend());
+    static_assert(VAL1.hash_of(VAL1.find(4)) == VAL1.hash_function()(4));
+    static_assert(VAL1.key_eq()(4, 4));
+
+    FixedUnorderedSwissMap<int, int, 10> var2{{1, 10}, {3, 30}};
+    EXPECT_EQ(1, var2.erase(3, var2.hash_function()(3)));
+    EXPECT_EQ(0, var2.erase(3, var2.hash_function()(3)));
+    EXPECT_EQ(var2.hash_function()(1), var2.hash_of(var2.begin()));
+
+    // Maps with stored hashes can be copied into maps with other bucket counts or storage, and
+    // erased from, without hashing any key again
+    using SourceMap = HashStoringMap<40, fixed_robinhood_hashtable_detail::ValueStorage::DENSE>;
+    using DestinationMap =
+        HashStoringMap<97, fixed_robinhood_hashtable_detail::ValueStorage::LINKED_LIST>;
+    SourceMap source{};
+    for (int i = 0; i < 30; i++)
+    {
+        source.try_emplace(i * 3, i);
+    }
+    CountingHash::call_count = 0;
+
+    DestinationMap destination{};
+    for (auto it = source.cbegin(); it != source.cend(); ++it)
+    {
+        destination.try_emplace_with_hash(source.hash_of(it), it->first, it->second);
+    }
+    EXPECT_EQ(0, CountingHash::call_count);
+    EXPECT_EQ(source, destination);
+    for (auto it = destination.cbegin(); it != destination.cend(); ++it)
+    {
+        EXPECT_EQ(wyhash::hash<int>{}(it->first), destination.hash_of(it));
+    }
+    CountingHash::call_count = 0;
+
+    erase_if(destination, [](const auto& pair) { return pair.second % 2 == 0; });
+    EXPECT_EQ(15, destination.size());
+    source.erase(source.begin(), source.end());
+    EXPECT_TRUE(source.empty());
+    destination.clear();
+    EXPECT_EQ(0, CountingHash::call_count);
+
+    // Clearing drops every bucket at once, even when the hashes are not stored
+    FixedUnorderedMap<int, int, 30, CountingHash> var3{};
+    for (int i = 0; i < 30; i++)
+    {
+        var3[i] = i;
+    }
+    CountingHash::call_count = 0;
+    var3.clear();
+    EXPECT_EQ(0, CountingHash::call_count);
+    EXPECT_TRUE(var3.empty());
+    EXPECT_FALSE(var3.contains(3));
+}
+
+TEST(FixedUnorderedMap, StoredHashesHashEachNewKeyOnce)
+{
+    // The hash of the lookup is the one that gets stored
+    HashStoringMap<40, fixed_robinhood_hashtable_detail::ValueStorage::LINKED_LIST> var{};
+    CountingHash::call_count = 0;
+    var.try_emplace(1, 10);
+    var[2] = 20;
+    var.insert({3, 30});
+    var.insert_or_assign(4, 40);
+    var.emplace(5, 50);
+    EXPECT_EQ(5, CountingHash::call_count);
+    for (auto it = var.cbegin(); it != var.cend(); ++it)
+    {
+        EXPECT_EQ(wyhash::hash<int>{}(it->first), var.hash_of(it));
+    }
+}
+
+TEST(FixedUnorderedMap, ExtractAndInsertNode)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedUnorderedMap<int, int, 10> var1{{2, 20}, {3, 30}, {4, 40}};
+        FixedUnorderedSwissMap<int, int, 3> var2{{3, 31}};
+
+        auto node = var1.extract(2);
+        assert_or_abort(!node.empty() && node.key() == 2 && node.mapped() == 20);
+        auto result = var2.insert(std::move(node));
+        assert_or_abort(result.inserted && result.position->first == 2 && result.node.empty());
+
+        // The key is already present: the handle gets the entry back
+        result = var2.insert(var1.extract(var1.find(3)));
+        assert_or_abort(!result.inserted && result.position->second == 31);
+        assert_or_abort(result.node.key() == 3 && result.node.mapped() == 30);
+
+        assert_or_abort(var1.extract(5).empty());
+        return std::pair{var1, var2};
+    }();
+
+    static_assert(VAL1.first.size() == 1);
+    static_assert(VAL1.first.at(4) == 40);
+    static_assert(VAL1.second.size() == 2);
+    static_assert(VAL1.second.at(2) == 20);
+    static_assert(VAL1.second.at(3) == 31);
+
+    // The handle keeps the stored hash
+    using SourceMap = HashStoringMap<40, fixed_robinhood_hashtable_detail::ValueStorage::DENSE>;
+    using DestinationMap =
+        HashStoringMap<97, fixed_robinhood_hashtable_detail::ValueStorage::LINKED_LIST>;
+    SourceMap source{{1, 10}, {2, 20}};
+    DestinationMap destination{};
+    CountingHash::call_count = 0;
+    auto node = source.extract(source.begin());
+    EXPECT_EQ(wyhash::hash<int>{}(std::as_const(node).key()), node.key_hash());
+    destination.insert(destination.cend(), std::move(node));
+    EXPECT_EQ(0, CountingHash::call_count);
+    EXPECT_EQ(1, source.size());
+    EXPECT_EQ(1, destination.size());
+
+    // Changing the key drops the hash
+    node = destination.extract(destination.begin());
+    node.key() = 3;
+    EXPECT_FALSE(node.key_hash().has_value());
+    EXPECT_TRUE(destination.insert(std::move(node)).inserted);
+    EXPECT_TRUE(destination.contains(3));
+
+    {
+        FixedUnorderedMap<int, MockMoveableButNotCopyable, 5> var1{};
+        var1.emplace(1, MockMoveableButNotCopyable{});
+        FixedUnorderedMap<int, MockMoveableButNotCopyable, 5> var2{};
+        var2.insert(var1.extract(1));
+        EXPECT_TRUE(var1.empty());
+        EXPECT_TRUE(var2.contains(1));
+    }
+    {
+        FixedUnorderedMap<int, int, 1> var1{{1, 10}};
+        FixedUnorderedMap<int, int, 1> var2{{2, 20}};
+        EXPECT_DEATH(var2.insert(var1.extract(1)), "");
+    }
+}
+
+TEST(FixedUnorderedMap, Merge)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedUnorderedMap<int, int, 5> var1{{1, 10}, {3, 30}};
+        FixedUnorderedSwissMap<int, int, 10> var2{{1, 11}, {2, 21}, {4, 41}, {5, 51}};
+        var1.merge(var2);
+        return std::pair{var1, var2};
+    }();
+
+    static_assert(VAL1.first.size() == 5);
+    static_assert(VAL1.first.at(1) == 10);
+    static_assert(VAL1.first.at(2) == 21);
+    static_assert(VAL1.first.at(5) == 51);
+    static_assert(VAL1.second.size() == 1);
+    static_assert(VAL1.second.at(1) == 11);
+
+    // Maps with stored hashes merge without hashing any key again
+    using SourceMap = HashStoringMap<40, fixed_robinhood_hashtable_detail::ValueStorage::DENSE>;
+    using DestinationMap =
+        HashStoringMap<97, fixed_robinhood_hashtable_detail::ValueStorage::LINKED_LIST>;
+    SourceMap source{};
+    DestinationMap destination{};
+    for (int i = 0; i < 10; i++)
+    {
+        source.try_emplace(i * 3, i);
+    }
+    for (int i = 0; i < 20; i++)
+    {
+        destination.try_emplace(i * 2, -i);
+    }
+    CountingHash::call_count = 0;
+    destination.merge(source);
+    EXPECT_EQ(0, CountingHash::call_count);
+    // 0, 6, ..., 24 are in both
+    EXPECT_EQ(5, source.size());
+    EXPECT_EQ(25, destination.size());
+    EXPECT_EQ(-3, destination.at(6));
+    EXPECT_EQ(3, destination.at(9));
+    for (const auto& [key, value] : source)
+    {
+        EXPECT_EQ(0, key % 6);
+        EXPECT_EQ(key / 3, value);
+    }
+
+    {
+        FixedUnorderedMap<int, int, 2> var1{{1, 10}};
+        FixedUnorderedMap<int, int, 3> var2{{2, 20}, {3, 30}};
+        EXPECT_DEATH(var1.merge(var2), "");
+    }
+}
+
+TEST(FixedUnorderedMap, DenseValueStorage)
+{
+    using DenseMap = FixedUnorderedMap<
+        int,
+        int,
+        50,
+        wyhash::hash<int>,
+        std::equal_to<int>,
+        fixed_robinhood_hashtable_detail::default_bucket_count(50),
+        customize::MapAbortChecking<int, int, 50>,
+        RobinhoodHashtablePolicy<fixed_robinhood_hashtable_detail::RobinhoodHashtableOptions{
+            .value_storage = fixed_robinhood_hashtable_detail::ValueStorage::DENSE}>>;
+    static_assert(TriviallyCopyable<DenseMap>);
+    static_assert(IsStructuralType<DenseMap>);
+
+    constexpr auto VAL1 = fill_and_erase_every_third<DenseMap>();
+    static_assert(consteval_compare::equal<33, VAL1.size()>);
+    static_assert(!VAL1.contains(0));
+    static_assert(VAL1.at(11) == 1);
+    static_assert(VAL1.entries().size() == 33);
+
+    const auto var2 = fill_and_erase_every_third<FixedUnorderedMap<int, int, 50>>();
+    EXPECT_EQ(var2, VAL1);
+
+    // The entries are contiguous and hold exactly the elements of the map
+    DenseMap var3 = VAL1;
+    int sum_of_values = 0;
+    for (const auto& entry : var3.entries())
+    {
+        EXPECT_EQ(var3.at(entry.key()), entry.value());
+        sum_of_values += entry.value();
+    }
+    int expected_sum = 0;
+    for (const auto& [key, value] : var3)
+    {
+        expected_sum += value;
+    }
+    EXPECT_EQ(expected_sum, sum_of_values);
+
+    // Erasing while iterating visits every element exactly once
+    int visited = 0;
+    const std::size_t removed = erase_if(var3,
+                                         [&visited](const auto& pair)
+                                         {
+                                             visited++;
+                                             return pair.second % 2 == 0;
+                                         });
+    EXPECT_EQ(33, visited);
+    EXPECT_EQ(16, removed);
+    EXPECT_EQ(17, var3.size());
+    for (const auto& [key, value] : var3)
+    {
+        EXPECT_EQ(1, value % 2);
+        EXPECT_EQ(key, value * 11);
+    }
+
+    // Interleave inserts and erases so that values get moved around a lot
+    DenseMap var4{};
+    std::unordered_map<int, int> reference{};
+    for (int round = 0; round < 20; round++)
+    {
+        for (int i = 0; i < 50; i++)
+        {
+            const int key = (i * 7919 + round * 31) % 200;
+            if (var4.size() < var4.max_size())
+            {
+                var4.try_emplace(key, round);
+                reference.try_emplace(key, round);
+            }
+        }
+        for (int i = 0; i < 200; i += 2 + round % 3)
+        {
+            EXPECT_EQ(reference.erase(i), var4.erase(i));
+        }
+        EXPECT_EQ(reference.size(), var4.size());
+        for (const auto& [key, value] : reference)
+        {
+            ASSERT_TRUE(var4.contains(key));
+            EXPECT_EQ(value, var4.at(key));
+        }
+        EXPECT_EQ(reference.size(), static_cast<std::size_t>(std::ranges::distance(var4)));
+    }
+}
+
 namespace
 {
 template <FixedUnorderedMap<int, int, 5> /*INSTANCE*/>
@@ -1918,7 +2526,10 @@ using FixedUnorderedMapInstanceCheckTypes = testing::Types<
     std::unordered_map<InstanceCounterNonTrivialAssignment, InstanceCounterNonTrivialAssignment>,
     std::unordered_map<InstanceCounterTrivialAssignment, InstanceCounterTrivialAssignment>,
     FixedUnorderedMap<InstanceCounterNonTrivialAssignment, InstanceCounterNonTrivialAssignment, 17>,
-    FixedUnorderedMap<InstanceCounterTrivialAssignment, InstanceCounterTrivialAssignment, 17>>;
+    FixedUnorderedMap<InstanceCounterTrivialAssignment, InstanceCounterTrivialAssignment, 17>,
+    FixedUnorderedSwissMap<InstanceCounterNonTrivialAssignment,
+                           InstanceCounterNonTrivialAssignment,
+                           17>>;
 
 INSTANTIATE_TYPED_TEST_SUITE_P(FixedUnorderedMap,
                                FixedUnorderedMapInstanceCheckFixture,
@@ -0,0 +1,265 @@
+#include "fixed_containers/fixed_unordered_multimap.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedUnorderedMultiMap<int, int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+
+static_assert(std::forward_iterator<ES_1::iterator>);
+static_assert(std::forward_iterator<ES_1::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::iterator>, std::pair<const int&, int&>>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::const_iterator>,
+                             std::pair<const int&, const int&>>);
+
+// One value per key is the same memory as a map, no matter how many values a key ends up having
+static_assert(sizeof(ES_1) == sizeof(FixedUnorderedMap<int, int, 10>));
+
+template <typename MultiMapType>
+std::vector<int> values_of(const MultiMapType& map, int key)
+{
+    std::vector<int> values{};
+    auto [first, last] = map.equal_range(key);
+    for (; first != last; ++first)
+    {
+        EXPECT_EQ(key, first->first);
+        values.push_back(first->second);
+    }
+    return values;
+}
+}  // namespace
+
+TEST(FixedUnorderedMultiMap, DefaultConstructor)
+{
+    constexpr ES_1 VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.count(1) == 0);
+    static_assert(VAL1.equal_range(1).first == VAL1.cend());
+}
+
+TEST(FixedUnorderedMultiMap, Initializer)
+{
+    constexpr FixedUnorderedMultiMap<int, int, 10> VAL1{{2, 20}, {4, 40}, {2, 21}};
+    static_assert(VAL1.size() == 3);
+    static_assert(VAL1.count(2) == 2);
+    static_assert(VAL1.count(4) == 1);
+
+    constexpr auto VAL2 = make_fixed_unordered_multimap<int, int>({{1, 10}, {1, 11}, {1, 12}});
+    static_assert(VAL2.max_size() == 3);
+    static_assert(VAL2.count(1) == 3);
+}
+
+TEST(FixedUnorderedMultiMap, Insert)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedUnorderedMultiMap<int, int, 10> var{};
+        var.insert({2, 20});
+        var.insert({3, 30});
+        var.insert({2, 21});
+        var.emplace(2, 22);
+        var.insert({3, 31});
+        return var;
+    }();
+
+    static_assert(consteval_compare::equal<5, VAL1.size()>);
+    static_assert(VAL1.count(2) == 3);
+    static_assert(VAL1.count(3) == 2);
+    static_assert(VAL1.count(4) == 0);
+    static_assert(VAL1.contains(3));
+    static_assert(!VAL1.contains(4));
+    static_assert(VAL1.find(2)->second == 20);
+
+    // The values of a key are a single run in insertion order, and insert returns the new one
+    EXPECT_EQ((std::vector<int>{20, 21, 22}), values_of(VAL1, 2));
+    EXPECT_EQ((std::vector<int>{30, 31}), values_of(VAL1, 3));
+
+    FixedUnorderedMultiMap<int, int, 10> var2{};
+    var2.insert({5, 50});
+    auto it = var2.insert({5, 51});
+    EXPECT_EQ(51, it->second);
+    it->second = 52;
+    EXPECT_EQ((std::vector<int>{50, 52}), values_of(var2, 5));
+}
+
+TEST(FixedUnorderedMultiMap, SharedCapacity)
+{
+    // Any mix of keys and values per key fits, as long as the total does
+    constexpr auto VAL1 = []()
+    {
+        FixedUnorderedMultiMap<int, int, 8> var{};
+        for (int i = 0; i < 7; i++)
+        {
+            var.insert({1, i});
+        }
+        var.insert({2, 0});
+        return var;
+    }();
+    static_assert(is_full(VAL1));
+    static_assert(VAL1.count(1) == 7);
+    static_assert(VAL1.count(2) == 1);
+}
+
+TEST(FixedUnorderedMultiMap, InsertExceedsCapacity)
+{
+    FixedUnorderedMultiMap<int, int, 2> var1{{1, 10}, {1, 11}};
+    EXPECT_DEATH(var1.insert({1, 12}), "");
+    EXPECT_DEATH(var1.insert({2, 20}), "");
+}
+
+TEST(FixedUnorderedMultiMap, EraseKey)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedUnorderedMultiMap<int, int, 10> var{{2, 20}, {3, 30}, {2, 21}, {2, 22}, {4, 40}};
+        var.erase(2);
+        return var;
+    }();
+    static_assert(VAL1.size() == 2);
+    static_assert(!VAL1.contains(2));
+    static_assert(VAL1.count(3) == 1);
+
+    FixedUnorderedMultiMap<int, int, 10> var2{{2, 20}, {3, 30}, {2, 21}, {2, 22}, {4, 40}};
+    EXPECT_EQ(3, var2.erase(2));
+    EXPECT_EQ(0, var2.erase(2));
+    EXPECT_EQ(1, var2.erase(4));
+    EXPECT_EQ(1, var2.size());
+}
+
+TEST(FixedUnorderedMultiMap, EraseIterator)
+{
+    FixedUnorderedMultiMap<int, int, 10> var1{{2, 20}, {3, 30}, {2, 21}, {2, 22}, {3, 31}};
+
+    // Erasing a value in the middle of its key's run only erases that one
+    auto it = std::next(var1.equal_range(2).first);
+    EXPECT_EQ(21, it->second);
+    it = var1.erase(it);
+    EXPECT_EQ(22, it->second);
+    EXPECT_EQ((std::vector<int>{20, 22}), values_of(var1, 2));
+
+    auto [first, last] = var1.equal_range(3);
+    it = var1.erase(first, last);
+    EXPECT_EQ(last, it);
+    EXPECT_FALSE(var1.contains(3));
+    EXPECT_EQ(2, var1.size());
+
+    const std::size_t removed =
+        erase_if(var1, [](const auto& pair) { return pair.second % 20 == 0; });
+    EXPECT_EQ(1, removed);
+    EXPECT_EQ((std::vector<int>{22}), values_of(var1, 2));
+}
+
+TEST(FixedUnorderedMultiMap, Equality)
+{
+    constexpr FixedUnorderedMultiMap<int, int, 10> VAL1{{1, 10}, {1, 11}, {2, 20}};
+    constexpr FixedUnorderedMultiMap<int, int, 10> VAL2{{2, 20}, {1, 11}, {1, 10}};
+    constexpr FixedUnorderedMultiMap<int, int, 10> VAL3{{1, 10}, {1, 10}, {2, 20}};
+    constexpr FixedUnorderedMultiMap<int, int, 10> VAL4{{1, 10}, {1, 11}};
+
+    static_assert(VAL1 == VAL2);
+    static_assert(VAL1 != VAL3);
+    static_assert(VAL1 != VAL4);
+}
+
+TEST(FixedUnorderedMultiMap, Clear)
+{
+    FixedUnorderedMultiMap<int, int, 10> var1{{1, 10}, {1, 11}, {2, 20}};
+    var1.clear();
+    EXPECT_TRUE(var1.empty());
+    EXPECT_EQ(0, var1.count(1));
+    var1.insert({1, 12});
+    EXPECT_EQ((std::vector<int>{12}), values_of(var1, 1));
+}
+
+TEST(FixedUnorderedMultiMap, AgainstStdUnorderedMultimap)
+{
+    // Few keys, so that the runs of equal keys get long and get shifted around by other keys
+    using StoringMultiMap = FixedUnorderedMultiMap<
+        int,
+        int,
+        100,
+        wyhash::hash<int>,
+        std::equal_to<int>,
+        fixed_robinhood_hashtable_detail::default_bucket_count(100),
+        customize::MapAbortChecking<int, int, 100>,
+        RobinhoodHashtablePolicy<
+            fixed_robinhood_hashtable_detail::RobinhoodHashtableOptions{.store_hashes = true}>>;
+    FixedUnorderedMultiMap<int, int, 100> var1{};
+    StoringMultiMap var2{};
+    std::unordered_multimap<int, int> reference{};
+    for (int round = 0; round < 20; round++)
+    {
+        for (int i = 0; var1.size() < var1.max_size(); i++)
+        {
+            const int key = (i * 7919 + round * 31) % 23;
+            var1.insert({key, round * 1000 + i});
+            var2.insert({key, round * 1000 + i});
+            reference.insert({key, round * 1000 + i});
+        }
+        for (int key = round % 3; key < 23; key += 3)
+        {
+            EXPECT_EQ(reference.erase(key), var1.erase(key));
+            var2.erase(key);
+        }
+        auto predicate = [round](const auto& pair) { return pair.second % 7 == round % 7; };
+        erase_if(var1, predicate);
+        erase_if(var2, predicate);
+        std::erase_if(reference, predicate);
+
+        ASSERT_EQ(reference.size(), var1.size());
+        EXPECT_EQ(var1, var2);
+        for (int key = 0; key < 23; key++)
+        {
+            std::vector<int> expected{};
+            auto [first, last] = reference.equal_range(key);
+            for (; first != last; ++first)
+            {
+                expected.push_back(first->second);
+            }
+            std::vector<int> actual = values_of(var1, key);
+            ASSERT_EQ(expected.size(), var1.count(key));
+            std::ranges::sort(expected);
+            std::ranges::sort(actual);
+            EXPECT_EQ(expected, actual);
+        }
+        EXPECT_EQ(reference.size(), static_cast<std::size_t>(std::ranges::distance(var1)));
+    }
+}
+
+namespace
+{
+template <FixedUnorderedMultiMap<int, int, 5> /*INSTANCE*/>
+struct FixedUnorderedMultiMapInstanceCanBeUsedAsATemplateParameter
+{
+};
+}  // namespace
+
+TEST(FixedUnorderedMultiMap, UsageAsTemplateParameter)
+{
+    static constexpr FixedUnorderedMultiMap<int, int, 5> INSTANCE1{{1, 10}, {1, 11}};
+    const FixedUnorderedMultiMapInstanceCanBeUsedAsATemplateParameter<INSTANCE1> my_struct{};
+    static_cast<void>(my_struct);
+}
+
+}  // namespace fixed_containers
@@ -0,0 +1,116 @@
+#include "fixed_containers/fixed_unordered_multiset.hpp"
+
+#include "fixed_containers/concepts.hpp"
+#include "fixed_containers/consteval_compare.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <unordered_set>
+
+namespace fixed_containers
+{
+namespace
+{
+using ES_1 = FixedUnorderedMultiSet<int, 10>;
+static_assert(TriviallyCopyable<ES_1>);
+static_assert(NotTrivial<ES_1>);
+static_assert(StandardLayout<ES_1>);
+static_assert(IsStructuralType<ES_1>);
+static_assert(TriviallyCopyAssignable<ES_1>);
+static_assert(TriviallyMoveAssignable<ES_1>);
+
+static_assert(std::forward_iterator<ES_1::const_iterator>);
+static_assert(std::is_same_v<std::iter_reference_t<ES_1::const_iterator>, const int&>);
+}  // namespace
+
+TEST(FixedUnorderedMultiSet, DefaultConstructor)
+{
+    constexpr ES_1 VAL1{};
+    static_assert(VAL1.empty());
+    static_assert(VAL1.count(1) == 0);
+}
+
+TEST(FixedUnorderedMultiSet, Insert)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedUnorderedMultiSet<int, 10> var{};
+        var.insert(2);
+        var.insert(3);
+        var.insert(2);
+        var.emplace(2);
+        return var;
+    }();
+
+    static_assert(consteval_compare::equal<4, VAL1.size()>);
+    static_assert(VAL1.count(2) == 3);
+    static_assert(VAL1.count(3) == 1);
+    static_assert(VAL1.count(4) == 0);
+    static_assert(VAL1.contains(2));
+    static_assert(*VAL1.find(3) == 3);
+    static_assert(VAL1.find(4) == VAL1.cend());
+    static_assert(std::distance(VAL1.equal_range(2).first, VAL1.equal_range(2).second) == 3);
+
+    constexpr auto VAL2 = make_fixed_unordered_multiset<int>({7, 7, 8});
+    static_assert(VAL2.max_size() == 3);
+    static_assert(VAL2.count(7) == 2);
+}
+
+TEST(FixedUnorderedMultiSet, Erase)
+{
+    FixedUnorderedMultiSet<int, 10> var1{1, 2, 1, 3, 1, 2};
+
+    auto it = var1.erase(std::next(var1.equal_range(1).first));
+    EXPECT_EQ(1, *it);
+    EXPECT_EQ(2, var1.count(1));
+
+    EXPECT_EQ(2, var1.erase(2));
+    EXPECT_EQ(0, var1.erase(2));
+    EXPECT_EQ(3, var1.size());
+
+    const std::size_t removed = erase_if(var1, [](int key) { return key == 1; });
+    EXPECT_EQ(2, removed);
+    EXPECT_EQ(1, var1.size());
+    EXPECT_TRUE(var1.contains(3));
+}
+
+TEST(FixedUnorderedMultiSet, Equality)
+{
+    constexpr FixedUnorderedMultiSet<int, 10> VAL1{1, 1, 2};
+    constexpr FixedUnorderedMultiSet<int, 10> VAL2{2, 1, 1};
+    constexpr FixedUnorderedMultiSet<int, 10> VAL3{1, 2, 2};
+
+    static_assert(VAL1 == VAL2);
+    static_assert(VAL1 != VAL3);
+}
+
+TEST(FixedUnorderedMultiSet, AgainstStdUnorderedMultiset)
+{
+    FixedUnorderedMultiSet<int, 100> var1{};
+    std::unordered_multiset<int> reference{};
+    for (int round = 0; round < 20; round++)
+    {
+        for (int i = 0; var1.size() < var1.max_size(); i++)
+        {
+            const int key = (i * 7919 + round * 31) % 29;
+            var1.insert(key);
+            reference.insert(key);
+        }
+        for (int key = round % 4; key < 29; key += 4)
+        {
+            EXPECT_EQ(reference.erase(key), var1.erase(key));
+        }
+        ASSERT_EQ(reference.size(), var1.size());
+        for (int key = 0; key < 29; key++)
+        {
+            EXPECT_EQ(reference.count(key), var1.count(key));
+            auto [first, last] = var1.equal_range(key);
+            EXPECT_EQ(reference.count(key), static_cast<std::size_t>(std::distance(first, last)));
+        }
+    }
+}
+
+}  // namespace fixed_containers
@@ -5,7 +5,9 @@
 #include "fixed_containers/assert_or_abort.hpp"
 #include "fixed_containers/concepts.hpp"
 #include "fixed_containers/consteval_compare.hpp"
+#include "fixed_containers/fixed_inline_key_hashtable.hpp"
 #include "fixed_containers/fixed_set_adapter.hpp"
+#include "fixed_containers/fixed_swiss_hashtable.hpp"
 #include "fixed_containers/max_size.hpp"
 
 #include <gtest/gtest.h>
@@ -14,10 +16,14 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
 #include <ranges>
 #include <string>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace fixed_containers
 {
@@ -669,6 +675,319 @@ TEST(FixedUnorderedSet, SetIntersection)
     static_assert(!VAL1.contains(4));
 }
 
+TEST(FixedUnorderedSet, SwissHashtablePolicy)
+{
+    using SwissSet = FixedUnorderedSet<int,
+                                       30,
+                                       wyhash::hash<int>,
+                                       std::equal_to<int>,
+                                       fixed_robinhood_hashtable_detail::default_bucket_count(30),
+                                       customize::SetAbortChecking<int, 30>,
+                                       SwissHashtablePolicy>;
+    static_assert(TriviallyCopyable<SwissSet>);
+    static_assert(StandardLayout<SwissSet>);
+    static_assert(IsStructuralType<SwissSet>);
+
+    constexpr SwissSet VAL1 = []()
+    {
+        SwissSet var{};
+        for (int i = 0; i < 30; i++)
+        {
+            var.insert(i * 5);
+        }
+        erase_if(var, [](int key) { return key % 2 == 0; });
+        return var;
+    }();
+
+    static_assert(consteval_compare::equal<15, VAL1.size()>);
+    static_assert(VAL1.contains(5));
+    static_assert(!VAL1.contains(10));
+    static_assert(!VAL1.contains(7));
+
+    SwissSet var2{VAL1};
+    var2.insert(10);
+    EXPECT_EQ(16, var2.size());
+    EXPECT_TRUE(var2.contains(10));
+    EXPECT_EQ(VAL1.size() + 1, static_cast<std::size_t>(std::ranges::distance(var2)));
+    var2.clear();
+    EXPECT_TRUE(var2.empty());
+    EXPECT_FALSE(var2.contains(5));
+}
+
+TEST(FixedUnorderedSet, InlineKeyHashtablePolicy)
+{
+    using InlineKeySet = FixedUnorderedSet<int,
+                                           30,
+                                           wyhash::hash<int>,
+                                           std::equal_to<int>,
+                                           fixed_robinhood_hashtable_detail::default_bucket_count(30),
+                                           customize::SetAbortChecking<int, 30>,
+                                           InlineKeyHashtablePolicy>;
+    static_assert(TriviallyCopyable<InlineKeySet>);
+    static_assert(StandardLayout<InlineKeySet>);
+    static_assert(IsStructuralType<InlineKeySet>);
+
+    constexpr InlineKeySet VAL1 = []()
+    {
+        InlineKeySet var{};
+        for (int i = 0; i < 30; i++)
+        {
+            var.insert(i * 5);
+        }
+        erase_if(var, [](int key) { return key % 2 == 0; });
+        return var;
+    }();
+
+    static_assert(consteval_compare::equal<15, VAL1.size()>);
+    static_assert(VAL1.contains(5));
+    static_assert(!VAL1.contains(10));
+    static_assert(!VAL1.contains(7));
+    static_assert(VAL1 == FixedUnorderedSet<int, 30>{5, 15, 25, 35, 45, 55, 65, 75,
+                                                      85, 95, 105, 115, 125, 135, 145});
+
+    InlineKeySet var2{VAL1};
+    var2.insert(10);
+    EXPECT_EQ(16, var2.size());
+    EXPECT_TRUE(var2.contains(10));
+    EXPECT_EQ(VAL1.size() + 1, static_cast<std::size_t>(std::ranges::distance(var2)));
+    // Erasing a range shifts keys back into the erased buckets, which must still all get erased
+    const auto erased_count = std::distance(var2.find(5), var2.cend());
+    EXPECT_EQ(var2.cend(), var2.erase(var2.find(5), var2.cend()));
+    EXPECT_EQ(16, static_cast<std::ptrdiff_t>(var2.size()) + erased_count);
+    EXPECT_FALSE(var2.contains(5));
+    var2.clear();
+    EXPECT_TRUE(var2.empty());
+    EXPECT_FALSE(var2.contains(5));
+}
+
+namespace
+{
+// hashes both mock types to the same value, so they can be used for heterogeneous lookups
+struct TransparentMockHash
+{
+    using is_transparent = void;
+
+    constexpr std::uint64_t operator()(const MockAComparableToB& key) const
+    {
+        return wyhash::hash<int>{}(key.value);
+    }
+    constexpr std::uint64_t operator()(const MockBComparableToA& key) const
+    {
+        return wyhash::hash<int>{}(key.value);
+    }
+};
+}  // namespace
+
+TEST(FixedUnorderedSet, ExtractAndInsertNode)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedUnorderedSet<int, 10> var1{2, 3, 4};
+        FixedUnorderedSet<int, 3> var2{3};
+
+        auto node = var1.extract(2);
+        assert_or_abort(!node.empty() && node.value() == 2);
+        auto result = var2.insert(std::move(node));
+        assert_or_abort(result.inserted && *result.position == 2 && result.node.empty());
+
+        result = var2.insert(var1.extract(var1.find(3)));
+        assert_or_abort(!result.inserted && result.node.value() == 3);
+
+        assert_or_abort(var1.extract(5).empty());
+        return std::pair{var1, var2};
+    }();
+
+    static_assert(VAL1.first.size() == 1);
+    static_assert(VAL1.first.contains(4));
+    static_assert(VAL1.second.size() == 2);
+    static_assert(VAL1.second.contains(2));
+    static_assert(VAL1.second.contains(3));
+
+    {
+        FixedUnorderedSet<int, 1> var1{1};
+        FixedUnorderedSet<int, 1> var2{2};
+        EXPECT_DEATH(var2.insert(var2.cend(), var1.extract(1)), "");
+    }
+}
+
+TEST(FixedUnorderedSet, Merge)
+{
+    using InlineKeySet = FixedUnorderedSet<int,
+                                           30,
+                                           wyhash::hash<int>,
+                                           std::equal_to<int>,
+                                           fixed_robinhood_hashtable_detail::default_bucket_count(30),
+                                           customize::SetAbortChecking<int, 30>,
+                                           InlineKeyHashtablePolicy>;
+    using SwissSet = FixedUnorderedSet<int,
+                                       10,
+                                       wyhash::hash<int>,
+                                       std::equal_to<int>,
+                                       fixed_robinhood_hashtable_detail::default_bucket_count(10),
+                                       customize::SetAbortChecking<int, 10>,
+                                       SwissHashtablePolicy>;
+    constexpr auto VAL1 = []()
+    {
+        InlineKeySet var1{1, 3};
+        FixedUnorderedSet<int, 10> var2{1, 2, 4, 5};
+        var1.merge(var2);
+        SwissSet var3{5, 6};
+        var1.merge(var3);
+        return std::tuple{var1, var2, var3};
+    }();
+
+    static_assert(std::get<0>(VAL1) == FixedUnorderedSet<int, 10>{1, 2, 3, 4, 5, 6});
+    static_assert(std::get<1>(VAL1) == FixedUnorderedSet<int, 10>{1});
+    static_assert(std::get<2>(VAL1) == FixedUnorderedSet<int, 10>{5});
+
+    {
+        FixedUnorderedSet<int, 2> var1{1};
+        FixedUnorderedSet<int, 3> var2{2, 3};
+        EXPECT_DEATH(var1.merge(var2), "");
+    }
+}
+
+TEST(FixedUnorderedSet, TransparentLookup)
+{
+    using SetType = FixedUnorderedSet<MockAComparableToB, 5, TransparentMockHash, std::equal_to<>>;
+
+    constexpr SetType VAL1{MockAComparableToB{1}, MockAComparableToB{3}, MockAComparableToB{5}};
+    constexpr MockBComparableToA KEY_B{3};
+    static_assert(VAL1.contains(KEY_B));
+    static_assert(!VAL1.contains(MockBComparableToA{4}));
+    static_assert(VAL1.count(KEY_B) == 1);
+    static_assert(VAL1.find(KEY_B)->value == 3);
+    static_assert(VAL1.find(MockBComparableToA{4}) == VAL1.cend());
+    static_assert(std::distance(VAL1.equal_range(KEY_B).first, VAL1.equal_range(KEY_B).second) ==
+                  1);
+
+    constexpr auto VAL2 = []()
+    {
+        SetType var{MockAComparableToB{1}, MockAComparableToB{3}, MockAComparableToB{5}};
+        auto removed_count = var.erase(MockBComparableToA{3});
+        assert_or_abort(removed_count == 1);
+        removed_count = var.erase(MockBComparableToA{4});
+        assert_or_abort(removed_count == 0);
+        return var;
+    }();
+    static_assert(VAL2.size() == 2);
+    static_assert(!VAL2.contains(KEY_B));
+    static_assert(VAL2.contains(MockBComparableToA{5}));
+}
+
+TEST(FixedUnorderedSet, FindBatch)
+{
+    constexpr auto VAL1 = []()
+    {
+        const FixedUnorderedSet<int, 10> var{1, 2, 4};
+        const std::array<int, 4> keys{4, 3, 2, 1};
+        std::array<bool, 4> found{};
+        var.contains_batch(keys, found);
+        return found;
+    }();
+    static_assert(VAL1 == std::array<bool, 4>{true, false, true, true});
+
+    FixedUnorderedSet<int, 100> var2{};
+    for (int i = 0; i < 100; i++)
+    {
+        var2.insert(i * 3);
+    }
+    std::array<int, 120> keys{};
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        keys[i] = static_cast<int>(i);
+    }
+    std::array<FixedUnorderedSet<int, 100>::const_iterator, 120> its{};
+    var2.find_batch(keys, its);
+    for (std::size_t i = 0; i < keys.size(); i++)
+    {
+        EXPECT_EQ(var2.find(keys[i]), its[i]);
+    }
+}
+
+TEST(FixedUnorderedSet, PrecomputedHash)
+{
+    constexpr auto VAL1 = []()
+    {
+        FixedUnorderedSet<int, 10> var{};
+        const std::uint64_t hash_of_2 = var.hash_function()(2);
+        var.insert_with_hash(hash_of_2, 2);
+        var.insert_with_hash(var.hash_function()(4), 4);
+        var.insert_with_hash(var.hash_function()(6), 6);
+        // already present
+        var.insert_with_hash(hash_of_2, 2);
+        var.erase(6, var.hash_function()(6));
+        return var;
+    }();
+    static_assert(VAL1.size() == 2);
+    static_assert(VAL1.contains(2, VAL1.hash_function()(2)));
+    static_assert(!VAL1.contains(6, VAL1.hash_function()(6)));
+    static_assert(VAL1.count(4, VAL1.hash_function()(4)) == 1);
+    static_assert(*VAL1.find(4, VAL1.hash_function()(4)) == 4);
+    static_assert(VAL1.find(3, VAL1.hash_function()(3)) == VAL1.cend());
+    static_assert(VAL1.hash_of(VAL1.find(4)) == VAL1.hash_function()(4));
+
+    // Copy into a set with a different bucket count and stored hashes, reusing the hashes
+    using StoringSet = FixedUnorderedSet<
+        int,
+        10,
+        wyhash::hash<int>,
+        std::equal_to<int>,
+        31,
+        customize::SetAbortChecking<int, 10>,
+        RobinhoodHashtablePolicy<fixed_robinhood_hashtable_detail::RobinhoodHashtableOptions{
+            .store_hashes = true}>>;
+    StoringSet var2{};
+    for (auto it = VAL1.cbegin(); it != VAL1.cend(); ++it)
+    {
+        var2.insert_with_hash(VAL1.hash_of(it), *it);
+    }
+    EXPECT_EQ(VAL1, var2);
+    EXPECT_EQ(var2.hash_function()(4), var2.hash_of(var2.find(4)));
+    var2.erase(var2.find(2));
+    EXPECT_FALSE(var2.contains(2));
+    EXPECT_TRUE(var2.contains(4));
+}
+
+TEST(FixedUnorderedSet, DenseValueStorage)
+{
+    using DenseSet = FixedUnorderedSet<
+        int,
+        30,
+        wyhash::hash<int>,
+        std::equal_to<int>,
+        fixed_robinhood_hashtable_detail::default_bucket_count(30),
+        customize::SetAbortChecking<int, 30>,
+        RobinhoodHashtablePolicy<fixed_robinhood_hashtable_detail::RobinhoodHashtableOptions{
+            .value_storage = fixed_robinhood_hashtable_detail::ValueStorage::DENSE}>>;
+    static_assert(TriviallyCopyable<DenseSet>);
+    static_assert(IsStructuralType<DenseSet>);
+
+    constexpr DenseSet VAL1 = []()
+    {
+        DenseSet var{};
+        for (int i = 0; i < 30; i++)
+        {
+            var.insert(i * 5);
+        }
+        erase_if(var, [](int key) { return key % 2 == 0; });
+        return var;
+    }();
+
+    static_assert(consteval_compare::equal<15, VAL1.size()>);
+    static_assert(VAL1.contains(5));
+    static_assert(!VAL1.contains(10));
+    static_assert(VAL1.entries().size() == 15);
+    static_assert(VAL1.statistics().size == 15);
+    static_assert(VAL1.statistics().bucket_count == 39);
+
+    for (const auto& entry : VAL1.entries())
+    {
+        EXPECT_EQ(5, entry.key() % 10);
+    }
+    EXPECT_EQ(VAL1.size(), static_cast<std::size_t>(std::ranges::distance(VAL1)));
+}
+
 namespace
 {
 template <FixedUnorderedSet<int, 5> /*INSTANCE*/>
@@ -0,0 +1,41 @@
+#include "fixed_containers/index_width.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace fixed_containers
+{
+TEST(IndexWidth, SmallestIndexType)
+{
+    // The all-ones value is left for the sentinel
+    static_assert(std::is_same_v<index_width::SmallestIndexType<1>, std::uint8_t>);
+    static_assert(std::is_same_v<index_width::SmallestIndexType<255>, std::uint8_t>);
+    static_assert(std::is_same_v<index_width::SmallestIndexType<256>, std::uint16_t>);
+    static_assert(std::is_same_v<index_width::SmallestIndexType<65535>, std::uint16_t>);
+    static_assert(std::is_same_v<index_width::SmallestIndexType<65536>, std::uint32_t>);
+    static_assert(std::is_same_v<index_width::SmallestIndexType<4294967296ULL>, std::uint64_t>);
+}
+
+TEST(IndexWidth, ReservedBits)
+{
+    static_assert(std::is_same_v<index_width::SmallestIndexType<127, 1>, std::uint8_t>);
+    static_assert(std::is_same_v<index_width::SmallestIndexType<128, 1>, std::uint16_t>);
+    static_assert(std::is_same_v<index_width::SmallestIndexType<63, 2>, std::uint8_t>);
+    static_assert(std::is_same_v<index_width::SmallestIndexType<64, 2>, std::uint16_t>);
+    static_assert(std::is_same_v<index_width::SmallestIndexType<32768, 1>, std::uint32_t>);
+}
+
+TEST(IndexWidth, RuntimeSizeMatchesType)
+{
+    // Raw views rebuild the layout at runtime
+    const std::size_t value_count = 300;
+    EXPECT_EQ(sizeof(index_width::SmallestIndexType<300>),
+              index_width::smallest_index_size_bytes(value_count));
+    EXPECT_EQ(sizeof(index_width::SmallestIndexType<300, 8>),
+              index_width::smallest_index_size_bytes(value_count, 8));
+}
+
+}  // namespace fixed_containers
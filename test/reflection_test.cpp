@@ -11,6 +11,7 @@
 
 #include <cstddef>
 #include <string_view>
+#include <tuple>
 #include <utility>
 
 namespace fixed_containers
@@ -603,6 +604,26 @@ TEST(Reflection, MockFailingAddressOfOperator)
                                [&]<typename T>(const std::string_view& /*name*/, const T&) {});
 }
 
+TEST(Reflection, WyhashOfAggregates)
+{
+    constexpr wyhash::hash<BaseStruct> HASH{};
+    static_assert(HASH({1, 2}) == HASH({1, 2}));
+    static_assert(HASH({1, 2}) != HASH({2, 1}));
+    // Hashes the same as the tuple of its fields
+    static_assert(HASH({1, 2}) == wyhash::hash<std::tuple<int, int>>{}({1, 2}));
+
+    // Nested aggregates are hashed recursively
+    struct Outer
+    {
+        int a;
+        BaseStruct b;
+    };
+    constexpr wyhash::hash<Outer> OUTER_HASH{};
+    static_assert(OUTER_HASH({1, {2, 3}}) != OUTER_HASH({1, {2, 4}}));
+    static_assert(OUTER_HASH({1, {2, 3}}) ==
+                  wyhash::hash<std::tuple<int, BaseStruct>>{}({1, BaseStruct{2, 3}}));
+}
+
 }  // namespace fixed_containers
 
 #endif
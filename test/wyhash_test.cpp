@@ -0,0 +1,149 @@
+#include "fixed_containers/wyhash.hpp"
+
+#include "fixed_containers/fixed_string.hpp"
+#include "fixed_containers/fixed_unordered_map.hpp"
+#include "fixed_containers/string_literal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+namespace fixed_containers
+{
+namespace
+{
+enum class Color : std::uint8_t
+{
+    RED,
+    GREEN,
+};
+
+template <class T>
+concept HasIdentityHash = requires { typename wyhash::identity_hash<T>; };
+template <class T>
+concept HasFastMixHash = requires { typename wyhash::fast_mix_hash<T>; };
+
+// Hashes the bytes through the runtime-only `void*` entry point
+std::uint64_t hash_at_runtime(std::string_view str)
+{
+    return wyhash_detail::hash(str.data(), static_cast<std::int64_t>(str.size()));
+}
+}  // namespace
+
+TEST(Wyhash, StringHashIsConstexpr)
+{
+    static constexpr std::string_view LONG_STRING =
+        "a string that is long enough to go through the 48-byte loop of wyhash";
+    constexpr std::uint64_t EMPTY = wyhash::hash<std::string_view>{}("");
+    constexpr std::uint64_t SHORT = wyhash::hash<std::string_view>{}("ab");
+    constexpr std::uint64_t MEDIUM = wyhash::hash<std::string_view>{}("hello");
+    constexpr std::uint64_t LONG = wyhash::hash<std::string_view>{}(LONG_STRING);
+
+    // Same values at compile time and at runtime
+    EXPECT_EQ(EMPTY, hash_at_runtime(""));
+    EXPECT_EQ(SHORT, hash_at_runtime("ab"));
+    EXPECT_EQ(MEDIUM, hash_at_runtime("hello"));
+    EXPECT_EQ(LONG, hash_at_runtime(LONG_STRING));
+    EXPECT_NE(SHORT, MEDIUM);
+
+    const std::wstring wide = L"hello";
+    constexpr std::uint64_t WIDE = wyhash::hash<std::wstring_view>{}(L"hello");
+    EXPECT_EQ(WIDE, wyhash::hash<std::wstring>{}(wide));
+}
+
+TEST(Wyhash, StringLiteral)
+{
+    static constexpr StringLiteral LITERAL = "hello";
+    constexpr std::uint64_t HASH = wyhash::hash<StringLiteral>{}(LITERAL);
+    static_assert(HASH == wyhash::hash<std::string_view>{}("hello"));
+    static_assert(HASH == wyhash::hash<FixedString<8>>{}(FixedString<8>{"hello"}));
+}
+
+TEST(Wyhash, IdentityHash)
+{
+    static_assert(wyhash::identity_hash<int>{}(42) == 42);
+    static_assert(wyhash::identity_hash<std::uint64_t>{}(UINT64_C(0xFFFFFFFFFFFFFFFF)) ==
+                  UINT64_C(0xFFFFFFFFFFFFFFFF));
+    static_assert(wyhash::identity_hash<Color>{}(Color::GREEN) == 1);
+
+    // Floating-point keys would be truncated, so 1.5 and 1.7 would collide
+    static_assert(HasIdentityHash<std::uint16_t>);
+    static_assert(!HasIdentityHash<double>);
+    static_assert(!HasIdentityHash<float>);
+}
+
+TEST(Wyhash, FastMixHash)
+{
+    constexpr wyhash::fast_mix_hash<int> HASH{};
+    static_assert(HASH(1) != HASH(2));
+    static_assert(HASH(1) != 1);
+    static_assert(HASH(1) != wyhash::hash<int>{}(1));
+    static_assert(wyhash::fast_mix_hash<Color>{}(Color::GREEN) == HASH(1));
+    static_assert(!HasFastMixHash<double>);
+
+    // Sequential keys differ in the upper bits too
+    static_assert((HASH(1) >> 32U) != (HASH(2) >> 32U));
+    // and in the lower bits
+    static_assert((HASH(1) & 0xFFFFU) != (HASH(2) & 0xFFFFU));
+}
+
+TEST(Wyhash, Pair)
+{
+    constexpr wyhash::hash<std::pair<int, int>> HASH{};
+    static_assert(HASH({1, 2}) == HASH({1, 2}));
+    static_assert(HASH({1, 2}) != HASH({2, 1}));
+    static_assert(HASH({1, 2}) != HASH({1, 3}));
+
+    static constexpr StringLiteral STR_A = "a";
+    static constexpr StringLiteral STR_B = "b";
+    using StringPair = std::pair<StringLiteral, int>;
+    static_assert(wyhash::hash<StringPair>{}({STR_A, 1}) != wyhash::hash<StringPair>{}({STR_B, 1}));
+}
+
+TEST(Wyhash, Tuple)
+{
+    using TupleType = std::tuple<int, Color, std::string_view>;
+    constexpr wyhash::hash<TupleType> HASH{};
+    static_assert(HASH({1, Color::RED, "a"}) == HASH({1, Color::RED, "a"}));
+    static_assert(HASH({1, Color::RED, "a"}) != HASH({1, Color::GREEN, "a"}));
+    static_assert(HASH({1, Color::RED, "a"}) != HASH({1, Color::RED, "b"}));
+
+    // Pairs and two-element tuples hash the same
+    static_assert(wyhash::hash<std::tuple<int, int>>{}({1, 2}) ==
+                  wyhash::hash<std::pair<int, int>>{}({1, 2}));
+    // Elements are not concatenated
+    static_assert(wyhash::hash<std::tuple<int>>{}({1}) !=
+                  wyhash::hash<std::tuple<int, int>>{}({1, 0}));
+    static_assert(wyhash::hash<std::tuple<>>{}({}) != wyhash::hash<std::tuple<int>>{}({0}));
+}
+
+TEST(Wyhash, UsableAsHashOfFixedUnorderedMap)
+{
+    FixedUnorderedMap<std::uint64_t, int, 10, wyhash::identity_hash<std::uint64_t>> var1{};
+    var1[UINT64_C(0x9E3779B97F4A7C15)] = 1;
+    var1[UINT64_C(0xBF58476D1CE4E5B9)] = 2;
+    EXPECT_EQ(2, var1.at(UINT64_C(0xBF58476D1CE4E5B9)));
+
+    FixedUnorderedMap<int, int, 10, wyhash::fast_mix_hash<int>> var2{};
+    for (int i = 0; i < 10; i++)
+    {
+        var2[i] = i * 10;
+    }
+    EXPECT_EQ(10, var2.size());
+    EXPECT_EQ(70, var2.at(7));
+
+    static constexpr StringLiteral STR_A = "a";
+    static constexpr StringLiteral STR_B = "b";
+    FixedUnorderedMap<std::pair<int, StringLiteral>, int, 10> var3{};
+    var3[{1, STR_A}] = 1;
+    var3[{1, STR_B}] = 2;
+    EXPECT_EQ(2, var3.size());
+    EXPECT_EQ(2, (var3.at({1, STR_B})));
+}
+
+}  // namespace fixed_containers